@@ -40,6 +40,9 @@ set(MAGIA_CV32_EXTRA_INCLUDE_DIRS
     "${CMAKE_SOURCE_DIR}/drivers/eventunit32/include"
 )
 
+# 1: Spatz is booted once by crt0.S and only clock-gated/un-gated around tasks
+set(SPATZ_PERSISTENT 0 CACHE STRING "Boot Spatz once in crt0 (0|1)")
+
 # ISA setup [MAGIA/Makefile]
 set(CV32_ARCH rv CACHE STRING "CV32 ARCH prefix")
 set(CV32_XLEN 32 CACHE STRING "CV32 XLEN")
@@ -54,6 +57,7 @@ set(CV32_COMPILE_FLAGS
     ${CV32_MARCH}
     ${CV32_MABI}
     "-D__riscv__"
+    "-DSPATZ_PERSISTENT=${SPATZ_PERSISTENT}"
     "-O2"
     "-flto"
     "-ffat-lto-objects"
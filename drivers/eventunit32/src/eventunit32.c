@@ -16,7 +16,7 @@
 #include "utils/magia_utils.h"
 // #include "utils/tinyprintf.h"
 #include "utils/printf.h"
-#include "utils/performance_utils.h"
+#include "utils/prof_utils.h"
 
 /**
  * @brief Initialize Event Unit with default configuration
@@ -24,11 +24,147 @@
 void eu32_init(eu_controller_t *ctrl)
 {
     // Clear all pending events
-    mmio32(EU_CORE_BUFFER_CLEAR) = 0xFFFFFFFF;
+    eu_clear_events(0xFFFFFFFF);
 
     // Reset masks to default (disabled)
-    mmio32(EU_CORE_MASK)     = 0x00000000;
-    mmio32(EU_CORE_IRQ_MASK) = 0x00000000;
+    eu_disable_events(0xFFFFFFFF);
+    eu_disable_irq(0xFFFFFFFF);
+}
+
+/**
+ * @brief Close the profiler regions of the engines whose completion events fired
+ */
+static inline void eu32_prof_events(uint32_t events)
+{
+    if (events & EU_REDMULE_DONE_MASK)
+        prof_cmp_f();
+    if (events & EU_IDMA_A2O_DONE_MASK)
+        prof_cmi_f();
+    if (events & EU_IDMA_O2A_DONE_MASK)
+        prof_cmo_f();
+    if (events & (EU_FSYNC_DONE_MASK | EU_SPATZ_DONE_MASK))
+        prof_snc_f();
+}
+
+/**
+ * @brief Wait for the first of several events
+ * @param event_mask Bitmask of events to wait for
+ * @param mode Wait mode (polling, WFE, etc.)
+ * @return Bitmask of the events that fired, the others stay pending; 0 if timeout/error
+ */
+uint32_t eu32_wait_any(eu_controller_t *ctrl, uint32_t event_mask, eu_wait_mode_t mode)
+{
+    // A single tile never gets a FSync event, see eu32_fsync_wait
+    if (MESH_2_POWER == 0 && (event_mask & EU_FSYNC_DONE_MASK))
+        return EU_FSYNC_DONE_MASK;
+    uint32_t fired = eu_wait_any_events(event_mask, mode, 1000000);
+    eu32_prof_events(fired);
+    return fired; // 1M cycle timeout
+}
+
+/**
+ * @brief Wait for all of several events, in whatever order they fire
+ * @param event_mask Bitmask of events to wait for
+ * @param mode Wait mode (polling, WFE, etc.)
+ * @return Non-zero if all the events fired, 0 if timeout/error
+ */
+uint32_t eu32_wait_all(eu_controller_t *ctrl, uint32_t event_mask, eu_wait_mode_t mode)
+{
+    if (MESH_2_POWER == 0)
+        event_mask &= ~EU_FSYNC_DONE_MASK;
+    uint32_t retval = eu_wait_all_events(event_mask, mode, 1000000);
+    if (retval)
+        eu32_prof_events(event_mask);
+    return retval; // 1M cycle timeout
+}
+
+//=============================================================================
+// Interrupt-driven completion callbacks
+//=============================================================================
+
+/* Core interrupt line and event unit event of each eu_irq_event_t */
+static const uint32_t eu32_irq_lines[EU_IRQ_NUM] = {
+    IRQ_A2O_DONE, IRQ_O2A_DONE, IRQ_REDMULE_EVT_0, IRQ_FSYNC_DONE};
+static const uint32_t eu32_irq_events[EU_IRQ_NUM] = {
+    EU_IDMA_A2O_DONE_MASK, EU_IDMA_O2A_DONE_MASK, EU_REDMULE_DONE_MASK, EU_FSYNC_DONE_MASK};
+
+/**
+ * @brief Remove the callback of the event, disable its interrupt line and drop its pending event
+ * The interrupts of the core are turned off again with the last callback.
+ * @return 0 on success, 1 if the event is unknown
+ */
+int eu32_irq_unregister(eu_controller_t *ctrl, eu_irq_event_t event)
+{
+    eu_config_t *cfg = (eu_config_t *)ctrl->cfg;
+
+    if ((uint32_t)event >= EU_IRQ_NUM) {
+        printf("Error: unknown interrupt event %d!\n", event);
+        return 1;
+    }
+
+    irq_dis(1u << eu32_irq_lines[event]);
+    cfg->irq[event].handler = NULL;
+    cfg->irq[event].arg     = NULL;
+    eu_clear_events(eu32_irq_events[event]);
+
+    for (uint32_t i = 0; i < EU_IRQ_NUM; i++)
+        if (cfg->irq[i].handler != NULL)
+            return 0;
+    irq_global_dis();
+    return 0;
+}
+
+/**
+ * @brief Call handler(arg) from the interrupt handler every time the event fires
+ * Enables the interrupt line of the event and the interrupts of the core.
+ * @return 0 on success, 1 if the event is unknown
+ */
+int eu32_irq_register(eu_controller_t *ctrl,
+                      eu_irq_event_t event,
+                      eu_irq_handler_t handler,
+                      void *arg)
+{
+    eu_config_t *cfg = (eu_config_t *)ctrl->cfg;
+
+    if ((uint32_t)event >= EU_IRQ_NUM) {
+        printf("Error: unknown interrupt event %d!\n", event);
+        return 1;
+    }
+    if (handler == NULL)
+        return eu32_irq_unregister(ctrl, event);
+
+    /* The handler goes in last: an interrupt in between finds no callback */
+    cfg->irq[event].handler = NULL;
+    cfg->irq[event].arg     = arg;
+    cfg->irq[event].handler = handler;
+    irq_set_context(cfg);
+    irq_en(1u << eu32_irq_lines[event]);
+    irq_global_en();
+    return 0;
+}
+
+/**
+ * @brief Interrupt handler of the tile, called by the crt0 trap entry with the interrupt line
+ * Runs the callbacks registered on the line, after consuming their event. A line without
+ * callbacks, enabled by the init of a driver, is disabled so that it does not trap again; its
+ * event is left in the buffer for the waits.
+ */
+void eu32_irq_dispatch(uint32_t line)
+{
+    eu_config_t *cfg = (eu_config_t *)irq_get_context();
+    uint32_t handled = 0;
+
+    for (uint32_t event = 0; cfg != NULL && event < EU_IRQ_NUM; event++) {
+        eu_irq_callback_t *callback = &cfg->irq[event];
+        if (eu32_irq_lines[event] != line || callback->handler == NULL)
+            continue;
+        eu_clear_events(eu32_irq_events[event]);
+        callback->handler(callback->arg);
+        handled = 1;
+    }
+
+    if (!handled)
+        irq_dis(1u << line);
 }
 
 //=============================================================================
@@ -58,9 +194,7 @@ void eu32_redmule_init(eu_controller_t *ctrl, uint32_t enable_irq)
 uint32_t eu32_redmule_wait(eu_controller_t *ctrl, eu_wait_mode_t mode)
 {
     uint32_t retval = eu_wait_events(EU_REDMULE_DONE_MASK, mode, 1000000);
-#if PROFILE_CMP == 1
-    stnl_cmp_f();
-#endif
+    prof_cmp_f();
     return retval; // 1M cycle timeout
 }
 
@@ -121,14 +255,10 @@ uint32_t eu32_idma_wait_direction(eu_controller_t *ctrl, uint32_t direction, eu_
 {
     uint32_t wait_mask = direction ? EU_IDMA_O2A_DONE_MASK : EU_IDMA_A2O_DONE_MASK;
     uint32_t retval    = eu_wait_events(wait_mask, mode, 1000000);
-#if PROFILE_CMO == 1
     if (direction == 1)
-        stnl_cmo_f();
-#endif
-#if PROFILE_CMI == 1
+        prof_cmo_f();
     if (direction == 0)
-        stnl_cmi_f();
-#endif
+        prof_cmi_f();
     return retval; // 1M cycle timeout
 }
 
@@ -140,9 +270,7 @@ uint32_t eu32_idma_wait_direction(eu_controller_t *ctrl, uint32_t direction, eu_
 uint32_t eu32_idma_wait_a2o(eu_controller_t *ctrl, eu_wait_mode_t mode)
 {
     uint32_t retval = eu_wait_events(EU_IDMA_A2O_DONE_MASK, mode, 1000000);
-#if PROFILE_CMI == 1
-    stnl_cmi_f();
-#endif
+    prof_cmi_f();
     return retval;
 }
 
@@ -154,9 +282,7 @@ uint32_t eu32_idma_wait_a2o(eu_controller_t *ctrl, eu_wait_mode_t mode)
 uint32_t eu32_idma_wait_o2a(eu_controller_t *ctrl, eu_wait_mode_t mode)
 {
     uint32_t retval = eu_wait_events(EU_IDMA_O2A_DONE_MASK, mode, 1000000);
-#if PROFILE_CMO == 1
-    stnl_cmo_f();
-#endif
+    prof_cmo_f();
     return retval;
 }
 
@@ -272,9 +398,7 @@ uint32_t eu32_fsync_wait(eu_controller_t *ctrl, eu_wait_mode_t mode)
     if (MESH_2_POWER == 0)
         return 1;
     uint32_t retval = eu_wait_events(EU_FSYNC_DONE_MASK, mode, 1000000);
-#if PROFILE_SNC == 1
-    stnl_snc_f();
-#endif
+    prof_snc_f();
     return retval; // 1M cycle timeout
 }
 
@@ -325,9 +449,7 @@ void eu32_spatz_init(eu_controller_t *ctrl, uint32_t enable_irq)
 uint32_t eu32_spatz_wait(eu_controller_t *ctrl, eu_wait_mode_t mode)
 {
     uint32_t retval = eu_wait_events(EU_SPATZ_DONE_MASK, mode, 1000000);
-#if PROFILE_SNC == 1
-    stnl_snc_f();
-#endif
+    prof_snc_f();
     return retval; // 1M cycle timeout
 }
 
@@ -342,6 +464,19 @@ uint32_t eu32_spatz_is_done(eu_controller_t *ctrl)
 
 extern void eu_init(eu_controller_t *ctrl)
     __attribute__((alias("eu32_init"), used, visibility("default")));
+extern uint32_t eu_wait_any(eu_controller_t *ctrl, uint32_t event_mask, eu_wait_mode_t mode)
+    __attribute__((alias("eu32_wait_any"), used, visibility("default")));
+extern uint32_t eu_wait_all(eu_controller_t *ctrl, uint32_t event_mask, eu_wait_mode_t mode)
+    __attribute__((alias("eu32_wait_all"), used, visibility("default")));
+extern int eu_irq_register(eu_controller_t *ctrl,
+                           eu_irq_event_t event,
+                           eu_irq_handler_t handler,
+                           void *arg)
+    __attribute__((alias("eu32_irq_register"), used, visibility("default")));
+extern int eu_irq_unregister(eu_controller_t *ctrl, eu_irq_event_t event)
+    __attribute__((alias("eu32_irq_unregister"), used, visibility("default")));
+extern void irq_dispatch(uint32_t line)
+    __attribute__((alias("eu32_irq_dispatch"), used, visibility("default")));
 extern void eu_redmule_init(eu_controller_t *ctrl, uint32_t enable_irq)
     __attribute__((alias("eu32_redmule_init"), used, visibility("default")));
 extern uint32_t eu_redmule_wait(eu_controller_t *ctrl, eu_wait_mode_t mode)
@@ -396,6 +531,10 @@ extern uint32_t eu_spatz_is_done(eu_controller_t *ctrl)
 
 eu_controller_api_t eu_api = {
     .init                = eu32_init,
+    .wait_any            = eu32_wait_any,
+    .wait_all            = eu32_wait_all,
+    .irq_register        = eu32_irq_register,
+    .irq_unregister      = eu32_irq_unregister,
     .redmule_init        = eu32_redmule_init,
     .redmule_wait        = eu32_redmule_wait,
     .redmule_is_busy     = eu32_redmule_is_busy,
@@ -13,9 +13,11 @@
 
 #include <stdint.h>
 #include "fsync32.h"
+#include "eventunit.h"
 #include "regs/tile_ctrl.h"
 #include "addr_map/tile_addr_map.h"
 #include "utils/fsync_isa_utils.h"
+#include "utils/eu_isa_utils.h"
 // #include "utils/tinyprintf.h"
 #include "utils/printf.h"
 #include "utils/magia_utils.h"
@@ -26,6 +28,44 @@ int fsync32_init(fsync_controller_t *ctrl)
     return 0;
 }
 
+/**
+ * Barriers of the sync_level/row/col/global functions, shared with their split-phase variants.
+ * The aggregate is 0 when there is no other tile to synchronize with.
+ */
+static fsync_barrier_t fsync32_level_barrier(uint32_t level, uint8_t dir)
+{
+    fsync_barrier_t barrier = {.id = dir, .aggregate = (uint32_t)(0xFFFFFFFF >> (31 - level))};
+    return barrier;
+}
+
+static fsync_barrier_t fsync32_row_barrier(void)
+{
+    fsync_barrier_t barrier = {.id = 0, .aggregate = 0};
+    if (MESH_Y_TILES > 1) {
+        barrier.id        = (GET_Y_ID(get_hartid()) % (MESH_Y_TILES / 2)) * 2;
+        barrier.aggregate = 0b101010101 >> ((5 - MESH_2_POWER) * 2);
+    }
+    return barrier;
+}
+
+static fsync_barrier_t fsync32_col_barrier(void)
+{
+    fsync_barrier_t barrier = {.id = 0, .aggregate = 0};
+    if (MESH_X_TILES > 1) {
+        barrier.id        = ((GET_X_ID(get_hartid()) % (MESH_X_TILES / 2)) * 2) + 1;
+        barrier.aggregate = 0b101010101 >> ((5 - MESH_2_POWER) * 2);
+    }
+    return barrier;
+}
+
+static fsync_barrier_t fsync32_global_barrier(void)
+{
+    fsync_barrier_t barrier = {.id = 0, .aggregate = 0};
+    if (MAX_SYNC_LVL > 0)
+        barrier.aggregate = (uint32_t)(0xFFFFFFFF >> (32 - MAX_SYNC_LVL));
+    return barrier;
+}
+
 /**
  * Synchronize the tile with the others of the selected synchronization tree level.
  * Level 0 will synchronize with the neighbor tile.
@@ -48,7 +88,8 @@ int fsync32_sync_level(fsync_controller_t *ctrl, uint32_t level, uint8_t dir)
     }
     // printf("Calling sync level %d, using %d", level, (uint32_t) (0xFFFFFFFF >> (31 - level)));
     // fsync((uint8_t) (1 << (level)));
-    fsync(dir, (uint32_t)(0xFFFFFFFF >> (31 - level)));
+    fsync_barrier_t barrier = fsync32_level_barrier(level, dir);
+    fsync(barrier.id, barrier.aggregate);
     // asm volatile("wfi" ::: "memory");
     return 0;
 }
@@ -87,13 +128,10 @@ int fsync32_getgroup_level(fsync_controller_t *ctrl, uint32_t level, uint32_t id
  */
 int fsync32_sync_row(fsync_controller_t *ctrl)
 {
-    if (MESH_Y_TILES == 1)
-        return 0;
-    else {
-        uint32_t y_id = GET_Y_ID(get_hartid()) % (MESH_Y_TILES / 2);
-        fsync(y_id * 2, (0b101010101 >> ((5 - MESH_2_POWER) * 2)));
-        return 0;
-    }
+    fsync_barrier_t barrier = fsync32_row_barrier();
+    if (barrier.aggregate)
+        fsync(barrier.id, barrier.aggregate);
+    return 0;
 }
 
 /**
@@ -101,13 +139,10 @@ int fsync32_sync_row(fsync_controller_t *ctrl)
  */
 int fsync32_sync_col(fsync_controller_t *ctrl)
 {
-    if (MESH_X_TILES == 1)
-        return 0;
-    else {
-        uint32_t x_id = GET_X_ID(get_hartid()) % (MESH_X_TILES / 2);
-        fsync(((x_id * 2) + 1), (0b101010101 >> ((5 - MESH_2_POWER) * 2)));
-        return 0;
-    }
+    fsync_barrier_t barrier = fsync32_col_barrier();
+    if (barrier.aggregate)
+        fsync(barrier.id, barrier.aggregate);
+    return 0;
 }
 
 /**
@@ -126,21 +161,23 @@ int fsync32_sync_diag(fsync_controller_t *ctrl)
 }
 
 /**
- * Synchronizes an arbitrary subset of tiles listed by a vector.
+ * Precomputes the barrier of the current tile with an arbitrary subset of tiles listed by a vector.
  * This algorithm follows the same logic you should be utilizing for writing the fsync function on
- * your own, but it does it automatically.
+ * your own, but it does it automatically. The barrier can then be waited on any number of times
+ * with fsync32_barrier_wait, at the cost of a single fsync instruction.
  *
  * @param ids Vector list of the ids of the tiles we want to synchronize.
  * @param n_tiles Number of tiles to be synchronized.
  * @param dir Fractalsync tree direction (0=horizontal, 1=vertical)
  * @param bid Barrier ID for synchronization
  */
-int fsync32_sync(fsync_controller_t *ctrl, uint32_t *ids, uint8_t n_tiles, uint8_t dir, uint8_t bid)
+fsync_barrier_t fsync32_barrier_create(
+    fsync_controller_t *ctrl, const uint32_t *ids, uint8_t n_tiles, uint8_t dir, uint8_t bid)
 {
+    fsync_barrier_t barrier = {.id = 0, .aggregate = 0};
+    uint32_t hartid         = get_hartid();
     if (MESH_2_POWER == 0)
-        return 0;
-    uint32_t aggregate = 0x00000000;
-    uint32_t hartid    = get_hartid();
+        return barrier;
     if (n_tiles <= 2) {
         for (uint8_t i = 0; i < n_tiles; i++) {
             if (hartid == ids[i])
@@ -152,17 +189,19 @@ int fsync32_sync(fsync_controller_t *ctrl, uint32_t *ids, uint8_t n_tiles, uint8
             if (x_diff == 0 && y_diff == 1) {
                 if (fsync32_getgroup_level(ctrl, 0, hartid, 1) ==
                     fsync32_getgroup_level(ctrl, 0, ids[i], 1))
-                    fsync(1, 0b1);
+                    barrier.id = 1;
                 else
-                    fsync(3, 0b1);
-                return 0;
+                    barrier.id = 3;
+                barrier.aggregate = 0b1;
+                return barrier;
             } else if (x_diff == 1 && y_diff == 0) {
                 if (fsync32_getgroup_level(ctrl, 0, hartid, 0) ==
                     fsync32_getgroup_level(ctrl, 0, ids[i], 0))
-                    fsync(0, 0b1);
+                    barrier.id = 0;
                 else
-                    fsync(2, 0b1);
-                return 0;
+                    barrier.id = 2;
+                barrier.aggregate = 0b1;
+                return barrier;
             }
         }
     }
@@ -172,16 +211,45 @@ int fsync32_sync(fsync_controller_t *ctrl, uint32_t *ids, uint8_t n_tiles, uint8
         for (uint8_t j = 0; j < MAX_SYNC_LVL; j++) {
             if (fsync32_getgroup_level(ctrl, j, hartid, dir) ==
                 fsync32_getgroup_level(ctrl, j, ids[i], dir)) {
-                aggregate = aggregate | ((uint32_t)(1 << j));
+                barrier.aggregate = barrier.aggregate | ((uint32_t)(1 << j));
                 break;
             }
         }
     }
-    if (aggregate) {
-        fsync((uint32_t)((bid * 2) + dir), aggregate);
+    barrier.id = (uint32_t)((bid * 2) + dir);
+    return barrier;
+}
+
+/**
+ * Synchronizes on a barrier built by fsync32_barrier_create.
+ *
+ * @return 0 if the fsync was issued (or the mesh has a single tile), 1 if the barrier has no
+ * tile to wait for.
+ */
+int fsync32_barrier_wait(fsync_controller_t *ctrl, fsync_barrier_t *barrier)
+{
+    if (MESH_2_POWER == 0)
         return 0;
-    }
-    return 1;
+    if (barrier->aggregate == 0)
+        return 1;
+    fsync(barrier->id, barrier->aggregate);
+    return 0;
+}
+
+/**
+ * Synchronizes an arbitrary subset of tiles listed by a vector.
+ * Builds the barrier on every call, use fsync32_barrier_create and fsync32_barrier_wait when
+ * the same subset synchronizes more than once.
+ *
+ * @param ids Vector list of the ids of the tiles we want to synchronize.
+ * @param n_tiles Number of tiles to be synchronized.
+ * @param dir Fractalsync tree direction (0=horizontal, 1=vertical)
+ * @param bid Barrier ID for synchronization
+ */
+int fsync32_sync(fsync_controller_t *ctrl, uint32_t *ids, uint8_t n_tiles, uint8_t dir, uint8_t bid)
+{
+    fsync_barrier_t barrier = fsync32_barrier_create(ctrl, ids, n_tiles, dir, bid);
+    return fsync32_barrier_wait(ctrl, &barrier);
 }
 
 /**
@@ -261,10 +329,88 @@ int fsync32_sync_down(fsync_controller_t *ctrl)
  */
 int fsync32_sync_global(fsync_controller_t *ctrl)
 {
-    if (MAX_SYNC_LVL == 0)
+    fsync_barrier_t barrier = fsync32_global_barrier();
+    if (barrier.aggregate)
+        fsync(barrier.id, barrier.aggregate);
+    return 0;
+}
+
+/**
+ * Arrives on a barrier built by fsync32_barrier_create, without waiting for it to open.
+ * The fsync instruction is issued here, so the barrier latency overlaps whatever the tile does
+ * before calling fsync32_wait.
+ *
+ * @return FSYNC_TOKEN_PENDING, or FSYNC_TOKEN_NONE if the barrier has no tile to wait for.
+ */
+fsync_token_t fsync32_arrive(fsync_controller_t *ctrl, fsync_barrier_t *barrier)
+{
+    if (MESH_2_POWER == 0 || barrier->aggregate == 0)
+        return FSYNC_TOKEN_NONE;
+    fsync_issue(barrier->id, barrier->aggregate);
+    return FSYNC_TOKEN_PENDING;
+}
+
+/**
+ * Arrives on the barrier of fsync32_sync_level.
+ */
+fsync_token_t fsync32_arrive_level(fsync_controller_t *ctrl, uint32_t level, uint8_t dir)
+{
+    if (MESH_2_POWER == 0)
+        return FSYNC_TOKEN_NONE;
+    if (level >= MAX_SYNC_LVL) {
+        printf("Error: synchronization level is too high! Maximum level is: %d\n",
+               MAX_SYNC_LVL - 1);
+        return FSYNC_TOKEN_NONE;
+    }
+    fsync_barrier_t barrier = fsync32_level_barrier(level, dir);
+    return fsync32_arrive(ctrl, &barrier);
+}
+
+/**
+ * Arrives on the barrier of fsync32_sync_row.
+ */
+fsync_token_t fsync32_arrive_row(fsync_controller_t *ctrl)
+{
+    fsync_barrier_t barrier = fsync32_row_barrier();
+    return fsync32_arrive(ctrl, &barrier);
+}
+
+/**
+ * Arrives on the barrier of fsync32_sync_col.
+ */
+fsync_token_t fsync32_arrive_col(fsync_controller_t *ctrl)
+{
+    fsync_barrier_t barrier = fsync32_col_barrier();
+    return fsync32_arrive(ctrl, &barrier);
+}
+
+/**
+ * Arrives on the barrier of fsync32_sync_global.
+ */
+fsync_token_t fsync32_arrive_global(fsync_controller_t *ctrl)
+{
+    fsync_barrier_t barrier = fsync32_global_barrier();
+    return fsync32_arrive(ctrl, &barrier);
+}
+
+/**
+ * Waits for the barrier of an arrive call to open.
+ * In polling mode the status register is polled, as fsync does. In interrupt mode the fsync
+ * event is consumed instead, as eu_fsync_wait does.
+ *
+ * @return 0 once the barrier is open, 1 on timeout.
+ */
+int fsync32_wait(fsync_controller_t *ctrl, fsync_token_t token)
+{
+    if (token == FSYNC_TOKEN_NONE)
         return 0;
-    else
-        fsync(0, (uint32_t)(0xFFFFFFFF >> (32 - MAX_SYNC_LVL)));
+#if STALLING == 1
+    fsync_poll();
+#else
+    if (eu_wait_events(EU_FSYNC_DONE_MASK, WFE, 1000000) == 0) // 1M cycle timeout
+        return 1;
+    prof_snc_f();
+#endif
     return 0;
 }
 
@@ -323,6 +469,23 @@ extern int fsync_sync_diag(fsync_controller_t *ctrl)
 extern int
 fsync_sync(fsync_controller_t *ctrl, uint32_t *ids, uint8_t n_tiles, uint8_t dir, uint8_t bid)
     __attribute__((alias("fsync32_sync"), used, visibility("default")));
+extern fsync_barrier_t fsync_barrier_create(
+    fsync_controller_t *ctrl, const uint32_t *ids, uint8_t n_tiles, uint8_t dir, uint8_t bid)
+    __attribute__((alias("fsync32_barrier_create"), used, visibility("default")));
+extern int fsync_barrier_wait(fsync_controller_t *ctrl, fsync_barrier_t *barrier)
+    __attribute__((alias("fsync32_barrier_wait"), used, visibility("default")));
+extern fsync_token_t fsync_arrive_level(fsync_controller_t *ctrl, uint32_t level, uint8_t dir)
+    __attribute__((alias("fsync32_arrive_level"), used, visibility("default")));
+extern fsync_token_t fsync_arrive_row(fsync_controller_t *ctrl)
+    __attribute__((alias("fsync32_arrive_row"), used, visibility("default")));
+extern fsync_token_t fsync_arrive_col(fsync_controller_t *ctrl)
+    __attribute__((alias("fsync32_arrive_col"), used, visibility("default")));
+extern fsync_token_t fsync_arrive_global(fsync_controller_t *ctrl)
+    __attribute__((alias("fsync32_arrive_global"), used, visibility("default")));
+extern fsync_token_t fsync_arrive(fsync_controller_t *ctrl, fsync_barrier_t *barrier)
+    __attribute__((alias("fsync32_arrive"), used, visibility("default")));
+extern int fsync_wait(fsync_controller_t *ctrl, fsync_token_t token)
+    __attribute__((alias("fsync32_wait"), used, visibility("default")));
 extern int fsync_sync_left(fsync_controller_t *ctrl)
     __attribute__((alias("fsync32_sync_left"), used, visibility("default")));
 extern int fsync_sync_right(fsync_controller_t *ctrl)
@@ -351,6 +514,14 @@ fsync_controller_api_t fsync_api = {
     .sync_row       = fsync32_sync_row,
     .sync_diag      = fsync32_sync_diag,
     .sync           = fsync32_sync,
+    .barrier_create = fsync32_barrier_create,
+    .barrier_wait   = fsync32_barrier_wait,
+    .arrive_level   = fsync32_arrive_level,
+    .arrive_row     = fsync32_arrive_row,
+    .arrive_col     = fsync32_arrive_col,
+    .arrive_global  = fsync32_arrive_global,
+    .arrive         = fsync32_arrive,
+    .wait           = fsync32_wait,
     .sync_left      = fsync32_sync_left,
     .sync_right     = fsync32_sync_right,
     .sync_up        = fsync32_sync_up,
@@ -15,7 +15,9 @@
 #include "idma32.h"
 #include "regs/tile_ctrl.h"
 #include "utils/idma_isa_utils.h"
+#include "utils/eu_isa_utils.h"
 #include "utils/magia_utils.h"
+#include "utils/prof_utils.h"
 // #include "utils/tinyprintf.h"
 #include "utils/printf.h"
 
@@ -26,9 +28,86 @@ int idma32_init(idma_controller_t *ctrl)
     return 0;
 }
 
-/* static inline __attribute__((always_inline)) void idma32_wait(){
-    asm volatile("wfi" ::: "memory");
-} */
+static inline idma_queue_t *idma32_queue(idma_controller_t *ctrl, uint8_t dir)
+{
+    return &((idma_config_t *)ctrl->cfg)->queue[dir ? 1 : 0];
+}
+
+/**
+ * Account for a transfer just issued on the given direction.
+ * Sequence number 0 is skipped when the counter wraps, so that IDMA_HANDLE_NONE is never the
+ * handle of an issued transfer. The skipped number is only retired when the backend goes idle.
+ */
+static inline void idma32_queue_push(idma_controller_t *ctrl, uint8_t dir)
+{
+    idma_queue_t *queue = idma32_queue(ctrl, dir);
+
+    queue->issued++;
+    if (dir == 0 && IDMA_HANDLE_SEQ(queue->issued) == 0)
+        queue->issued++;
+}
+
+/**
+ * @return Handle of the last transfer issued on the given direction.
+ */
+static inline idma_handle_t idma32_queue_last(idma_controller_t *ctrl, uint8_t dir)
+{
+    return ((uint32_t)(dir ? 1 : 0) << 31) | IDMA_HANDLE_SEQ(idma32_queue(ctrl, dir)->issued);
+}
+
+/**
+ * Retire the completed transfers of the given direction.
+ * Each buffered completion event retires the oldest transfer in flight. Events of transfers
+ * completing back-to-back can merge in the event unit buffer, so once the backend reports
+ * idle every issued transfer is retired at once and the leftover event is dropped.
+ */
+static void idma32_queue_retire(idma_queue_t *queue, uint8_t dir)
+{
+    uint32_t done_mask = dir ? EU_IDMA_O2A_DONE_MASK : EU_IDMA_A2O_DONE_MASK;
+    uint32_t retired   = queue->completed;
+
+    if (queue->completed == queue->issued)
+        return;
+
+    if (eu_get_events() & done_mask) {
+        eu_clear_events(done_mask);
+        queue->completed++;
+    }
+
+    if ((mmio32(IDMA_STATUS_ADDR(dir, 0)) & IDMA_STATUS_BUSY_MASK) == 0) {
+        queue->completed = queue->issued;
+        eu_clear_events(done_mask);
+    }
+
+    /* One profiler end per retired transfer, matching the start of each of them */
+    for (; retired != queue->completed; retired++) {
+        if (dir == 1)
+            prof_cmo_f();
+        else
+            prof_cmi_f();
+    }
+}
+
+/**
+ * @return Non-zero if the transfer with the given sequence number has retired.
+ */
+static inline uint32_t idma32_queue_is_retired(idma_queue_t *queue, uint32_t seq)
+{
+    /* Sequence numbers are 31-bit wide, compare them modulo 2^31 */
+    return ((int32_t)((queue->completed - seq) << 1)) >= 0;
+}
+
+/**
+ * Block until a slot of the given direction queue is free.
+ */
+static void idma32_queue_reserve(idma_queue_t *queue, uint8_t dir)
+{
+    idma32_queue_retire(queue, dir);
+    while ((queue->issued - queue->completed) >= IDMA_QUEUE_DEPTH) {
+        evt_read32(EU_CORE_EVENT_WAIT);
+        idma32_queue_retire(queue, dir);
+    }
+}
 
 /**
  * Start 1-dimensional memory copy
@@ -57,7 +136,6 @@ int idma32_memcpy_1d(
         idma_start_in();
         // printf("IDMA_memcpy_1d: Detected IRQ...\n");
     }
-    return 0;
 #else
     idma_mm_conf(dir, 0, 0, 0, 0, 0, 0, 3);
     if (dir) {
@@ -69,6 +147,8 @@ int idma32_memcpy_1d(
     idma_mm_set_std3_rep3(dir, 0, 0, 1);
     idma_mm_start(dir);
 #endif
+    idma32_queue_push(ctrl, dir);
+    return 0;
 }
 
 /**
@@ -120,6 +200,202 @@ int idma32_memcpy_2d(idma_controller_t *ctrl,
     idma_mm_set_std3_rep3(dir, 0, 0, 1);
     idma_mm_start(dir);
 #endif
+    idma32_queue_push(ctrl, dir);
+    return 0;
+}
+
+/**
+ * Program and start a single 3-dimensional job on the given direction.
+ *
+ * @param dim_2 Second dimension (rows), strides for both the AXI and the OBI side.
+ * @param dim_3 Third dimension (planes), strides for both the AXI and the OBI side.
+ */
+static void idma32_start_3d(uint8_t dir,
+                            uint32_t axi_addr,
+                            uint32_t obi_addr,
+                            uint32_t len,
+                            const idma_dim_t *dim_2,
+                            const idma_dim_t *dim_3)
+{
+#if IDMA_MM == 0
+    if (dir) { // OBI to AXI (L1 to L2)
+        idma_conf_out();
+        idma_set_addr_len_out(axi_addr, obi_addr, len);
+        idma_set_std2_rep2_out(dim_2->axi_std, dim_2->obi_std, dim_2->reps);
+        idma_set_std3_rep3_out(dim_3->axi_std, dim_3->obi_std, dim_3->reps);
+        idma_start_out();
+    } else { // AXI to OBI (L2 to L1)
+        idma_conf_in();
+        idma_set_addr_len_in(obi_addr, axi_addr, len);
+        idma_set_std2_rep2_in(dim_2->obi_std, dim_2->axi_std, dim_2->reps);
+        idma_set_std3_rep3_in(dim_3->obi_std, dim_3->axi_std, dim_3->reps);
+        idma_start_in();
+    }
+#else
+    idma_mm_conf(dir, 0, 0, 0, 0, 0, 0, 3);
+    if (dir) {
+        idma_mm_set_addr_len(dir, axi_addr, obi_addr, len);
+        idma_mm_set_std2_rep2(dir, dim_2->axi_std, dim_2->obi_std, dim_2->reps);
+        idma_mm_set_std3_rep3(dir, dim_3->axi_std, dim_3->obi_std, dim_3->reps);
+    } else {
+        idma_mm_set_addr_len(dir, obi_addr, axi_addr, len);
+        idma_mm_set_std2_rep2(dir, dim_2->obi_std, dim_2->axi_std, dim_2->reps);
+        idma_mm_set_std3_rep3(dir, dim_3->obi_std, dim_3->axi_std, dim_3->reps);
+    }
+    idma_mm_start(dir);
+#endif
+}
+
+/**
+ * Start 3-dimensional memory copy.
+ *
+ * @param dir Copy Direction. 0 = AXI to OBI (L2 to L1), !0 = OBI to AXI (L1 to L2).
+ * @param axi_addr AXI/L2 memory address of first element.
+ * @param obi_addr OBI/L1 memory address of first element.
+ * @param len Byte length of memory block to transfer for each repetition.
+ * @param std_2 Offset between the starts of two consecutive blocks on the AXI side.
+ * @param reps_2 Number of blocks per plane.
+ * @param std_3 Offset between the starts of two consecutive planes on the AXI side.
+ * @param reps_3 Number of planes.
+ */
+int idma32_memcpy_3d(idma_controller_t *ctrl,
+                     uint8_t dir,
+                     uint32_t axi_addr,
+                     uint32_t obi_addr,
+                     uint32_t len,
+                     uint32_t std_2,
+                     uint32_t reps_2,
+                     uint32_t std_3,
+                     uint32_t reps_3)
+{
+    /* The OBI side is densely packed */
+    idma_dim_t dim_2 = {.axi_std = std_2, .obi_std = len, .reps = reps_2};
+    idma_dim_t dim_3 = {.axi_std = std_3, .obi_std = len * reps_2, .reps = reps_3};
+
+    idma32_start_3d(dir, axi_addr, obi_addr, len, &dim_2, &dim_3);
+    idma32_queue_push(ctrl, dir);
+    return 0;
+}
+
+/**
+ * Start N-dimensional memory copy.
+ * The two innermost strided dimensions are handled by the backend, each combination of the
+ * outer dimension indices is issued as a separate 3-dimensional job.
+ *
+ * @param desc Transfer descriptor.
+ * @return Handle of the last issued job, IDMA_HANDLE_NONE on an invalid descriptor.
+ */
+idma_handle_t idma32_memcpy_nd(idma_controller_t *ctrl, const idma_nd_desc_t *desc)
+{
+    uint8_t dir         = desc->dir ? 1 : 0;
+    idma_queue_t *queue = idma32_queue(ctrl, dir);
+    idma_dim_t hw_dims[2];
+    uint32_t planes = 1;
+
+    if (desc->ndims > IDMA_MAX_DIMS) {
+        printf("IDMA: %d dimensions requested, at most %d supported.\n",
+               desc->ndims,
+               IDMA_MAX_DIMS);
+        return IDMA_HANDLE_NONE;
+    }
+
+    for (uint32_t i = 0; i < 2; i++) {
+        if (i < desc->ndims) {
+            hw_dims[i] = desc->dims[i];
+        } else {
+            hw_dims[i] = (idma_dim_t){.axi_std = 0, .obi_std = 0, .reps = 1};
+        }
+    }
+    for (uint32_t i = 2; i < desc->ndims; i++)
+        planes *= desc->dims[i].reps;
+
+    for (uint32_t p = 0; p < planes; p++) {
+        uint32_t axi_addr = desc->axi_addr;
+        uint32_t obi_addr = desc->obi_addr;
+        uint32_t index    = p;
+
+        for (uint32_t i = 2; i < desc->ndims; i++) {
+            uint32_t idx = index % desc->dims[i].reps;
+            index /= desc->dims[i].reps;
+            axi_addr += idx * desc->dims[i].axi_std;
+            obi_addr += idx * desc->dims[i].obi_std;
+        }
+
+        idma32_queue_reserve(queue, dir);
+        idma32_start_3d(dir, axi_addr, obi_addr, desc->len, &hw_dims[0], &hw_dims[1]);
+        idma32_queue_push(ctrl, dir);
+    }
+
+    return idma32_queue_last(ctrl, dir);
+}
+
+/**
+ * Enqueue a 1-dimensional memory copy, see idma32_memcpy_1d.
+ *
+ * @return Handle of the enqueued transfer.
+ */
+idma_handle_t idma32_memcpy_1d_async(
+    idma_controller_t *ctrl, uint8_t dir, uint32_t axi_addr, uint32_t obi_addr, uint32_t len)
+{
+    idma32_queue_reserve(idma32_queue(ctrl, dir), dir);
+    idma32_memcpy_1d(ctrl, dir, axi_addr, obi_addr, len);
+    return idma32_queue_last(ctrl, dir);
+}
+
+/**
+ * Enqueue a 2-dimensional memory copy, see idma32_memcpy_2d.
+ *
+ * @return Handle of the enqueued transfer.
+ */
+idma_handle_t idma32_memcpy_2d_async(idma_controller_t *ctrl,
+                                     uint8_t dir,
+                                     uint32_t axi_addr,
+                                     uint32_t obi_addr,
+                                     uint32_t len,
+                                     uint32_t std,
+                                     uint32_t reps)
+{
+    idma32_queue_reserve(idma32_queue(ctrl, dir), dir);
+    idma32_memcpy_2d(ctrl, dir, axi_addr, obi_addr, len, std, reps);
+    return idma32_queue_last(ctrl, dir);
+}
+
+/**
+ * Non-blocking completion check of an asynchronous transfer.
+ *
+ * @param handle Handle returned by idma32_memcpy_1d_async or idma32_memcpy_2d_async.
+ * @return 1 if the transfer has completed, 0 otherwise.
+ */
+int idma32_test(idma_controller_t *ctrl, idma_handle_t handle)
+{
+    uint8_t dir         = IDMA_HANDLE_DIR(handle);
+    idma_queue_t *queue = idma32_queue(ctrl, dir);
+
+    if (handle == IDMA_HANDLE_NONE)
+        return 1;
+    idma32_queue_retire(queue, dir);
+    return idma32_queue_is_retired(queue, IDMA_HANDLE_SEQ(handle)) ? 1 : 0;
+}
+
+/**
+ * Wait for the completion of an asynchronous transfer, sleeping on the event unit in between
+ * completion events.
+ *
+ * @param handle Handle returned by idma32_memcpy_1d_async or idma32_memcpy_2d_async.
+ * @return 0 once the transfer has completed.
+ */
+int idma32_wait(idma_controller_t *ctrl, idma_handle_t handle)
+{
+    uint8_t dir         = IDMA_HANDLE_DIR(handle);
+    idma_queue_t *queue = idma32_queue(ctrl, dir);
+
+    if (handle == IDMA_HANDLE_NONE)
+        return 0;
+    idma32_queue_retire(queue, dir);
+    while (!idma32_queue_is_retired(queue, IDMA_HANDLE_SEQ(handle))) {
+        evt_read32(EU_CORE_EVENT_WAIT);
+        idma32_queue_retire(queue, dir);
+    }
     return 0;
 }
 
@@ -136,11 +412,43 @@ extern int idma_memcpy_2d(idma_controller_t *ctrl,
                           uint32_t std,
                           uint32_t reps)
     __attribute__((alias("idma32_memcpy_2d"), used, visibility("default")));
+extern int idma_memcpy_3d(idma_controller_t *ctrl,
+                          uint8_t dir,
+                          uint32_t axi_addr,
+                          uint32_t obi_addr,
+                          uint32_t len,
+                          uint32_t std_2,
+                          uint32_t reps_2,
+                          uint32_t std_3,
+                          uint32_t reps_3)
+    __attribute__((alias("idma32_memcpy_3d"), used, visibility("default")));
+extern idma_handle_t idma_memcpy_nd(idma_controller_t *ctrl, const idma_nd_desc_t *desc)
+    __attribute__((alias("idma32_memcpy_nd"), used, visibility("default")));
+extern idma_handle_t idma_memcpy_1d_async(
+    idma_controller_t *ctrl, uint8_t dir, uint32_t axi_addr, uint32_t obi_addr, uint32_t len)
+    __attribute__((alias("idma32_memcpy_1d_async"), used, visibility("default")));
+extern idma_handle_t idma_memcpy_2d_async(idma_controller_t *ctrl,
+                                          uint8_t dir,
+                                          uint32_t axi_addr,
+                                          uint32_t obi_addr,
+                                          uint32_t len,
+                                          uint32_t std,
+                                          uint32_t reps)
+    __attribute__((alias("idma32_memcpy_2d_async"), used, visibility("default")));
+extern int idma_wait(idma_controller_t *ctrl, idma_handle_t handle)
+    __attribute__((alias("idma32_wait"), used, visibility("default")));
+extern int idma_test(idma_controller_t *ctrl, idma_handle_t handle)
+    __attribute__((alias("idma32_test"), used, visibility("default")));
 
 /* Export the IDMA-specific controller API */
 idma_controller_api_t idma_api = {
-    .init = idma32_init,
-    /*     .wait = idma32_wait, */
-    .memcpy_1d = idma32_memcpy_1d,
-    .memcpy_2d = idma32_memcpy_2d,
+    .init            = idma32_init,
+    .wait            = idma32_wait,
+    .test            = idma32_test,
+    .memcpy_1d       = idma32_memcpy_1d,
+    .memcpy_2d       = idma32_memcpy_2d,
+    .memcpy_3d       = idma32_memcpy_3d,
+    .memcpy_nd       = idma32_memcpy_nd,
+    .memcpy_1d_async = idma32_memcpy_1d_async,
+    .memcpy_2d_async = idma32_memcpy_2d_async,
 };
\ No newline at end of file
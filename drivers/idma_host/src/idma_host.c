@@ -0,0 +1,303 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+//
+// This file provides the strong (driver-specific) implementations for the iDMA functions on the
+// host functional model: every transfer is a copy done by the calling thread, so it has completed
+// when the function returns. The transfer queues and the completion events are kept up to date,
+// so that the code waiting on them runs unchanged.
+
+#include <stdint.h>
+#include <string.h>
+#include "idma_host.h"
+#include "regs/tile_ctrl.h"
+#include "addr_map/tile_addr_map.h"
+#include "utils/eu_isa_utils.h"
+#include "utils/prof_utils.h"
+#include "utils/printf.h"
+
+#define HOST_PTR(addr) ((void *)(uintptr_t)(addr))
+
+int idma_host_init(idma_controller_t *ctrl)
+{
+    return 0;
+}
+
+static inline idma_queue_t *idma_host_queue(idma_controller_t *ctrl, uint8_t dir)
+{
+    return &((idma_config_t *)ctrl->cfg)->queue[dir ? 1 : 0];
+}
+
+/**
+ * A transfer starts on the given direction, profiled like idma_mm_start on the mesh.
+ */
+static inline void idma_host_issue(uint8_t dir)
+{
+    if (dir)
+        prof_cmo_s();
+    else
+        prof_cmi_s();
+}
+
+/**
+ * Account for a transfer just done on the given direction, it is retired right away.
+ */
+static inline void idma_host_queue_push(idma_controller_t *ctrl, uint8_t dir)
+{
+    idma_queue_t *queue = idma_host_queue(ctrl, dir);
+
+    queue->issued++;
+    if (dir == 0 && IDMA_HANDLE_SEQ(queue->issued) == 0)
+        queue->issued++;
+    queue->completed = queue->issued;
+    eu_host_set_events(dir ? EU_IDMA_O2A_DONE_MASK : EU_IDMA_A2O_DONE_MASK);
+    if (dir)
+        prof_cmo_f();
+    else
+        prof_cmi_f();
+}
+
+/**
+ * @return Handle of the last transfer issued on the given direction.
+ */
+static inline idma_handle_t idma_host_queue_last(idma_controller_t *ctrl, uint8_t dir)
+{
+    return ((uint32_t)(dir ? 1 : 0) << 31) | IDMA_HANDLE_SEQ(idma_host_queue(ctrl, dir)->issued);
+}
+
+/**
+ * Copy a 3-dimensional block, the strides of each dimension are given for both sides.
+ */
+static void idma_host_copy_3d(uint8_t dir,
+                              uint32_t axi_addr,
+                              uint32_t obi_addr,
+                              uint32_t len,
+                              const idma_dim_t *dim_2,
+                              const idma_dim_t *dim_3)
+{
+    for (uint32_t p = 0; p < dim_3->reps; p++) {
+        for (uint32_t r = 0; r < dim_2->reps; r++) {
+            uint32_t axi = axi_addr + p * dim_3->axi_std + r * dim_2->axi_std;
+            uint32_t obi = obi_addr + p * dim_3->obi_std + r * dim_2->obi_std;
+            if (dir)
+                memcpy(HOST_PTR(axi), HOST_PTR(obi), len);
+            else
+                memcpy(HOST_PTR(obi), HOST_PTR(axi), len);
+        }
+    }
+}
+
+/**
+ * 1-dimensional memory copy
+ *
+ * @param dir Copy Direction. 0 = AXI to OBI (L2 to L1), !0 = OBI to AXI (L1 to L2).
+ * @param axi_addr AXI/L2 memory address of first element.
+ * @param obi_addr OBI/L1 memory address of first element.
+ * @param len Byte length of memory block to transfer.
+ */
+int idma_host_memcpy_1d(
+    idma_controller_t *ctrl, uint8_t dir, uint32_t axi_addr, uint32_t obi_addr, uint32_t len)
+{
+    idma_host_issue(dir);
+    if (dir)
+        memcpy(HOST_PTR(axi_addr), HOST_PTR(obi_addr), len);
+    else
+        memcpy(HOST_PTR(obi_addr), HOST_PTR(axi_addr), len);
+    idma_host_queue_push(ctrl, dir);
+    return 0;
+}
+
+/**
+ * 2-dimensional memory copy, strided on the AXI side and densely packed on the OBI side.
+ *
+ * @param len Byte length of memory block to transfer for each repetition.
+ * @param std Offset between the starts of two consecutive blocks on the AXI side.
+ * @param reps Number of repetitions.
+ */
+int idma_host_memcpy_2d(idma_controller_t *ctrl,
+                        uint8_t dir,
+                        uint32_t axi_addr,
+                        uint32_t obi_addr,
+                        uint32_t len,
+                        uint32_t std,
+                        uint32_t reps)
+{
+    idma_dim_t dim_2 = {.axi_std = std, .obi_std = len, .reps = reps};
+    idma_dim_t dim_3 = {.axi_std = 0, .obi_std = 0, .reps = 1};
+
+    idma_host_issue(dir);
+    idma_host_copy_3d(dir, axi_addr, obi_addr, len, &dim_2, &dim_3);
+    idma_host_queue_push(ctrl, dir);
+    return 0;
+}
+
+/**
+ * 3-dimensional memory copy, see idma32_memcpy_3d.
+ */
+int idma_host_memcpy_3d(idma_controller_t *ctrl,
+                        uint8_t dir,
+                        uint32_t axi_addr,
+                        uint32_t obi_addr,
+                        uint32_t len,
+                        uint32_t std_2,
+                        uint32_t reps_2,
+                        uint32_t std_3,
+                        uint32_t reps_3)
+{
+    /* The OBI side is densely packed */
+    idma_dim_t dim_2 = {.axi_std = std_2, .obi_std = len, .reps = reps_2};
+    idma_dim_t dim_3 = {.axi_std = std_3, .obi_std = len * reps_2, .reps = reps_3};
+
+    idma_host_issue(dir);
+    idma_host_copy_3d(dir, axi_addr, obi_addr, len, &dim_2, &dim_3);
+    idma_host_queue_push(ctrl, dir);
+    return 0;
+}
+
+/**
+ * N-dimensional memory copy, issued as one 3-dimensional job per plane of the outer dimensions
+ * like on the mesh.
+ *
+ * @return Handle of the last issued job, IDMA_HANDLE_NONE on an invalid descriptor.
+ */
+idma_handle_t idma_host_memcpy_nd(idma_controller_t *ctrl, const idma_nd_desc_t *desc)
+{
+    uint8_t dir = desc->dir ? 1 : 0;
+    idma_dim_t hw_dims[2];
+    uint32_t planes = 1;
+
+    if (desc->ndims > IDMA_MAX_DIMS) {
+        printf("IDMA: %d dimensions requested, at most %d supported.\n",
+               desc->ndims,
+               IDMA_MAX_DIMS);
+        return IDMA_HANDLE_NONE;
+    }
+
+    for (uint32_t i = 0; i < 2; i++) {
+        if (i < desc->ndims) {
+            hw_dims[i] = desc->dims[i];
+        } else {
+            hw_dims[i] = (idma_dim_t){.axi_std = 0, .obi_std = 0, .reps = 1};
+        }
+    }
+    for (uint32_t i = 2; i < desc->ndims; i++)
+        planes *= desc->dims[i].reps;
+
+    for (uint32_t p = 0; p < planes; p++) {
+        uint32_t axi_addr = desc->axi_addr;
+        uint32_t obi_addr = desc->obi_addr;
+        uint32_t index    = p;
+
+        for (uint32_t i = 2; i < desc->ndims; i++) {
+            uint32_t idx = index % desc->dims[i].reps;
+            index /= desc->dims[i].reps;
+            axi_addr += idx * desc->dims[i].axi_std;
+            obi_addr += idx * desc->dims[i].obi_std;
+        }
+
+        idma_host_issue(dir);
+        idma_host_copy_3d(dir, axi_addr, obi_addr, desc->len, &hw_dims[0], &hw_dims[1]);
+        idma_host_queue_push(ctrl, dir);
+    }
+
+    return idma_host_queue_last(ctrl, dir);
+}
+
+idma_handle_t idma_host_memcpy_1d_async(
+    idma_controller_t *ctrl, uint8_t dir, uint32_t axi_addr, uint32_t obi_addr, uint32_t len)
+{
+    idma_host_memcpy_1d(ctrl, dir, axi_addr, obi_addr, len);
+    return idma_host_queue_last(ctrl, dir);
+}
+
+idma_handle_t idma_host_memcpy_2d_async(idma_controller_t *ctrl,
+                                        uint8_t dir,
+                                        uint32_t axi_addr,
+                                        uint32_t obi_addr,
+                                        uint32_t len,
+                                        uint32_t std,
+                                        uint32_t reps)
+{
+    idma_host_memcpy_2d(ctrl, dir, axi_addr, obi_addr, len, std, reps);
+    return idma_host_queue_last(ctrl, dir);
+}
+
+/**
+ * @return 1, every transfer has completed when it is issued.
+ */
+int idma_host_test(idma_controller_t *ctrl, idma_handle_t handle)
+{
+    return 1;
+}
+
+/**
+ * Consume the completion event of the transfer direction.
+ *
+ * @return 0, every transfer has completed when it is issued.
+ */
+int idma_host_wait(idma_controller_t *ctrl, idma_handle_t handle)
+{
+    if (handle == IDMA_HANDLE_NONE)
+        return 0;
+    if (IDMA_HANDLE_DIR(handle))
+        eu_clear_events(EU_IDMA_O2A_DONE_MASK);
+    else
+        eu_clear_events(EU_IDMA_A2O_DONE_MASK);
+    return 0;
+}
+
+extern int idma_init(idma_controller_t *ctrl)
+    __attribute__((alias("idma_host_init"), used, visibility("default")));
+extern int idma_memcpy_1d(
+    idma_controller_t *ctrl, uint8_t dir, uint32_t axi_addr, uint32_t obi_addr, uint32_t len)
+    __attribute__((alias("idma_host_memcpy_1d"), used, visibility("default")));
+extern int idma_memcpy_2d(idma_controller_t *ctrl,
+                          uint8_t dir,
+                          uint32_t axi_addr,
+                          uint32_t obi_addr,
+                          uint32_t len,
+                          uint32_t std,
+                          uint32_t reps)
+    __attribute__((alias("idma_host_memcpy_2d"), used, visibility("default")));
+extern int idma_memcpy_3d(idma_controller_t *ctrl,
+                          uint8_t dir,
+                          uint32_t axi_addr,
+                          uint32_t obi_addr,
+                          uint32_t len,
+                          uint32_t std_2,
+                          uint32_t reps_2,
+                          uint32_t std_3,
+                          uint32_t reps_3)
+    __attribute__((alias("idma_host_memcpy_3d"), used, visibility("default")));
+extern idma_handle_t idma_memcpy_nd(idma_controller_t *ctrl, const idma_nd_desc_t *desc)
+    __attribute__((alias("idma_host_memcpy_nd"), used, visibility("default")));
+extern idma_handle_t idma_memcpy_1d_async(
+    idma_controller_t *ctrl, uint8_t dir, uint32_t axi_addr, uint32_t obi_addr, uint32_t len)
+    __attribute__((alias("idma_host_memcpy_1d_async"), used, visibility("default")));
+extern idma_handle_t idma_memcpy_2d_async(idma_controller_t *ctrl,
+                                          uint8_t dir,
+                                          uint32_t axi_addr,
+                                          uint32_t obi_addr,
+                                          uint32_t len,
+                                          uint32_t std,
+                                          uint32_t reps)
+    __attribute__((alias("idma_host_memcpy_2d_async"), used, visibility("default")));
+extern int idma_wait(idma_controller_t *ctrl, idma_handle_t handle)
+    __attribute__((alias("idma_host_wait"), used, visibility("default")));
+extern int idma_test(idma_controller_t *ctrl, idma_handle_t handle)
+    __attribute__((alias("idma_host_test"), used, visibility("default")));
+
+/* Export the IDMA-specific controller API */
+idma_controller_api_t idma_api = {
+    .init            = idma_host_init,
+    .wait            = idma_host_wait,
+    .test            = idma_host_test,
+    .memcpy_1d       = idma_host_memcpy_1d,
+    .memcpy_2d       = idma_host_memcpy_2d,
+    .memcpy_3d       = idma_host_memcpy_3d,
+    .memcpy_nd       = idma_host_memcpy_nd,
+    .memcpy_1d_async = idma_host_memcpy_1d_async,
+    .memcpy_2d_async = idma_host_memcpy_2d_async,
+};
@@ -15,9 +15,55 @@
 #include "redmule16.h"
 #include "regs/tile_ctrl.h"
 #include "utils/redmule_isa_utils.h"
+#include "utils/eu_isa_utils.h"
 #include "utils/magia_utils.h"
+#include "utils/prof_utils.h"
 #include "utils/printf.h"
 
+/* Jobs that can be queued in hardware: the custom-instruction path has no job queue */
+#if REDMULE_MM == 1
+#define REDMULE16_QUEUE_DEPTH (2)
+#else
+#define REDMULE16_QUEUE_DEPTH (1)
+#endif
+
+/**
+ * Retire the completed jobs.
+ * Each buffered completion event retires the oldest job in flight. Events of jobs completing
+ * back-to-back can merge in the event unit buffer, so once the accelerator reports idle every
+ * submitted job is retired at once and the leftover event is dropped.
+ */
+static void redmule16_retire(redmule_config_t *cfg)
+{
+    uint32_t retired = cfg->completed;
+
+    if (cfg->completed == cfg->submitted)
+        return;
+
+    if (eu_get_events() & EU_REDMULE_DONE_MASK) {
+        eu_clear_events(EU_REDMULE_DONE_MASK);
+        cfg->completed++;
+    }
+
+    if ((HWPE_READ(REDMULE_STATUS) & REDMULE_STATUS_BUSY_MASK) == 0) {
+        cfg->completed = cfg->submitted;
+        eu_clear_events(EU_REDMULE_DONE_MASK);
+    }
+
+    /* One profiler end per retired job, matching the start of each of them */
+    for (; retired != cfg->completed; retired++)
+        prof_cmp_f();
+}
+
+/**
+ * @return Non-zero if the job has completed.
+ */
+static inline uint32_t redmule16_is_retired(redmule_config_t *cfg, redmule_job_t job)
+{
+    /* Job ids are 31-bit wide, compare them modulo 2^31 */
+    return ((int32_t)((cfg->completed - (uint32_t)job) << 1)) >= 0;
+}
+
 int redmule16_init(redmule_controller_t *ctrl)
 {
     irq_en(1 << IRQ_REDMULE_EVT_0);
@@ -77,10 +123,82 @@ int redmule16_gemm(redmule_controller_t *ctrl,
     redmule_mm_marith(
         y, w, x); // Launch GEMM with matrix addresses via memory-mapped HWPE registers
 #endif
+    ((redmule_config_t *)ctrl->cfg)->submitted++;
+
+    return 0;
+}
+
+/**
+ * Submit an FP16 GEMM without waiting for its completion, see redmule16_gemm.
+ * Over the memory-mapped interface the job slot is taken with the ACQUIRE register, so up to
+ * two jobs are queued in hardware and the next one starts without a core round-trip.
+ *
+ * @return Id of the submitted job.
+ */
+redmule_job_t redmule16_gemm_async(redmule_controller_t *ctrl,
+                                   uint32_t x,
+                                   uint32_t w,
+                                   uint32_t y,
+                                   uint16_t m,
+                                   uint16_t n,
+                                   uint16_t k)
+{
+    redmule_config_t *cfg = (redmule_config_t *)ctrl->cfg;
+
+    redmule16_retire(cfg);
+    while ((cfg->submitted - cfg->completed) >= REDMULE16_QUEUE_DEPTH) {
+        evt_read32(EU_CORE_EVENT_WAIT);
+        redmule16_retire(cfg);
+    }
+#if REDMULE_MM == 1
+    while (redmule16_acquire(ctrl) < 0)
+        redmule16_retire(cfg);
+#endif
+
+    redmule16_gemm(ctrl, x, w, y, m, n, k);
+    return (redmule_job_t)(cfg->submitted & 0x7FFFFFFF);
+}
+
+/**
+ * Wait for the completion of a job, sleeping on the event unit in between completion events.
+ *
+ * @param job Id returned by redmule16_gemm_async.
+ * @return 0 once the job has completed, 1 if the id is not valid.
+ */
+int redmule16_wait_job(redmule_controller_t *ctrl, redmule_job_t job)
+{
+    redmule_config_t *cfg = (redmule_config_t *)ctrl->cfg;
 
+    if (job < 0)
+        return 1;
+
+    redmule16_retire(cfg);
+    while (!redmule16_is_retired(cfg, job)) {
+        evt_read32(EU_CORE_EVENT_WAIT);
+        redmule16_retire(cfg);
+    }
     return 0;
 }
 
+/**
+ * Wait for the completion of the oldest job in flight. Jobs run in submission order, so this is
+ * the first one to complete.
+ *
+ * @return Id of the completed job, -1 if no job was in flight.
+ */
+redmule_job_t redmule16_wait_any(redmule_controller_t *ctrl)
+{
+    redmule_config_t *cfg = (redmule_config_t *)ctrl->cfg;
+    redmule_job_t job;
+
+    if (cfg->completed == cfg->submitted)
+        return -1;
+
+    job = (redmule_job_t)((cfg->completed + 1) & 0x7FFFFFFF);
+    redmule16_wait_job(ctrl, job);
+    return job;
+}
+
 extern int redmule_init(redmule_controller_t *ctrl)
     __attribute__((alias("redmule16_init"), used, visibility("default")));
 
@@ -96,9 +214,27 @@ extern int redmule_gemm(redmule_controller_t *ctrl,
                         uint16_t k)
     __attribute__((alias("redmule16_gemm"), used, visibility("default")));
 
+extern redmule_job_t redmule_gemm_async(redmule_controller_t *ctrl,
+                                        uint32_t x,
+                                        uint32_t w,
+                                        uint32_t y,
+                                        uint16_t m,
+                                        uint16_t n,
+                                        uint16_t k)
+    __attribute__((alias("redmule16_gemm_async"), used, visibility("default")));
+
+extern int redmule_wait_job(redmule_controller_t *ctrl, redmule_job_t job)
+    __attribute__((alias("redmule16_wait_job"), used, visibility("default")));
+
+extern redmule_job_t redmule_wait_any(redmule_controller_t *ctrl)
+    __attribute__((alias("redmule16_wait_any"), used, visibility("default")));
+
 /* Export the RedmulE-specific controller API */
 redmule_controller_api_t redmule_api = {
-    .init    = redmule16_init,
-    .acquire = redmule16_acquire,
-    .gemm    = redmule16_gemm,
+    .init       = redmule16_init,
+    .acquire    = redmule16_acquire,
+    .gemm       = redmule16_gemm,
+    .gemm_async = redmule16_gemm_async,
+    .wait_job   = redmule16_wait_job,
+    .wait_any   = redmule16_wait_any,
 };
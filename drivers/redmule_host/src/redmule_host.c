@@ -0,0 +1,151 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+//
+// This file provides the strong (driver-specific) implementations for the RedMulE functions on
+// the host functional model: the GEMM is computed by the calling thread, accumulating in single
+// precision, and has completed when the function returns. The `completed` counter of the
+// configuration tracks the jobs already waited for, so that redmule_wait_any still returns every
+// job once, oldest first.
+
+#include <stdint.h>
+#include "redmule_host.h"
+#include "regs/tile_ctrl.h"
+#include "utils/eu_isa_utils.h"
+#include "utils/magia_tile_utils.h"
+#include "utils/prof_utils.h"
+
+int redmule_host_init(redmule_controller_t *ctrl)
+{
+    return 0;
+}
+
+/**
+ * @return A job id, the job queue is never full.
+ */
+int32_t redmule_host_acquire(redmule_controller_t *ctrl)
+{
+    return (int32_t)((((redmule_config_t *)ctrl->cfg)->submitted + 1) & 0x7FFFFFFF);
+}
+
+/**
+ * FP16 GEMM on L1 matrices: Y = X * W + Y  where X is [M x N], W is [N x K], Y is [M x K].
+ *
+ * @return 0, the GEMM has completed.
+ */
+int redmule_host_gemm(redmule_controller_t *ctrl,
+                      uint32_t x,
+                      uint32_t w,
+                      uint32_t y,
+                      uint16_t m,
+                      uint16_t n,
+                      uint16_t k)
+{
+    redmule_config_t *cfg = (redmule_config_t *)ctrl->cfg;
+
+    prof_cmp_s();
+    for (uint32_t i = 0; i < m; i++) {
+        for (uint32_t j = 0; j < k; j++) {
+            float acc = (float)mmio_fp16(y + (i * k + j) * 2);
+            for (uint32_t l = 0; l < n; l++) {
+                float x_il = (float)mmio_fp16(x + (i * n + l) * 2);
+                acc += x_il * (float)mmio_fp16(w + (l * k + j) * 2);
+            }
+            mmio_fp16(y + (i * k + j) * 2) = (float16)acc;
+        }
+    }
+
+    cfg->submitted++;
+    eu_host_set_events(EU_REDMULE_DONE_MASK);
+    prof_cmp_f();
+    return 0;
+}
+
+/**
+ * Same as redmule_host_gemm.
+ *
+ * @return Id of the job.
+ */
+redmule_job_t redmule_host_gemm_async(redmule_controller_t *ctrl,
+                                      uint32_t x,
+                                      uint32_t w,
+                                      uint32_t y,
+                                      uint16_t m,
+                                      uint16_t n,
+                                      uint16_t k)
+{
+    redmule_host_gemm(ctrl, x, w, y, m, n, k);
+    return (redmule_job_t)(((redmule_config_t *)ctrl->cfg)->submitted & 0x7FFFFFFF);
+}
+
+/**
+ * @return 0, the job has completed, 1 if the id is not valid.
+ */
+int redmule_host_wait_job(redmule_controller_t *ctrl, redmule_job_t job)
+{
+    redmule_config_t *cfg = (redmule_config_t *)ctrl->cfg;
+
+    if (job < 0)
+        return 1;
+    /* Job ids are 31-bit wide, compare them modulo 2^31 */
+    if (((int32_t)((cfg->completed - (uint32_t)job) << 1)) < 0)
+        cfg->completed = (uint32_t)job;
+    eu_clear_events(EU_REDMULE_DONE_MASK);
+    return 0;
+}
+
+/**
+ * @return Id of the oldest job not waited for yet, -1 if there is none.
+ */
+redmule_job_t redmule_host_wait_any(redmule_controller_t *ctrl)
+{
+    redmule_config_t *cfg = (redmule_config_t *)ctrl->cfg;
+
+    if (cfg->completed == cfg->submitted)
+        return -1;
+    cfg->completed++;
+    eu_clear_events(EU_REDMULE_DONE_MASK);
+    return (redmule_job_t)(cfg->completed & 0x7FFFFFFF);
+}
+
+extern int redmule_init(redmule_controller_t *ctrl)
+    __attribute__((alias("redmule_host_init"), used, visibility("default")));
+
+extern int32_t redmule_acquire(redmule_controller_t *ctrl)
+    __attribute__((alias("redmule_host_acquire"), used, visibility("default")));
+
+extern int redmule_gemm(redmule_controller_t *ctrl,
+                        uint32_t x,
+                        uint32_t w,
+                        uint32_t y,
+                        uint16_t m,
+                        uint16_t n,
+                        uint16_t k)
+    __attribute__((alias("redmule_host_gemm"), used, visibility("default")));
+
+extern redmule_job_t redmule_gemm_async(redmule_controller_t *ctrl,
+                                        uint32_t x,
+                                        uint32_t w,
+                                        uint32_t y,
+                                        uint16_t m,
+                                        uint16_t n,
+                                        uint16_t k)
+    __attribute__((alias("redmule_host_gemm_async"), used, visibility("default")));
+
+extern int redmule_wait_job(redmule_controller_t *ctrl, redmule_job_t job)
+    __attribute__((alias("redmule_host_wait_job"), used, visibility("default")));
+
+extern redmule_job_t redmule_wait_any(redmule_controller_t *ctrl)
+    __attribute__((alias("redmule_host_wait_any"), used, visibility("default")));
+
+/* Export the RedmulE-specific controller API */
+redmule_controller_api_t redmule_api = {
+    .init       = redmule_host_init,
+    .acquire    = redmule_host_acquire,
+    .gemm       = redmule_host_gemm,
+    .gemm_async = redmule_host_gemm_async,
+    .wait_job   = redmule_host_wait_job,
+    .wait_any   = redmule_host_wait_any,
+};
@@ -0,0 +1,147 @@
+// Copyright 2025-2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+
+#ifndef HAL_COLLECTIVES_H
+#define HAL_COLLECTIVES_H
+
+#include <stdint.h>
+#include "idma.h"
+#include "fsync.h"
+#include "eventunit.h"
+
+/** Size in bytes of the elements combined by the reduction operators. */
+#ifndef COLL_ELEM_SIZE
+#define COLL_ELEM_SIZE (2)
+#endif
+
+/**
+ * Group of mesh-tiles taking part in a collective.
+ * Inside the group every tile has a rank: its column index for COLL_ROW, its row index for
+ * COLL_COL and its hartid for COLL_GLOBAL.
+ */
+typedef enum {
+    COLL_ROW = 0, // Tiles of the caller's mesh row
+    COLL_COL,     // Tiles of the caller's mesh column
+    COLL_GLOBAL,  // Entire mesh
+} coll_scope_t;
+
+/**
+ * Communication pattern of a collective.
+ * COLL_RING moves 1/N of the data per step over N-1 steps (2(N-1) for the all-reduce), which is
+ * the bandwidth-optimal choice for long vectors.
+ * COLL_RECDBL (recursive doubling) and COLL_TREE (binomial tree) take log2(N) steps, aligned to
+ * the FractalSync tree so that every step synchronizes the smallest possible group. The two only
+ * differ for the all-reduce and all-gather, where recursive doubling exchanges data in both
+ * directions instead of going through a root.
+ */
+typedef enum {
+    COLL_RING = 0,
+    COLL_RECDBL,
+    COLL_TREE,
+} coll_algo_t;
+
+/**
+ * Element-wise reduction operator: dst[i] = dst[i] op src[i] for `dim` elements of
+ * COLL_ELEM_SIZE bytes, both vectors in the local L1.
+ * Same signature as vect_sum and max_compare of the attention utils.
+ */
+typedef int (*coll_op_t)(uint32_t dst, uint32_t src, uint32_t dim);
+
+/**
+ * Collectives context, one per tile.
+ * Data is moved with iDMA L1-to-L1 copies, pushed from the L1 of the sender to the L1 of the
+ * receiver: every buffer (and the scratch area) must be at the same offset in the L1 of all the
+ * tiles of the group, and must be ready on all of them before the collective starts (e.g. after
+ * a barrier).
+ */
+typedef struct {
+    idma_controller_t *idma;   /**< iDMA controller, async transfers are used. */
+    fsync_controller_t *fsync; /**< FractalSync controller. */
+    eu_controller_t *eu;       /**< Event unit, fsync events enabled if STALLING == 0. */
+    coll_algo_t algo;          /**< Communication pattern. */
+    uint32_t scratch;          /**< L1 scratch area, see coll_scratch_size. */
+} coll_ctx_t;
+
+/**
+ * Number of tiles of the caller's group.
+ */
+extern uint32_t coll_size(coll_scope_t scope);
+
+/**
+ * Rank of the caller inside its group.
+ */
+extern uint32_t coll_rank(coll_scope_t scope);
+
+/**
+ * Hartid of the tile of the caller's group with the given rank.
+ */
+extern uint32_t coll_member(coll_scope_t scope, uint32_t rank);
+
+/**
+ * Size in bytes of the scratch area needed by coll_reduce and coll_allreduce on `len` bytes.
+ * Broadcast and all-gather do not use the scratch area.
+ */
+extern uint32_t coll_scratch_size(coll_algo_t algo, coll_scope_t scope, uint32_t len);
+
+/**
+ * Copies `len` bytes at `buf` from the tile of rank `root` to all the tiles of the group.
+ *
+ * @return 0 on success, 1 on invalid arguments.
+ */
+extern int
+coll_broadcast(coll_ctx_t *ctx, coll_scope_t scope, uint32_t root, uint32_t buf, uint32_t len);
+
+/**
+ * Combines the vectors at `buf` of all the tiles of the group with `op`, leaving the result in
+ * the `buf` of the tile of rank `root`. The buffers of the other tiles are clobbered.
+ *
+ * @return 0 on success, 1 on invalid arguments.
+ */
+extern int coll_reduce(coll_ctx_t *ctx,
+                       coll_scope_t scope,
+                       uint32_t root,
+                       uint32_t buf,
+                       uint32_t len,
+                       coll_op_t op);
+
+/**
+ * Combines the vectors at `buf` of all the tiles of the group with `op`, leaving the result in
+ * the `buf` of every tile.
+ *
+ * @return 0 on success, 1 on invalid arguments.
+ */
+extern int
+coll_allreduce(coll_ctx_t *ctx, coll_scope_t scope, uint32_t buf, uint32_t len, coll_op_t op);
+
+/**
+ * `buf` holds one block of `len` bytes per rank of the group, every tile provides the block of
+ * its own rank. On return every tile holds all the blocks.
+ *
+ * @return 0 on success, 1 on invalid arguments.
+ */
+extern int coll_allgather(coll_ctx_t *ctx, coll_scope_t scope, uint32_t buf, uint32_t len);
+
+/**
+ * Copies `len` bytes from `axi_addr` in L2 to `obi_addr` in the L1 of the `n_tiles` tiles listed
+ * in `tiles`, `obi_addr` being at the same offset in the L1 of all of them. Only the leader
+ * tiles[0] reads L2, the data then spreads over the group along a binary tree of L1-to-L1 copies,
+ * so the L2 traffic does not grow with the size of the group. Every tile of the list calls it
+ * with the same arguments, once its destination is free. The steps are separated by FractalSync
+ * barriers of the group: global ones if the group is the whole mesh, else built as fsync_sync
+ * does, which limits the group to 255 tiles. Concurrent multicasts over groups sharing a tree
+ * node need distinct `bid`.
+ *
+ * @return 0 on success, 1 if the caller is not in `tiles` or the group is too large.
+ */
+extern int idma_multicast(coll_ctx_t *ctx,
+                          const uint32_t *tiles,
+                          uint32_t n_tiles,
+                          uint8_t bid,
+                          uint32_t axi_addr,
+                          uint32_t obi_addr,
+                          uint32_t len);
+
+#endif
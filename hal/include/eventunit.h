@@ -27,12 +27,32 @@ struct eu_controller {
     void *cfg;                /**< Driver‑specific configuration. */
 };
 
+/**
+ * Engine completion events that can interrupt the core, see eu_irq_register.
+ */
+typedef enum {
+    EU_IRQ_A2O_DONE = 0, // iDMA L2->L1 (AXI2OBI) completion
+    EU_IRQ_O2A_DONE,     // iDMA L1->L2 (OBI2AXI) completion
+    EU_IRQ_REDMULE_DONE, // RedMulE completion
+    EU_IRQ_FSYNC_DONE,   // FSync completion
+    EU_IRQ_NUM,
+} eu_irq_event_t;
+
+/** Completion callback, called from the interrupt handler with interrupts disabled. */
+typedef void (*eu_irq_handler_t)(void *arg);
+
+typedef struct {
+    eu_irq_handler_t handler; /**< NULL if no callback is registered. */
+    void *arg;                /**< Passed to the handler. */
+} eu_irq_callback_t;
+
 /**
  * Event unit configuration structure.
  * This structure holds the configuration settings for event unit initialization.
  */
 typedef struct {
-    uint32_t hartid; /**< Mesh tile ID*/
+    uint32_t hartid;                   /**< Mesh tile ID*/
+    eu_irq_callback_t irq[EU_IRQ_NUM]; /**< Completion callbacks, see eu_irq_register. */
 } eu_config_t;
 
 /**
@@ -40,6 +60,51 @@ typedef struct {
  */
 extern void eu_init(eu_controller_t *ctrl);
 
+/**
+ * @brief Wait for the first of several events, e.g. EU_IDMA_A2O_DONE_MASK | EU_REDMULE_DONE_MASK
+ * @param event_mask Bitmask of events to wait for
+ * @param mode Wait mode (polling, WFE, etc.)
+ * @return Bitmask of the events that fired, which are consumed while the others stay pending;
+ * 0 if timeout/error
+ */
+extern uint32_t eu_wait_any(eu_controller_t *ctrl, uint32_t event_mask, eu_wait_mode_t mode);
+
+/**
+ * @brief Wait for all of several events, in whatever order they fire
+ * @param event_mask Bitmask of events to wait for
+ * @param mode Wait mode (polling, WFE, etc.)
+ * @return Non-zero if all the events fired, 0 if timeout/error
+ */
+extern uint32_t eu_wait_all(eu_controller_t *ctrl, uint32_t event_mask, eu_wait_mode_t mode);
+
+//=============================================================================
+// Interrupt-driven completion callbacks
+//=============================================================================
+
+/**
+ * @brief Call handler(arg) from the interrupt handler every time the event fires
+ * The callback may issue the next job of the engine right away, while the core keeps running
+ * the foreground code. The dispatcher consumes the event before calling the handler, so an
+ * event with a callback must not be waited for as well. The configuration of the controller
+ * holds the callbacks and must outlive them. The interrupts of the core are off until the first
+ * callback is registered, and the lines of the events without callbacks stay disabled.
+ * @param event Engine completion event
+ * @param handler Callback, NULL to unregister it
+ * @return 0 on success, 1 if the event is unknown
+ */
+extern int eu_irq_register(eu_controller_t *ctrl,
+                           eu_irq_event_t event,
+                           eu_irq_handler_t handler,
+                           void *arg);
+
+/**
+ * @brief Remove the callback of the event and disable its interrupt line
+ * The event is dropped if it is still pending; the later ones are left in the event buffer for
+ * the waits again. The interrupts of the core are turned off with the last callback.
+ * @return 0 on success, 1 if the event is unknown
+ */
+extern int eu_irq_unregister(eu_controller_t *ctrl, eu_irq_event_t event);
+
 //=============================================================================
 // RedMulE-specific Event Functions
 //=============================================================================
@@ -214,6 +279,13 @@ extern uint32_t eu_spatz_is_done(eu_controller_t *ctrl);
 
 struct eu_controller_api {
     void (*init)(eu_controller_t *ctrl);
+    uint32_t (*wait_any)(eu_controller_t *ctrl, uint32_t event_mask, eu_wait_mode_t mode);
+    uint32_t (*wait_all)(eu_controller_t *ctrl, uint32_t event_mask, eu_wait_mode_t mode);
+    int (*irq_register)(eu_controller_t *ctrl,
+                        eu_irq_event_t event,
+                        eu_irq_handler_t handler,
+                        void *arg);
+    int (*irq_unregister)(eu_controller_t *ctrl, eu_irq_event_t event);
     void (*redmule_init)(eu_controller_t *ctrl, uint32_t enable_irq);
     uint32_t (*redmule_wait)(eu_controller_t *ctrl, eu_wait_mode_t mode);
     uint32_t (*redmule_is_busy)(eu_controller_t *ctrl);
@@ -31,6 +31,23 @@ typedef struct {
     uint32_t hartid;    /**< Mesh tile ID*/
 } fsync_config_t;
 
+/**
+ * Precompiled barrier of the current tile with an arbitrary subset of tiles.
+ * Holds the operands of the fsync instruction, computed once by fsync_barrier_create.
+ */
+typedef struct {
+    uint32_t id;        /**< Barrier ID of the fsync instruction. */
+    uint32_t aggregate; /**< Fsync tree levels to cross, 0 if there is no tile to wait for. */
+} fsync_barrier_t;
+
+/**
+ * Split-phase barrier handle, returned by the fsync_arrive_* functions and consumed by fsync_wait.
+ */
+typedef uint32_t fsync_token_t;
+
+#define FSYNC_TOKEN_NONE    (0) /**< No tile to wait for, fsync_wait returns immediately. */
+#define FSYNC_TOKEN_PENDING (1) /**< Barrier issued, its completion has not been consumed yet. */
+
 /**
  * Opens and initializes the fsync interface.
  */
@@ -66,6 +83,55 @@ extern int fsync_sync_diag(fsync_controller_t *ctrl);
  */
 extern int fsync_sync(fsync_controller_t *ctrl, uint32_t *ids, uint8_t n_tiles, uint8_t dir, uint8_t bid);
 
+/**
+ * Precomputes the barrier of fsync_sync(ids, n_tiles, dir, bid) for the current tile.
+ */
+extern fsync_barrier_t fsync_barrier_create(
+    fsync_controller_t *ctrl, const uint32_t *ids, uint8_t n_tiles, uint8_t dir, uint8_t bid);
+
+/**
+ * Synchronizes on a barrier built by fsync_barrier_create.
+ */
+extern int fsync_barrier_wait(fsync_controller_t *ctrl, fsync_barrier_t *barrier);
+
+/**
+ * Split-phase barriers: the tile announces its arrival without waiting for the others, does
+ * independent work, then blocks in fsync_wait until the barrier opens.
+ * At most one barrier per tile may be in flight, fsync_wait it before arriving on the next one.
+ * In interrupt mode fsync_wait consumes the fsync event in place of eu_fsync_wait, so it needs
+ * eu_fsync_init.
+ */
+
+/**
+ * Arrives on the barrier of fsync_sync_level(level, dir).
+ */
+extern fsync_token_t fsync_arrive_level(fsync_controller_t *ctrl, uint32_t level, uint8_t dir);
+
+/**
+ * Arrives on the barrier of fsync_sync_row.
+ */
+extern fsync_token_t fsync_arrive_row(fsync_controller_t *ctrl);
+
+/**
+ * Arrives on the barrier of fsync_sync_col.
+ */
+extern fsync_token_t fsync_arrive_col(fsync_controller_t *ctrl);
+
+/**
+ * Arrives on the barrier of fsync_sync_global.
+ */
+extern fsync_token_t fsync_arrive_global(fsync_controller_t *ctrl);
+
+/**
+ * Arrives on a barrier built by fsync_barrier_create.
+ */
+extern fsync_token_t fsync_arrive(fsync_controller_t *ctrl, fsync_barrier_t *barrier);
+
+/**
+ * Waits for the barrier of an fsync_arrive_* call to open.
+ */
+extern int fsync_wait(fsync_controller_t *ctrl, fsync_token_t token);
+
 /**
  * Synchronizes with the tile on the left.
  */
@@ -109,6 +175,15 @@ struct fsync_controller_api {
     int (*sync_col)(fsync_controller_t *ctrl);
     int (*sync_diag)(fsync_controller_t *ctrl);
     int (*sync)(fsync_controller_t *ctrl, uint32_t *ids, uint8_t n_tiles, uint8_t dir, uint8_t bid);
+    fsync_barrier_t (*barrier_create)(
+        fsync_controller_t *ctrl, const uint32_t *ids, uint8_t n_tiles, uint8_t dir, uint8_t bid);
+    int (*barrier_wait)(fsync_controller_t *ctrl, fsync_barrier_t *barrier);
+    fsync_token_t (*arrive_level)(fsync_controller_t *ctrl, uint32_t level, uint8_t dir);
+    fsync_token_t (*arrive_row)(fsync_controller_t *ctrl);
+    fsync_token_t (*arrive_col)(fsync_controller_t *ctrl);
+    fsync_token_t (*arrive_global)(fsync_controller_t *ctrl);
+    fsync_token_t (*arrive)(fsync_controller_t *ctrl, fsync_barrier_t *barrier);
+    int (*wait)(fsync_controller_t *ctrl, fsync_token_t token);
     int (*sync_left)(fsync_controller_t *ctrl);
     int (*sync_right)(fsync_controller_t *ctrl);
     int (*sync_up)(fsync_controller_t *ctrl);
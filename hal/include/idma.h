@@ -22,12 +22,72 @@ struct idma_controller {
     void *cfg;                  /**< Driver‑specific configuration. */
 };
 
+/** Maximum number of asynchronous transfers in flight per direction. */
+#ifndef IDMA_QUEUE_DEPTH
+#define IDMA_QUEUE_DEPTH (4)
+#endif
+
+/**
+ * Handle of an asynchronous transfer.
+ * Bit 31 holds the copy direction, bits 30:0 the sequence number of the transfer.
+ */
+typedef uint32_t idma_handle_t;
+
+#define IDMA_HANDLE_DIR(handle) (((handle) >> 31) & 0x1)
+#define IDMA_HANDLE_SEQ(handle) ((handle) & 0x7FFFFFFF)
+
+/**
+ * Reserved handle, never given to an issued transfer: "no transfer". Returned by idma_memcpy_nd
+ * for an invalid descriptor; idma_wait and idma_test on it return at once.
+ */
+#define IDMA_HANDLE_NONE (0)
+
+/**
+ * Per-direction queue of in-flight transfers.
+ * Every transfer issued on a direction takes the next sequence number, and transfers retire
+ * in issue order as their completion events are counted.
+ */
+typedef struct {
+    uint32_t issued;    /**< Sequence number of the last issued transfer. */
+    uint32_t completed; /**< Sequence number of the last retired transfer. */
+} idma_queue_t;
+
+/** Maximum number of strided dimensions of an N-dimensional transfer descriptor. */
+#ifndef IDMA_MAX_DIMS
+#define IDMA_MAX_DIMS (4)
+#endif
+
+/**
+ * Strided dimension of an N-dimensional transfer.
+ */
+typedef struct {
+    uint32_t axi_std; /**< Stride in bytes between repetitions on the AXI (L2) side. */
+    uint32_t obi_std; /**< Stride in bytes between repetitions on the OBI (L1) side. */
+    uint32_t reps;    /**< Number of repetitions. */
+} idma_dim_t;
+
+/**
+ * N-dimensional transfer descriptor.
+ * A contiguous block of `len` bytes is repeated along `ndims` strided dimensions, innermost
+ * first. Up to two strided dimensions are handled by the iDMA backend in a single job, outer
+ * dimensions are unrolled by the driver into one job per plane.
+ */
+typedef struct {
+    uint8_t dir;                    /**< 0 = AXI to OBI (L2 to L1), !0 = OBI to AXI (L1 to L2). */
+    uint32_t axi_addr;              /**< AXI (L2) memory address of first element. */
+    uint32_t obi_addr;              /**< OBI (L1) memory address of first element. */
+    uint32_t len;                   /**< Byte length of the contiguous innermost block. */
+    uint32_t ndims;                 /**< Number of strided dimensions, at most IDMA_MAX_DIMS. */
+    idma_dim_t dims[IDMA_MAX_DIMS]; /**< Strided dimensions, innermost first. */
+} idma_nd_desc_t;
+
 /**
  * IDMA configuration structure.
  * This structure holds the configuration settings for IDMA initialization.
  */
 typedef struct {
-    uint32_t hartid; /**< Mesh tile ID*/
+    uint32_t hartid;       /**< Mesh tile ID*/
+    idma_queue_t queue[2]; /**< In-flight transfers, 0 = AXI to OBI, 1 = OBI to AXI. */
 } idma_config_t;
 
 /**
@@ -35,10 +95,6 @@ typedef struct {
  */
 extern int idma_init(idma_controller_t *ctrl);
 
-/**
- * Waits for the IDMA IRQ_DONE.
- */
-/* extern void idma_wait(); */
 
 /**
  * Start 1-dimensional memory copy.
@@ -71,13 +127,99 @@ extern int idma_memcpy_2d(idma_controller_t *ctrl,
                           uint32_t std,
                           uint32_t reps);
 
+/**
+ * Start 3-dimensional memory copy.
+ * Copies `reps_3` planes of `reps_2` blocks of `len` bytes each. On the strided side (source for
+ * L2->L1, dest for L1->L2) blocks start `std_2` bytes apart and planes `std_3` bytes apart, while
+ * the L1 side is densely packed. The caller must wait for completion (e.g. via eu_idma_wait).
+ *
+ * @param ctrl  IDMA controller handle.
+ * @param dir   Copy direction. 0 = AXI to OBI (L2 to L1), !0 = OBI to AXI (L1 to L2).
+ * @param axi_addr AXI (L2) memory address of first element.
+ * @param obi_addr OBI (L1) memory address of first element.
+ * @param len   Byte length of each row to transfer.
+ * @param std_2 Stride in bytes between row starts in the strided side.
+ * @param reps_2 Number of rows per plane.
+ * @param std_3 Stride in bytes between plane starts in the strided side.
+ * @param reps_3 Number of planes.
+ *
+ * @return 0 on successful dispatch.
+ */
+extern int idma_memcpy_3d(idma_controller_t *ctrl,
+                          uint8_t dir,
+                          uint32_t axi_addr,
+                          uint32_t obi_addr,
+                          uint32_t len,
+                          uint32_t std_2,
+                          uint32_t reps_2,
+                          uint32_t std_3,
+                          uint32_t reps_3);
+
+/**
+ * Start N-dimensional memory copy described by `desc`.
+ * Descriptors with more than two strided dimensions are issued as several jobs, blocking only
+ * if the direction queue is full.
+ *
+ * @return Handle of the last issued job, to pass to idma_wait or idma_test, IDMA_HANDLE_NONE if
+ * the descriptor has more than IDMA_MAX_DIMS dimensions and nothing was issued.
+ */
+extern idma_handle_t idma_memcpy_nd(idma_controller_t *ctrl, const idma_nd_desc_t *desc);
+
+/**
+ * Enqueue a 1-dimensional memory copy without waiting for its completion.
+ * Blocks only if IDMA_QUEUE_DEPTH transfers are already in flight on the same direction.
+ *
+ * @param ctrl  IDMA controller handle.
+ * @param dir   Copy direction. 0 = AXI to OBI (L2 to L1), !0 = OBI to AXI (L1 to L2).
+ * @param axi_addr AXI (L2) memory address of first element.
+ * @param obi_addr OBI (L1) memory address of first element.
+ * @param len   Byte length of memory block to transfer.
+ *
+ * @return Handle to pass to idma_wait or idma_test.
+ */
+extern idma_handle_t idma_memcpy_1d_async(
+    idma_controller_t *ctrl, uint8_t dir, uint32_t axi_addr, uint32_t obi_addr, uint32_t len);
+
+/**
+ * Enqueue a 2-dimensional memory copy without waiting for its completion.
+ * Same arguments as idma_memcpy_2d.
+ *
+ * @return Handle to pass to idma_wait or idma_test.
+ */
+extern idma_handle_t idma_memcpy_2d_async(idma_controller_t *ctrl,
+                                          uint8_t dir,
+                                          uint32_t axi_addr,
+                                          uint32_t obi_addr,
+                                          uint32_t len,
+                                          uint32_t std,
+                                          uint32_t reps);
+
+/**
+ * Block until the transfer identified by `handle` (and every transfer issued before it on the
+ * same direction) has completed.
+ * The iDMA events must be enabled in the event unit (eu_idma_init) when STALLING == 0, and the
+ * eu_idma_wait_* functions should not be used on a direction with asynchronous transfers in
+ * flight, as they consume the completion events counted here.
+ *
+ * @return 0 once the transfer has completed.
+ */
+extern int idma_wait(idma_controller_t *ctrl, idma_handle_t handle);
+
+/**
+ * Non-blocking completion check of the transfer identified by `handle`.
+ *
+ * @return 1 if the transfer has completed, 0 otherwise.
+ */
+extern int idma_test(idma_controller_t *ctrl, idma_handle_t handle);
+
 /**
  * WIP
  * IDMA API
  */
 struct idma_controller_api {
     int (*init)(idma_controller_t *ctrl);
-    /*     void (*wait)(); */
+    int (*wait)(idma_controller_t *ctrl, idma_handle_t handle);
+    int (*test)(idma_controller_t *ctrl, idma_handle_t handle);
     int (*memcpy_1d)(idma_controller_t *ctrl,
                      uint8_t dir,
                      uint32_t axi_addr,
@@ -91,6 +233,32 @@ struct idma_controller_api {
                      uint32_t len,
                      uint32_t std,
                      uint32_t reps);
+
+    int (*memcpy_3d)(idma_controller_t *ctrl,
+                     uint8_t dir,
+                     uint32_t axi_addr,
+                     uint32_t obi_addr,
+                     uint32_t len,
+                     uint32_t std_2,
+                     uint32_t reps_2,
+                     uint32_t std_3,
+                     uint32_t reps_3);
+
+    idma_handle_t (*memcpy_nd)(idma_controller_t *ctrl, const idma_nd_desc_t *desc);
+
+    idma_handle_t (*memcpy_1d_async)(idma_controller_t *ctrl,
+                                     uint8_t dir,
+                                     uint32_t axi_addr,
+                                     uint32_t obi_addr,
+                                     uint32_t len);
+
+    idma_handle_t (*memcpy_2d_async)(idma_controller_t *ctrl,
+                                     uint8_t dir,
+                                     uint32_t axi_addr,
+                                     uint32_t obi_addr,
+                                     uint32_t len,
+                                     uint32_t std,
+                                     uint32_t reps);
 };
 
 /*
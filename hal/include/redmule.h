@@ -30,9 +30,18 @@ struct redmule_controller {
  * This structure holds the configuration settings for Redmule initialization.
  */
 typedef struct {
-    uint32_t hartid; /**< Mesh Tile ID. */
+    uint32_t hartid;    /**< Mesh Tile ID. */
+    uint32_t submitted; /**< Id of the last submitted job. */
+    uint32_t completed; /**< Id of the last completed job. */
 } redmule_config_t;
 
+/**
+ * Id of a submitted RedMulE job, -1 if no job.
+ * Ids are assigned by the driver in submission order, so they keep growing across the
+ * wrap-around of the hardware job ids.
+ */
+typedef int32_t redmule_job_t;
+
 extern int redmule_init(redmule_controller_t *ctrl);
 
 /* extern void redmule_wait(); */
@@ -56,6 +65,36 @@ extern int redmule_gemm(redmule_controller_t *ctrl,
                         uint16_t n,
                         uint16_t k);
 
+/**
+ * Submit a GEMM to the RedMulE job queue without waiting for its completion.
+ * Same operands as redmule_gemm. Blocks only while the hardware job queue (depth 2 over the
+ * memory-mapped interface, 1 with the custom instructions) is full.
+ *
+ * @return Id of the submitted job.
+ */
+extern redmule_job_t redmule_gemm_async(redmule_controller_t *ctrl,
+                                        uint32_t x,
+                                        uint32_t w,
+                                        uint32_t y,
+                                        uint16_t m,
+                                        uint16_t n,
+                                        uint16_t k);
+
+/**
+ * Block until the job `job` (and every job submitted before it) has completed.
+ * The RedMulE events must be enabled in the event unit (eu_redmule_init) when STALLING == 0.
+ *
+ * @return 0 once the job has completed.
+ */
+extern int redmule_wait_job(redmule_controller_t *ctrl, redmule_job_t job);
+
+/**
+ * Block until any of the jobs in flight completes.
+ *
+ * @return Id of the completed job, -1 if no job was in flight.
+ */
+extern redmule_job_t redmule_wait_any(redmule_controller_t *ctrl);
+
 /**
  * WIP
  * Redmule API
@@ -71,6 +110,15 @@ struct redmule_controller_api {
                 uint16_t m,
                 uint16_t n,
                 uint16_t k);
+    redmule_job_t (*gemm_async)(redmule_controller_t *ctrl,
+                                uint32_t x,
+                                uint32_t w,
+                                uint32_t y,
+                                uint16_t m,
+                                uint16_t n,
+                                uint16_t k);
+    int (*wait_job)(redmule_controller_t *ctrl, redmule_job_t job);
+    redmule_job_t (*wait_any)(redmule_controller_t *ctrl);
 };
 
 /*
@@ -0,0 +1,487 @@
+// Copyright 2025-2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+//
+// Generic implementation of the mesh collectives on top of the iDMA, FractalSync and event unit
+// APIs.
+//
+// Tree-shaped algorithms work on "tree ranks": in a row or a column these are the plain ranks,
+// on the whole mesh they interleave the x (even bits) and y (odd bits) coordinates, following the
+// horizontal FractalSync tree. Tiles whose tree ranks differ only in bit `s` then belong to the
+// same level-`s` group, so step `s` of a recursive-doubling or binomial-tree collective only
+// waits on that group.
+
+#include <stdint.h>
+#include "tile.h"
+#include "collectives.h"
+
+#define COLL_WAIT_MODE WFE
+
+static inline uint32_t coll_log2(uint32_t n)
+{
+    return 31 - __builtin_clz(n);
+}
+
+uint32_t coll_size(coll_scope_t scope)
+{
+    if (scope == COLL_ROW)
+        return MESH_X_TILES;
+    else if (scope == COLL_COL)
+        return MESH_Y_TILES;
+    return NUM_HARTS;
+}
+
+uint32_t coll_rank(coll_scope_t scope)
+{
+    uint32_t hartid = get_hartid();
+    if (scope == COLL_ROW)
+        return GET_X_ID(hartid);
+    else if (scope == COLL_COL)
+        return GET_Y_ID(hartid);
+    return hartid;
+}
+
+uint32_t coll_member(coll_scope_t scope, uint32_t rank)
+{
+    uint32_t hartid = get_hartid();
+    if (scope == COLL_ROW)
+        return GET_ID(GET_Y_ID(hartid), rank);
+    else if (scope == COLL_COL)
+        return GET_ID(rank, GET_X_ID(hartid));
+    return rank;
+}
+
+uint32_t coll_scratch_size(coll_algo_t algo, coll_scope_t scope, uint32_t len)
+{
+    uint32_t n = coll_size(scope);
+    if (n == 1)
+        return 0;
+    if (algo == COLL_RING) {
+        uint32_t dim = len / COLL_ELEM_SIZE;
+        return (n - 1) * ((dim + n - 1) / n) * COLL_ELEM_SIZE;
+    }
+    return coll_log2(n) * len;
+}
+
+/*-----------------------------------------------------------------*/
+/* Helpers                                                         */
+/*-----------------------------------------------------------------*/
+
+/**
+ * Tree rank of the tile with the given rank.
+ */
+static uint32_t coll_tree_rank(coll_scope_t scope, uint32_t rank)
+{
+    if (scope != COLL_GLOBAL)
+        return rank;
+    uint32_t x     = GET_X_ID(rank);
+    uint32_t y     = GET_Y_ID(rank);
+    uint32_t trank = 0;
+    for (uint32_t i = 0; i < MESH_2_POWER; i++)
+        trank |= (((x >> i) & 0x1) << (2 * i)) | (((y >> i) & 0x1) << ((2 * i) + 1));
+    return trank;
+}
+
+/**
+ * Hartid of the tile of the caller's group with the given tree rank.
+ */
+static uint32_t coll_tree_member(coll_scope_t scope, uint32_t trank)
+{
+    if (scope != COLL_GLOBAL)
+        return coll_member(scope, trank);
+    uint32_t x = 0;
+    uint32_t y = 0;
+    for (uint32_t i = 0; i < MESH_2_POWER; i++) {
+        x |= ((trank >> (2 * i)) & 0x1) << i;
+        y |= ((trank >> ((2 * i) + 1)) & 0x1) << i;
+    }
+    return GET_ID(y, x);
+}
+
+/**
+ * Address of the local L1 address `addr` in the L1 of tile `hartid`.
+ */
+static inline uint32_t coll_remote(uint32_t hartid, uint32_t addr)
+{
+    return get_l1_base(hartid) + (addr - get_l1_base(get_hartid()));
+}
+
+/**
+ * Pushes `len` bytes from the local L1 to the same-offset address `dst` in the L1 of `hartid`.
+ */
+static inline idma_handle_t
+coll_put(coll_ctx_t *ctx, uint32_t hartid, uint32_t dst, uint32_t src, uint32_t len)
+{
+    return idma_memcpy_1d_async(ctx->idma, 1, coll_remote(hartid, dst), src, len);
+}
+
+static inline void coll_fsync_wait(coll_ctx_t *ctx)
+{
+#if STALLING == 0
+    eu_fsync_wait(ctx->eu, COLL_WAIT_MODE);
+#endif
+}
+
+/**
+ * Synchronizes the whole group.
+ */
+static void coll_barrier(coll_ctx_t *ctx, coll_scope_t scope)
+{
+    if (scope == COLL_ROW)
+        fsync_sync_row(ctx->fsync);
+    else if (scope == COLL_COL)
+        fsync_sync_col(ctx->fsync);
+    else
+        fsync_sync_global(ctx->fsync);
+    coll_fsync_wait(ctx);
+}
+
+/**
+ * Synchronizes the tiles whose tree ranks differ only in bit `step`, together with the
+ * lower ones. Rows and columns only have an exact FractalSync group for the first step, the
+ * others fall back to the row or column barrier.
+ */
+static void coll_step_barrier(coll_ctx_t *ctx, coll_scope_t scope, uint32_t step)
+{
+    if (scope == COLL_GLOBAL)
+        fsync_sync_level(ctx->fsync, step, 0);
+    else if (step == 0)
+        fsync_sync_level(ctx->fsync, 0, (scope == COLL_COL));
+    else {
+        coll_barrier(ctx, scope);
+        return;
+    }
+    coll_fsync_wait(ctx);
+}
+
+/**
+ * Byte offset and length of chunk `c` when `len` bytes are split in `n` element-aligned chunks.
+ */
+static inline uint32_t coll_chunk_off(uint32_t len, uint32_t n, uint32_t c)
+{
+    return ((c * (len / COLL_ELEM_SIZE)) / n) * COLL_ELEM_SIZE;
+}
+
+static inline uint32_t coll_chunk_len(uint32_t len, uint32_t n, uint32_t c)
+{
+    return coll_chunk_off(len, n, c + 1) - coll_chunk_off(len, n, c);
+}
+
+/*-----------------------------------------------------------------*/
+/* Ring                                                            */
+/*-----------------------------------------------------------------*/
+
+/**
+ * Ring reduce-scatter: on return the tile of rank r holds chunk (r + 1) % n fully reduced.
+ */
+static void coll_ring_reduce_scatter(
+    coll_ctx_t *ctx, coll_scope_t scope, uint32_t buf, uint32_t len, coll_op_t op)
+{
+    uint32_t n    = coll_size(scope);
+    uint32_t rank = coll_rank(scope);
+    uint32_t next = coll_member(scope, (rank + 1) % n);
+    uint32_t slot = ((len / COLL_ELEM_SIZE) + n - 1) / n * COLL_ELEM_SIZE;
+
+    for (uint32_t s = 0; s < n - 1; s++) {
+        uint32_t c = (rank + n - s) % n;
+        if (coll_chunk_len(len, n, c))
+            idma_wait(ctx->idma,
+                      coll_put(ctx,
+                               next,
+                               ctx->scratch + (s * slot),
+                               buf + coll_chunk_off(len, n, c),
+                               coll_chunk_len(len, n, c)));
+        coll_barrier(ctx, scope);
+        c = (rank + n - s - 1) % n;
+        if (coll_chunk_len(len, n, c))
+            op(buf + coll_chunk_off(len, n, c),
+               ctx->scratch + (s * slot),
+               coll_chunk_len(len, n, c) / COLL_ELEM_SIZE);
+    }
+}
+
+/**
+ * Ring all-gather of `len` bytes split in n chunks, the tile of rank r starting with chunk
+ * (r + first) % n.
+ */
+static void
+coll_ring_allgather(coll_ctx_t *ctx, coll_scope_t scope, uint32_t buf, uint32_t len, uint32_t first)
+{
+    uint32_t n    = coll_size(scope);
+    uint32_t rank = coll_rank(scope);
+    uint32_t next = coll_member(scope, (rank + 1) % n);
+
+    for (uint32_t s = 0; s < n - 1; s++) {
+        uint32_t c   = (rank + first + n - s) % n;
+        uint32_t off = coll_chunk_off(len, n, c);
+        if (coll_chunk_len(len, n, c))
+            idma_wait(ctx->idma,
+                      coll_put(ctx, next, buf + off, buf + off, coll_chunk_len(len, n, c)));
+        coll_barrier(ctx, scope);
+    }
+}
+
+/*-----------------------------------------------------------------*/
+/* Binomial tree and recursive doubling                            */
+/*-----------------------------------------------------------------*/
+
+static void
+coll_tree_broadcast(coll_ctx_t *ctx, coll_scope_t scope, uint32_t troot, uint32_t buf, uint32_t len)
+{
+    uint32_t steps = coll_log2(coll_size(scope));
+    uint32_t trank = coll_tree_rank(scope, coll_rank(scope));
+    uint32_t rel   = trank ^ troot;
+
+    for (int32_t s = steps - 1; s >= 0; s--) {
+        uint32_t bit  = 1 << s;
+        uint32_t peer = coll_tree_member(scope, trank ^ bit);
+        if ((rel & ((bit << 1) - 1)) == 0)
+            idma_wait(ctx->idma, coll_put(ctx, peer, buf, buf, len));
+        coll_step_barrier(ctx, scope, s);
+    }
+}
+
+static void coll_tree_reduce(
+    coll_ctx_t *ctx, coll_scope_t scope, uint32_t troot, uint32_t buf, uint32_t len, coll_op_t op)
+{
+    uint32_t steps = coll_log2(coll_size(scope));
+    uint32_t trank = coll_tree_rank(scope, coll_rank(scope));
+    uint32_t rel   = trank ^ troot;
+
+    for (uint32_t s = 0; s < steps; s++) {
+        uint32_t bit  = 1 << s;
+        uint32_t slot = ctx->scratch + (s * len);
+        if ((rel & ((bit << 1) - 1)) == bit)
+            idma_wait(ctx->idma,
+                      coll_put(ctx, coll_tree_member(scope, trank ^ bit), slot, buf, len));
+        coll_step_barrier(ctx, scope, s);
+        if ((rel & ((bit << 1) - 1)) == 0)
+            op(buf, slot, len / COLL_ELEM_SIZE);
+    }
+}
+
+static void
+coll_recdbl_allreduce(coll_ctx_t *ctx, coll_scope_t scope, uint32_t buf, uint32_t len, coll_op_t op)
+{
+    uint32_t steps = coll_log2(coll_size(scope));
+    uint32_t trank = coll_tree_rank(scope, coll_rank(scope));
+
+    for (uint32_t s = 0; s < steps; s++) {
+        uint32_t peer = coll_tree_member(scope, trank ^ (1 << s));
+        uint32_t slot = ctx->scratch + (s * len);
+        idma_wait(ctx->idma, coll_put(ctx, peer, slot, buf, len));
+        coll_step_barrier(ctx, scope, s);
+        op(buf, slot, len / COLL_ELEM_SIZE);
+    }
+}
+
+/**
+ * Recursive-doubling all-gather. Before step `s` a tile holds the blocks of the tree ranks
+ * sharing its bits above `s`: a contiguous range in a row or a column, a rectangle of
+ * 2^((s+1)/2) x 2^(s/2) tiles on the whole mesh, copied one mesh row at a time.
+ */
+static void
+coll_recdbl_allgather(coll_ctx_t *ctx, coll_scope_t scope, uint32_t buf, uint32_t len)
+{
+    uint32_t hartid = get_hartid();
+    uint32_t steps  = coll_log2(coll_size(scope));
+    uint32_t rank   = coll_rank(scope);
+    uint32_t trank  = coll_tree_rank(scope, rank);
+
+    for (uint32_t s = 0; s < steps; s++) {
+        uint32_t peer = coll_tree_member(scope, trank ^ (1 << s));
+        idma_handle_t last;
+        if (scope != COLL_GLOBAL) {
+            uint32_t off = ((rank >> s) << s) * len;
+            last         = coll_put(ctx, peer, buf + off, buf + off, len << s);
+        } else {
+            uint32_t w  = 1 << ((s + 1) / 2);
+            uint32_t h  = 1 << (s / 2);
+            uint32_t x0 = GET_X_ID(hartid) & ~(w - 1);
+            uint32_t y0 = GET_Y_ID(hartid) & ~(h - 1);
+            for (uint32_t y = y0; y < y0 + h; y++) {
+                uint32_t off = GET_ID(y, x0) * len;
+                last         = coll_put(ctx, peer, buf + off, buf + off, w * len);
+            }
+        }
+        idma_wait(ctx->idma, last);
+        coll_step_barrier(ctx, scope, s);
+    }
+}
+
+/*-----------------------------------------------------------------*/
+/* Collectives                                                     */
+/*-----------------------------------------------------------------*/
+
+static int coll_check(coll_ctx_t *ctx, coll_scope_t scope, uint32_t root, uint32_t len)
+{
+    if (scope > COLL_GLOBAL || ctx->algo > COLL_TREE) {
+        printf("Error: invalid collective scope (%d) or algorithm (%d).\n", scope, ctx->algo);
+        return 1;
+    }
+    if (root >= coll_size(scope)) {
+        printf("Error: collective root %d is out of the group of %d tiles.\n",
+               root,
+               coll_size(scope));
+        return 1;
+    }
+    if (len % COLL_ELEM_SIZE) {
+        printf("Error: collective length must be a multiple of %d bytes.\n", COLL_ELEM_SIZE);
+        return 1;
+    }
+    return 0;
+}
+
+int coll_broadcast(coll_ctx_t *ctx, coll_scope_t scope, uint32_t root, uint32_t buf, uint32_t len)
+{
+    if (coll_check(ctx, scope, root, len))
+        return 1;
+    uint32_t n = coll_size(scope);
+    if (n == 1)
+        return 0;
+
+    if (ctx->algo == COLL_RING) {
+        /* Scatter the chunks from the root, then gather them around the ring */
+        if (coll_rank(scope) == root) {
+            idma_handle_t last = IDMA_HANDLE_NONE;
+            uint32_t pending   = 0;
+            for (uint32_t c = 0; c < n; c++) {
+                if (c == root || coll_chunk_len(len, n, c) == 0)
+                    continue;
+                uint32_t off = coll_chunk_off(len, n, c);
+                last         = coll_put(
+                    ctx, coll_member(scope, c), buf + off, buf + off, coll_chunk_len(len, n, c));
+                pending = 1;
+            }
+            if (pending)
+                idma_wait(ctx->idma, last);
+        }
+        coll_barrier(ctx, scope);
+        coll_ring_allgather(ctx, scope, buf, len, 0);
+    } else {
+        coll_tree_broadcast(ctx, scope, coll_tree_rank(scope, root), buf, len);
+    }
+    return 0;
+}
+
+int coll_reduce(coll_ctx_t *ctx,
+                coll_scope_t scope,
+                uint32_t root,
+                uint32_t buf,
+                uint32_t len,
+                coll_op_t op)
+{
+    if (coll_check(ctx, scope, root, len))
+        return 1;
+    uint32_t n = coll_size(scope);
+    if (n == 1)
+        return 0;
+
+    if (ctx->algo == COLL_RING) {
+        /* Reduce-scatter, then every tile sends its reduced chunk to the root */
+        uint32_t rank = coll_rank(scope);
+        uint32_t c    = (rank + 1) % n;
+        coll_ring_reduce_scatter(ctx, scope, buf, len, op);
+        if (rank != root && coll_chunk_len(len, n, c))
+            idma_wait(ctx->idma,
+                      coll_put(ctx,
+                               coll_member(scope, root),
+                               buf + coll_chunk_off(len, n, c),
+                               buf + coll_chunk_off(len, n, c),
+                               coll_chunk_len(len, n, c)));
+        coll_barrier(ctx, scope);
+    } else {
+        coll_tree_reduce(ctx, scope, coll_tree_rank(scope, root), buf, len, op);
+        /* The root is still reading the scratch area after the last step */
+        coll_barrier(ctx, scope);
+    }
+    return 0;
+}
+
+int coll_allreduce(coll_ctx_t *ctx, coll_scope_t scope, uint32_t buf, uint32_t len, coll_op_t op)
+{
+    if (coll_check(ctx, scope, 0, len))
+        return 1;
+    if (coll_size(scope) == 1)
+        return 0;
+
+    if (ctx->algo == COLL_RING) {
+        coll_ring_reduce_scatter(ctx, scope, buf, len, op);
+        coll_ring_allgather(ctx, scope, buf, len, 1);
+    } else if (ctx->algo == COLL_RECDBL) {
+        coll_recdbl_allreduce(ctx, scope, buf, len, op);
+        coll_barrier(ctx, scope);
+    } else {
+        coll_tree_reduce(ctx, scope, 0, buf, len, op);
+        coll_tree_broadcast(ctx, scope, 0, buf, len);
+    }
+    return 0;
+}
+
+int coll_allgather(coll_ctx_t *ctx, coll_scope_t scope, uint32_t buf, uint32_t len)
+{
+    if (coll_check(ctx, scope, 0, len))
+        return 1;
+    uint32_t n = coll_size(scope);
+    if (n == 1)
+        return 0;
+
+    if (ctx->algo == COLL_RING) {
+        coll_ring_allgather(ctx, scope, buf, n * len, 0);
+    } else if (ctx->algo == COLL_RECDBL) {
+        coll_recdbl_allgather(ctx, scope, buf, len);
+    } else {
+        /* Gather every block on the tree root, then broadcast them all */
+        uint32_t rank = coll_rank(scope);
+        uint32_t root = coll_tree_member(scope, 0);
+        if (get_hartid() != root)
+            idma_wait(ctx->idma, coll_put(ctx, root, buf + (rank * len), buf + (rank * len), len));
+        coll_barrier(ctx, scope);
+        coll_tree_broadcast(ctx, scope, 0, buf, n * len);
+    }
+    return 0;
+}
+
+int idma_multicast(coll_ctx_t *ctx,
+                   const uint32_t *tiles,
+                   uint32_t n_tiles,
+                   uint8_t bid,
+                   uint32_t axi_addr,
+                   uint32_t obi_addr,
+                   uint32_t len)
+{
+    uint32_t hartid = get_hartid();
+    uint32_t rank   = 0;
+    while (rank < n_tiles && tiles[rank] != hartid)
+        rank++;
+    if (rank == n_tiles) {
+        printf("Error: tile %d is not in the multicast group.\n", hartid);
+        return 1;
+    }
+    if (n_tiles != NUM_HARTS && n_tiles > 0xFF) {
+        printf("Error: multicast groups other than the whole mesh are limited to 255 tiles.\n");
+        return 1;
+    }
+
+    if (rank == 0)
+        idma_wait(ctx->idma, idma_memcpy_1d_async(ctx->idma, 0, axi_addr, obi_addr, len));
+    if (n_tiles == 1)
+        return 0;
+
+    fsync_barrier_t barrier = {.id = 0, .aggregate = 0};
+    if (n_tiles != NUM_HARTS)
+        barrier = fsync_barrier_create(ctx->fsync, tiles, (uint8_t)n_tiles, 0, bid);
+
+    /* After the step of span s the first 2s ranks hold the data */
+    for (uint32_t span = 1; span < n_tiles; span <<= 1) {
+        if (rank < span && rank + span < n_tiles)
+            idma_wait(ctx->idma, coll_put(ctx, tiles[rank + span], obi_addr, obi_addr, len));
+        if (n_tiles == NUM_HARTS)
+            fsync_wait(ctx->fsync, fsync_arrive_global(ctx->fsync));
+        else
+            fsync_wait(ctx->fsync, fsync_arrive(ctx->fsync, &barrier));
+    }
+    return 0;
+}
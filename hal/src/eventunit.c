@@ -10,6 +10,10 @@
 
 __attribute__((weak)) eu_controller_api_t eu_api = {
     .init                = eu_init,
+    .wait_any            = eu_wait_any,
+    .wait_all            = eu_wait_all,
+    .irq_register        = eu_irq_register,
+    .irq_unregister      = eu_irq_unregister,
     .redmule_init        = eu_redmule_init,
     .redmule_wait        = eu_redmule_wait,
     .redmule_is_busy     = eu_redmule_is_busy,
@@ -79,6 +79,14 @@ __attribute__((weak)) fsync_controller_api_t fsync_api = {
     .sync_row = fsync_sync_row,
     .sync_diag = fsync_sync_diag,
     .sync = fsync_sync,
+    .barrier_create = fsync_barrier_create,
+    .barrier_wait = fsync_barrier_wait,
+    .arrive_level = fsync_arrive_level,
+    .arrive_row = fsync_arrive_row,
+    .arrive_col = fsync_arrive_col,
+    .arrive_global = fsync_arrive_global,
+    .arrive = fsync_arrive,
+    .wait = fsync_wait,
     .sync_left = fsync_sync_left,
     .sync_right = fsync_sync_right,
     .sync_up = fsync_sync_up,
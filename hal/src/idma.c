@@ -42,12 +42,68 @@ __attribute__((weak)) int idma_memcpy_2d(idma_controller_t *ctrl, uint8_t dir, u
     return 1;
 }*/
 
+__attribute__((weak)) int idma_memcpy_3d(idma_controller_t *ctrl, uint8_t dir, uint32_t axi_addr, uint32_t obi_addr, uint32_t len, uint32_t std_2, uint32_t reps_2, uint32_t std_3, uint32_t reps_3){
+    (void) ctrl;
+    (void) dir;
+    (void) axi_addr;
+    (void) obi_addr;
+    (void) len;
+    (void) std_2;
+    (void) reps_2;
+    (void) std_3;
+    (void) reps_3;
+    return 1;
+}
+
+__attribute__((weak)) idma_handle_t idma_memcpy_nd(idma_controller_t *ctrl, const idma_nd_desc_t *desc){
+    (void) ctrl;
+    (void) desc;
+    return 0;
+}
+
+__attribute__((weak)) idma_handle_t idma_memcpy_1d_async(idma_controller_t *ctrl, uint8_t dir, uint32_t axi_addr, uint32_t obi_addr, uint32_t len){
+    (void) ctrl;
+    (void) dir;
+    (void) axi_addr;
+    (void) obi_addr;
+    (void) len;
+    return 0;
+}
+
+__attribute__((weak)) idma_handle_t idma_memcpy_2d_async(idma_controller_t *ctrl, uint8_t dir, uint32_t axi_addr, uint32_t obi_addr, uint32_t len, uint32_t std, uint32_t reps){
+    (void) ctrl;
+    (void) dir;
+    (void) axi_addr;
+    (void) obi_addr;
+    (void) len;
+    (void) std;
+    (void) reps;
+    return 0;
+}
+
+__attribute__((weak)) int idma_wait(idma_controller_t *ctrl, idma_handle_t handle){
+    (void) ctrl;
+    (void) handle;
+    return 1;
+}
+
+__attribute__((weak)) int idma_test(idma_controller_t *ctrl, idma_handle_t handle){
+    (void) ctrl;
+    (void) handle;
+    return 1;
+}
+
 /*----------------------------------------*/
 /* Export the controller API for the IDMA */
 /*----------------------------------------*/
 __attribute__((weak)) idma_controller_api_t idma_api = {
     .init = idma_init,
-/*     .wait = idma_wait, */
+    .wait = idma_wait,
+    .test = idma_test,
     .memcpy_1d = idma_memcpy_1d,
     .memcpy_2d = idma_memcpy_2d,
+    .memcpy_3d = idma_memcpy_3d,
+    .memcpy_nd = idma_memcpy_nd,
+    .memcpy_1d_async = idma_memcpy_1d_async,
+    .memcpy_2d_async = idma_memcpy_2d_async,
 };
\ No newline at end of file
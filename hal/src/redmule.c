@@ -41,12 +41,31 @@ uint32_t y, uint16_t m, uint16_t n, uint16_t k){ (void) ctrl; (void) x; (void) w
 m; (void) n; (void) k; return 1;
 }*/
 
+/*__attribute__((weak)) redmule_job_t redmule_gemm_async(redmule_controller_t *ctrl, uint32_t x,
+uint32_t w, uint32_t y, uint16_t m, uint16_t n, uint16_t k){ (void) ctrl; (void) x; (void) w; (void)
+y; (void) m; (void) n; (void) k; return -1;
+}*/
+
+/*__attribute__((weak)) int redmule_wait_job(redmule_controller_t *ctrl, redmule_job_t job){
+    (void) ctrl;
+    (void) job;
+    return 1;
+}*/
+
+/*__attribute__((weak)) redmule_job_t redmule_wait_any(redmule_controller_t *ctrl){
+    (void) ctrl;
+    return -1;
+}*/
+
 /*-------------------------------------------*/
 /* Export the controller API for the Redmule */
 /*-------------------------------------------*/
 __attribute__((weak)) redmule_controller_api_t redmule_api = {
     .init = redmule_init,
     /*     .wait = redmule_wait, */
-    .acquire = redmule_acquire,
-    .gemm    = redmule_gemm,
+    .acquire    = redmule_acquire,
+    .gemm       = redmule_gemm,
+    .gemm_async = redmule_gemm_async,
+    .wait_job   = redmule_wait_job,
+    .wait_any   = redmule_wait_any,
 };
\ No newline at end of file
@@ -2,12 +2,21 @@
 // Licensed under the Apache License, Version 2.0, see LICENSE for details.
 // SPDX-License-Identifier: Apache-2.0
 //
-// gvsoc2perfetto — convert GVSOC waveform traces (VCD) to Perfetto traces.
+// gvsoc2perfetto — convert GVSOC waveform traces (VCD or FST) to Perfetto traces.
+//
+// The trace is memory-mapped and split into chunks: a VCD value-change section
+// at timestamp boundaries, an FST at its value-change blocks. Worker threads
+// parse or decompress the chunks in parallel, while the main thread consumes
+// them in file order, converts them and streams the packets to the output:
+// memory stays bounded by a few chunks, whatever the size of the trace.
 //
 
 use std::collections::{HashMap, HashSet};
 use std::fs::File;
-use std::io::{self, BufReader, BufRead, BufWriter, Write};
+use std::io::{self, BufReader, BufRead, BufWriter, Read, Write};
+use std::os::unix::io::AsRawFd;
+use std::sync::atomic::{AtomicBool, AtomicUsize, Ordering};
+use std::sync::{mpsc, Condvar, Mutex};
 
 use flate2::write::GzEncoder;
 use flate2::Compression;
@@ -25,11 +34,6 @@ struct Signal {
     width: i64,
 }
 
-struct Change {
-    t: i64,       // time in ticks
-    val: String,  // value token (lowercased scalar char, binary string, or string value)
-}
-
 #[derive(Clone)]
 enum Num {
     I(u128),
@@ -143,6 +147,186 @@ fn atoi(b: &[u8]) -> i64 {
     n
 }
 
+// --------------------------------------------------------------------------
+// Trace input: memory map, value-change chunks and the parallel chunk driver
+// --------------------------------------------------------------------------
+
+// Read-only memory map of the input trace.
+struct Mmap {
+    ptr: *mut libc::c_void,
+    len: usize,
+}
+
+// The mapping is read-only and only unmapped on drop.
+unsafe impl Send for Mmap {}
+unsafe impl Sync for Mmap {}
+
+impl Mmap {
+    fn open(path: &str) -> io::Result<Mmap> {
+        let file = File::open(path)?;
+        let len = file.metadata()?.len() as usize;
+        if len == 0 {
+            return Ok(Mmap { ptr: std::ptr::null_mut(), len: 0 });
+        }
+        let ptr = unsafe {
+            libc::mmap(std::ptr::null_mut(), len, libc::PROT_READ, libc::MAP_PRIVATE, file.as_raw_fd(), 0)
+        };
+        if ptr == libc::MAP_FAILED {
+            return Err(io::Error::last_os_error());
+        }
+        unsafe {
+            libc::madvise(ptr, len, libc::MADV_SEQUENTIAL);
+        }
+        Ok(Mmap { ptr, len })
+    }
+
+    fn bytes(&self) -> &[u8] {
+        if self.len == 0 {
+            &[]
+        } else {
+            unsafe { std::slice::from_raw_parts(self.ptr as *const u8, self.len) }
+        }
+    }
+
+    // Drop the pages of an already consumed range from the resident set. The
+    // mapping is private and never written, so a later access just reads the
+    // file again.
+    fn release(&self, start: usize, end: usize) {
+        let page = 4096;
+        let start = start / page * page;
+        if self.len == 0 || end <= start {
+            return;
+        }
+        unsafe {
+            libc::madvise(
+                (self.ptr as *mut u8).add(start) as *mut libc::c_void,
+                end.min(self.len) - start,
+                libc::MADV_DONTNEED,
+            );
+        }
+    }
+}
+
+impl Drop for Mmap {
+    fn drop(&mut self) {
+        if self.len != 0 {
+            unsafe {
+                libc::munmap(self.ptr, self.len);
+            }
+        }
+    }
+}
+
+// One value change of a selected signal; the value is val(rec).
+struct Rec {
+    sig: u32, // index in the signal table
+    t: i64,   // time in ticks
+    off: u32,
+    len: u32,
+}
+
+// Value changes of one chunk, in time order.
+struct Chunk {
+    recs: Vec<Rec>,
+    vals: String, // value tokens (lowercased scalar char, binary string, or string value)
+}
+
+impl Chunk {
+    fn val(&self, r: &Rec) -> &str {
+        &self.vals[r.off as usize..(r.off + r.len) as usize]
+    }
+
+    fn push(&mut self, sig: u32, t: i64, val: &str) {
+        let off = self.vals.len() as u32;
+        self.vals.push_str(val);
+        self.recs.push(Rec { sig, t, off, len: val.len() as u32 });
+    }
+}
+
+// Parse the chunks (input ranges) with `parse` on `jobs` worker threads and
+// hand them to `consume` in file order. Workers stay at most a few chunks ahead
+// of the consumer, which bounds the memory held by parsed chunks, and consumed
+// input pages are released.
+fn for_each_chunk<P, F>(
+    map: &Mmap,
+    chunks: &[(usize, usize)],
+    jobs: usize,
+    progress: &ProgressBar,
+    parse: P,
+    mut consume: F,
+) -> io::Result<()>
+where
+    P: Fn(usize) -> io::Result<Chunk> + Sync,
+    F: FnMut(&Chunk) -> io::Result<()>,
+{
+    let window = 2 * jobs;
+    let next = AtomicUsize::new(0);
+    let stop = AtomicBool::new(false);
+    let consumed = Mutex::new(0usize);
+    let advanced = Condvar::new();
+
+    std::thread::scope(|s| {
+        let (tx, rx) = mpsc::sync_channel::<(usize, io::Result<Chunk>)>(window);
+        for _ in 0..jobs {
+            let tx = tx.clone();
+            let (next, stop, consumed, advanced, parse) = (&next, &stop, &consumed, &advanced, &parse);
+            s.spawn(move || loop {
+                let i = next.fetch_add(1, Ordering::Relaxed);
+                if i >= chunks.len() {
+                    break;
+                }
+                {
+                    let mut c = consumed.lock().unwrap();
+                    while i >= c.saturating_add(window) {
+                        c = advanced.wait(c).unwrap();
+                    }
+                }
+                if stop.load(Ordering::Relaxed) {
+                    break;
+                }
+                if tx.send((i, parse(i))).is_err() {
+                    break;
+                }
+            });
+        }
+        drop(tx);
+
+        let mut pending: HashMap<usize, io::Result<Chunk>> = HashMap::new();
+        let mut result = Ok(());
+        let mut want = 0usize;
+        while want < chunks.len() {
+            let chunk = match pending.remove(&want) {
+                Some(c) => c,
+                None => match rx.recv() {
+                    Ok((i, c)) if i == want => c,
+                    Ok((i, c)) => {
+                        pending.insert(i, c);
+                        continue;
+                    }
+                    Err(_) => break,
+                },
+            };
+            if let Err(e) = chunk.and_then(|c| consume(&c)) {
+                result = Err(e);
+                break;
+            }
+            let (a, b) = chunks[want];
+            map.release(a, b);
+            progress.inc((b - a) as u64);
+            want += 1;
+            *consumed.lock().unwrap() = want;
+            advanced.notify_all();
+        }
+
+        // On error, unblock the workers and let them exit.
+        stop.store(true, Ordering::Relaxed);
+        *consumed.lock().unwrap() = usize::MAX;
+        advanced.notify_all();
+        drop(rx);
+        result
+    })
+}
+
 // --------------------------------------------------------------------------
 // VCD parser
 // --------------------------------------------------------------------------
@@ -159,106 +343,130 @@ fn timescale_factor(u: &str) -> f64 {
     }
 }
 
-fn parse_vcd(
-    path: &str,
-    inc: Option<&Regex>,
-    exc: Option<&Regex>,
-) -> io::Result<(IndexMap<String, Signal>, HashMap<String, Vec<Change>>, f64)> {
-    let file = File::open(path)?;
-    let mut reader = BufReader::with_capacity(1 << 20, file);
+// Size of the value-change chunks handed to the workers; at most a few per
+// worker are in memory at any time.
+const CHUNK_BYTES: usize = 8 << 20;
+
+fn next_line<'a>(data: &'a [u8], pos: &mut usize) -> Option<&'a [u8]> {
+    if *pos >= data.len() {
+        return None;
+    }
+    let start = *pos;
+    let end = memchr::memchr(b'\n', &data[start..]).map_or(data.len(), |i| start + i);
+    *pos = (end + 1).min(data.len());
+    Some(&data[start..end])
+}
 
+struct VcdHeader {
+    signals: IndexMap<String, Signal>,
+    ps_per_tick: f64,
+    body: usize, // offset of the value-change section
+}
+
+fn parse_vcd_header(data: &[u8], inc: Option<&Regex>, exc: Option<&Regex>) -> VcdHeader {
     let mut signals: IndexMap<String, Signal> = IndexMap::new();
-    let mut changes: HashMap<String, Vec<Change>> = HashMap::new();
     let mut scope: Vec<String> = Vec::new();
     let mut ps_per_tick = 1.0f64;
-    let mut time = 0i64;
-    let mut in_defs = true;
+    let mut pos = 0usize;
 
     let bracket_re = Regex::new(r"\s*\[.*\]$").unwrap();
     let ts_re = Regex::new(r"(\d+)\s*(fs|ps|ns|us|ms|s)").unwrap();
 
     let wanted = |full: &str| -> bool {
-        inc.map_or(true, |r| r.is_match(full)) && exc.map_or(true, |r| !r.is_match(full))
+        inc.is_none_or(|r| r.is_match(full)) && exc.is_none_or(|r| !r.is_match(full))
     };
 
-    let mut buf: Vec<u8> = Vec::new();
-    loop {
-        buf.clear();
-        let n = reader.read_until(b'\n', &mut buf)?;
-        if n == 0 {
-            break;
+    while let Some(raw) = next_line(data, &mut pos) {
+        let line = String::from_utf8_lossy(raw);
+        let line = line.trim();
+        if line.is_empty() {
+            continue;
         }
-
-        if in_defs {
-            let line = String::from_utf8_lossy(&buf);
-            let line = line.trim();
-            if line.is_empty() {
-                continue;
-            }
-            let tok: Vec<&str> = line.split_whitespace().collect();
-            match tok[0] {
-                "$timescale" => {
-                    // may be same-line ("$timescale 1ps $end") or multi-line
-                    let mut body = line.to_string();
-                    let mut tb: Vec<u8> = Vec::new();
-                    while !body.contains("$end") {
-                        tb.clear();
-                        let m = reader.read_until(b'\n', &mut tb)?;
-                        if m == 0 {
-                            break;
+        let tok: Vec<&str> = line.split_whitespace().collect();
+        match tok[0] {
+            "$timescale" => {
+                // may be same-line ("$timescale 1ps $end") or multi-line
+                let mut body = line.to_string();
+                while !body.contains("$end") {
+                    match next_line(data, &mut pos) {
+                        Some(l) => {
+                            body.push(' ');
+                            body.push_str(String::from_utf8_lossy(l).trim());
                         }
-                        body.push(' ');
-                        body.push_str(String::from_utf8_lossy(&tb).trim());
-                    }
-                    if let Some(cap) = ts_re.captures(&body) {
-                        let d: f64 = cap[1].parse().unwrap_or(1.0);
-                        ps_per_tick = d * timescale_factor(&cap[2]);
+                        None => break,
                     }
                 }
-                "$scope" => {
-                    if tok.len() >= 3 {
-                        scope.push(tok[2].to_string());
-                    }
+                if let Some(cap) = ts_re.captures(&body) {
+                    let d: f64 = cap[1].parse().unwrap_or(1.0);
+                    ps_per_tick = d * timescale_factor(&cap[2]);
                 }
-                "$upscope" => {
-                    scope.pop();
+            }
+            "$scope" => {
+                if tok.len() >= 3 {
+                    scope.push(tok[2].to_string());
                 }
-                "$var" => {
-                    // $var <type> <width> <id> <name...> $end
-                    if tok.len() >= 4 {
-                        let vtype = tok[1];
-                        let width: i64 = tok[2].parse().unwrap_or(0);
-                        let vid = tok[3];
-                        let name = if *tok.last().unwrap() == "$end" {
-                            tok[4..tok.len() - 1].join(" ")
-                        } else {
-                            tok[4..].join(" ")
-                        };
-                        let name = bracket_re.replace(&name, "").into_owned(); // strip [31:0]
-                        let full = if scope.is_empty() {
-                            name.clone()
-                        } else {
-                            format!("{}.{}", scope.join("."), name)
-                        };
-                        if wanted(&full) {
-                            signals.insert(
-                                vid.to_string(),
-                                Signal { name: full, vtype: vtype.to_string(), width },
-                            );
-                            changes.insert(vid.to_string(), Vec::new());
-                        }
+            }
+            "$upscope" => {
+                scope.pop();
+            }
+            "$var" => {
+                // $var <type> <width> <id> <name...> $end
+                if tok.len() >= 4 {
+                    let vtype = tok[1];
+                    let width: i64 = tok[2].parse().unwrap_or(0);
+                    let vid = tok[3];
+                    let name = if *tok.last().unwrap() == "$end" {
+                        tok[4..tok.len() - 1].join(" ")
+                    } else {
+                        tok[4..].join(" ")
+                    };
+                    let name = bracket_re.replace(&name, "").into_owned(); // strip [31:0]
+                    let full = if scope.is_empty() {
+                        name.clone()
+                    } else {
+                        format!("{}.{}", scope.join("."), name)
+                    };
+                    if wanted(&full) {
+                        signals.insert(
+                            vid.to_string(),
+                            Signal { name: full, vtype: vtype.to_string(), width },
+                        );
                     }
                 }
-                "$enddefinitions" => {
-                    in_defs = false;
-                }
-                _ => {}
             }
-            continue;
+            "$enddefinitions" => break,
+            _ => {}
         }
+    }
+
+    VcdHeader { signals, ps_per_tick, body: pos }
+}
+
+// Split data[body..] into ranges of about `size` bytes, each one but the first
+// starting on a timestamp line, so that chunks can be parsed independently.
+fn split_chunks(data: &[u8], body: usize, size: usize) -> Vec<(usize, usize)> {
+    let mut chunks = Vec::new();
+    let mut start = body;
+    while start < data.len() {
+        let probe = start + size;
+        let end = if probe >= data.len() {
+            data.len()
+        } else {
+            memchr::memmem::find(&data[probe..], b"\n#").map_or(data.len(), |i| probe + i + 1)
+        };
+        chunks.push((start, end));
+        start = end;
+    }
+    chunks
+}
+
+fn parse_chunk(data: &[u8], ids: &HashMap<Vec<u8>, u32>) -> Chunk {
+    let mut chunk = Chunk { recs: Vec::new(), vals: String::new() };
+    let mut time = 0i64;
+    let mut pos = 0usize;
 
-        // ---- value-change section ----
-        let lt = buf.trim_ascii();
+    while let Some(line) = next_line(data, &mut pos) {
+        let lt = line.trim_ascii();
         if lt.is_empty() {
             continue;
         }
@@ -268,134 +476,746 @@ fn parse_vcd(
                 time = atoi(&lt[1..]);
             }
             b'0' | b'1' | b'x' | b'X' | b'z' | b'Z' => {
-                let vid = String::from_utf8_lossy(&lt[1..]);
-                if let Some(v) = changes.get_mut(vid.as_ref()) {
-                    v.push(Change { t: time, val: (c as char).to_ascii_lowercase().to_string() });
+                if let Some(&sig) = ids.get(&lt[1..]) {
+                    let v = [c.to_ascii_lowercase()];
+                    chunk.push(sig, time, std::str::from_utf8(&v).unwrap());
                 }
             }
             b'b' | b'B' | b'r' | b'R' => {
-                let s = String::from_utf8_lossy(&lt[1..]);
-                let mut it = s.split_whitespace();
-                let val = it.next().unwrap_or("");
-                let vid = it.next().unwrap_or("");
-                if !vid.is_empty() {
-                    if let Some(v) = changes.get_mut(vid) {
-                        v.push(Change { t: time, val: val.to_string() });
-                    }
+                let mut it = lt[1..].split(|b| b.is_ascii_whitespace()).filter(|s| !s.is_empty());
+                let val = it.next().unwrap_or(b"");
+                let vid = it.next().unwrap_or(b"");
+                if let Some(&sig) = ids.get(vid) {
+                    chunk.push(sig, time, &String::from_utf8_lossy(val));
                 }
             }
             b's' | b'S' => {
-                let s = String::from_utf8_lossy(&lt[1..]);
-                let parts: Vec<&str> = s.split_whitespace().collect();
-                let (val, vid): (String, &str) = match parts.len() {
-                    0 => continue,
-                    1 => (String::new(), parts[0]), // "s <id>" -> empty string
-                    2 => (parts[0].to_string(), parts[1]),
-                    _ => (parts[..parts.len() - 1].join(" "), parts[parts.len() - 1]),
+                let parts: Vec<&[u8]> =
+                    lt[1..].split(|b| b.is_ascii_whitespace()).filter(|s| !s.is_empty()).collect();
+                let (vid, val) = match parts.split_last() {
+                    None => continue,
+                    Some((vid, val)) => (*vid, val), // "s <id>" -> empty string
                 };
-                if let Some(v) = changes.get_mut(vid) {
-                    v.push(Change { t: time, val });
+                if let Some(&sig) = ids.get(vid) {
+                    chunk.push(sig, time, &String::from_utf8_lossy(&val.join(&b' ')));
                 }
             }
             b'$' => {} // $dumpvars / $end etc.
             _ => {}
         }
     }
-
-    Ok((signals, changes, ps_per_tick))
+    chunk
 }
 
 // --------------------------------------------------------------------------
-// --derive-busy: synthesize a busy pseudo-signal from a pair of siblings.
+// FST reader: the GTKWave compressed format, read directly instead of going
+// through fst2vcd. Each value-change block is a chunk, decompressed by a
+// worker; only the signals selected by --include/--exclude are unpacked.
 // --------------------------------------------------------------------------
 
-fn inject_derived_busy(
-    signals: &mut IndexMap<String, Signal>,
-    changes: &mut HashMap<String, Vec<Change>>,
-    specs: &[(String, String)],
-) -> usize {
-    // parent path -> {leaf -> vid}, in signals insertion order
-    let mut by_parent: IndexMap<String, IndexMap<String, String>> = IndexMap::new();
-    for (vid, sig) in signals.iter() {
-        let (parent, leaf) = match sig.name.rsplit_once('.') {
-            Some((p, l)) => (p.to_string(), l.to_string()),
-            None => (String::new(), sig.name.clone()),
-        };
-        by_parent.entry(parent).or_default().insert(leaf, vid.clone());
+const FST_BL_HDR: u8 = 0;
+const FST_BL_VCDATA: u8 = 1;
+const FST_BL_GEOM: u8 = 3;
+const FST_BL_HIER: u8 = 4;
+const FST_BL_VCDATA_DYN_ALIAS: u8 = 5;
+const FST_BL_HIER_LZ4: u8 = 6;
+const FST_BL_HIER_LZ4DUO: u8 = 7;
+const FST_BL_VCDATA_DYN_ALIAS2: u8 = 8;
+const FST_BL_ZWRAPPER: u8 = 254;
+const FST_HDR_LEN: u64 = 329;
+
+const FST_ST_GEN_ATTRBEGIN: u8 = 252;
+const FST_ST_GEN_ATTREND: u8 = 253;
+const FST_ST_VCD_SCOPE: u8 = 254;
+const FST_ST_VCD_UPSCOPE: u8 = 255;
+
+// $var types, indexed by FST_VT_* (FST_VT_GEN_STRING = 21 is "string").
+const FST_VAR_TYPES: [&str; 30] = [
+    "event", "integer", "parameter", "real", "real_parameter", "reg", "supply0", "supply1", "time", "tri",
+    "triand", "trior", "trireg", "tri0", "tri1", "wand", "wire", "wor", "port", "sparray", "realtime",
+    "string", "bit", "logic", "int", "shortint", "longint", "byte", "enum", "shortreal",
+];
+
+// Non-0/1 scalar values, indexed by the 3-bit code of a 1-bit change.
+const FST_RCV_STR: &[u8; 8] = b"xzhuwl-?";
+
+fn fst_err(msg: &str) -> io::Error {
+    io::Error::new(io::ErrorKind::InvalidData, format!("FST: {}", msg))
+}
+
+// A header block first, or a gzip wrapper around the whole file.
+fn is_fst(data: &[u8]) -> bool {
+    if data.len() < 9 {
+        return false;
     }
+    let len = u64::from_be_bytes(data[1..9].try_into().unwrap());
+    (data[0] == FST_BL_HDR && len == FST_HDR_LEN) || (data[0] == FST_BL_ZWRAPPER && len + 1 == data.len() as u64)
+}
 
-    let mut new_signals: Vec<(String, Signal, Vec<Change>)> = Vec::new();
-    for (leaf_a, leaf_b) in specs {
-        for (parent, leaves) in by_parent.iter() {
-            let (vid_a, vid_b) = match (leaves.get(leaf_a), leaves.get(leaf_b)) {
-                (Some(a), Some(b)) => (a, b),
-                _ => continue,
-            };
-            let mut merged: Vec<(i64, u8, &str)> = Vec::new();
-            if let Some(cs) = changes.get(vid_a) {
-                for c in cs {
-                    merged.push((c.t, 0, c.val.as_str()));
+// Bounds-checked reader over FST block contents.
+struct Cursor<'a> {
+    b: &'a [u8],
+    p: usize,
+}
+
+impl<'a> Cursor<'a> {
+    fn new(b: &'a [u8], p: usize) -> Self {
+        Cursor { b, p }
+    }
+
+    fn done(&self) -> bool {
+        self.p >= self.b.len()
+    }
+
+    fn u8(&mut self) -> io::Result<u8> {
+        let v = *self.b.get(self.p).ok_or_else(|| fst_err("truncated block"))?;
+        self.p += 1;
+        Ok(v)
+    }
+
+    fn bytes(&mut self, n: usize) -> io::Result<&'a [u8]> {
+        let end = self.p.checked_add(n).filter(|&e| e <= self.b.len()).ok_or_else(|| fst_err("truncated block"))?;
+        let v = &self.b[self.p..end];
+        self.p = end;
+        Ok(v)
+    }
+
+    fn u64be(&mut self) -> io::Result<u64> {
+        Ok(u64::from_be_bytes(self.bytes(8)?.try_into().unwrap()))
+    }
+
+    fn varint(&mut self) -> io::Result<u64> {
+        let mut v = 0u64;
+        let mut shift = 0;
+        loop {
+            let b = self.u8()?;
+            if shift < 64 {
+                v |= ((b & 0x7f) as u64) << shift;
+            }
+            shift += 7;
+            if b & 0x80 == 0 {
+                return Ok(v);
+            }
+        }
+    }
+
+    fn svarint(&mut self) -> io::Result<i64> {
+        let mut v = 0i64;
+        let mut shift = 0;
+        loop {
+            let b = self.u8()?;
+            if shift < 64 {
+                v |= ((b & 0x7f) as i64) << shift;
+            }
+            shift += 7;
+            if b & 0x80 == 0 {
+                if shift < 64 && b & 0x40 != 0 {
+                    v |= -1i64 << shift;
+                }
+                return Ok(v);
+            }
+        }
+    }
+
+    // NUL-terminated string.
+    fn zstr(&mut self) -> io::Result<&'a [u8]> {
+        let n = memchr::memchr(0, &self.b[self.p.min(self.b.len())..]).ok_or_else(|| fst_err("truncated string"))?;
+        let v = self.bytes(n)?;
+        self.p += 1;
+        Ok(v)
+    }
+}
+
+fn u64be_at(data: &[u8], pos: usize) -> io::Result<u64> {
+    Cursor::new(data, pos).u64be()
+}
+
+fn zlib_unpack(src: &[u8], len: usize) -> io::Result<Vec<u8>> {
+    let mut out = Vec::with_capacity(len);
+    flate2::read::ZlibDecoder::new(src).read_to_end(&mut out)?;
+    Ok(out)
+}
+
+// LZ4 block format, as produced by LZ4_compress_default().
+fn lz4_unpack(src: &[u8], len: usize) -> io::Result<Vec<u8>> {
+    let mut out: Vec<u8> = Vec::with_capacity(len);
+    let mut c = Cursor::new(src, 0);
+    let ext = |c: &mut Cursor, mut n: usize| -> io::Result<usize> {
+        if n == 15 {
+            loop {
+                let b = c.u8()?;
+                n += b as usize;
+                if b != 255 {
+                    break;
+                }
+            }
+        }
+        Ok(n)
+    };
+    while !c.done() {
+        let token = c.u8()?;
+        let lit = ext(&mut c, (token >> 4) as usize)?;
+        out.extend_from_slice(c.bytes(lit)?);
+        if c.done() {
+            break; // the last sequence only has literals
+        }
+        let off = c.u8()? as usize | (c.u8()? as usize) << 8;
+        let n = ext(&mut c, (token & 15) as usize)? + 4;
+        if off == 0 || off > out.len() {
+            return Err(fst_err("bad LZ4 offset"));
+        }
+        let from = out.len() - off;
+        for k in 0..n {
+            let b = out[from + k];
+            out.push(b);
+        }
+    }
+    Ok(out)
+}
+
+// FastLZ, levels 1 and 2 (the level is in the top bits of the first byte).
+fn fastlz_unpack(src: &[u8], len: usize) -> io::Result<Vec<u8>> {
+    let mut out: Vec<u8> = Vec::with_capacity(len);
+    if src.is_empty() {
+        return Ok(out);
+    }
+    let level2 = src[0] >> 5 == 1;
+    let mut c = Cursor::new(src, 0);
+    let mut ctrl = (c.u8()? & 31) as usize;
+    loop {
+        if ctrl >= 32 {
+            let mut n = (ctrl >> 5) - 1;
+            let mut dist = (ctrl & 31) << 8;
+            if n == 6 {
+                if level2 {
+                    loop {
+                        let b = c.u8()?;
+                        n += b as usize;
+                        if b != 255 {
+                            break;
+                        }
+                    }
+                } else {
+                    n += c.u8()? as usize;
                 }
             }
-            if let Some(cs) = changes.get(vid_b) {
-                for c in cs {
-                    merged.push((c.t, 1, c.val.as_str()));
+            let code = c.u8()? as usize;
+            dist += code;
+            if level2 && code == 255 && dist == (31 << 8) + 255 {
+                dist = ((c.u8()? as usize) << 8 | c.u8()? as usize) + 8191;
+            }
+            dist += 1;
+            if dist > out.len() {
+                return Err(fst_err("bad FastLZ distance"));
+            }
+            let from = out.len() - dist;
+            for k in 0..n + 3 {
+                let b = out[from + k];
+                out.push(b);
+            }
+        } else {
+            out.extend_from_slice(c.bytes(ctrl + 1)?);
+        }
+        if c.done() {
+            break;
+        }
+        ctrl = c.u8()? as usize;
+    }
+    Ok(out)
+}
+
+// Per-signal value-change data of a block, compressed according to `pack`.
+fn vc_unpack(src: &[u8], len: usize, pack: u8) -> io::Result<Vec<u8>> {
+    let out = match pack {
+        b'4' => lz4_unpack(src, len)?,
+        b'F' => fastlz_unpack(src, len)?,
+        _ => zlib_unpack(src, len)?,
+    };
+    if out.len() != len {
+        return Err(fst_err("bad value-change data length"));
+    }
+    Ok(out)
+}
+
+fn format_real(b: &[u8], le: bool) -> String {
+    let raw: [u8; 8] = b.try_into().unwrap();
+    let x = if le { f64::from_le_bytes(raw) } else { f64::from_be_bytes(raw) };
+    format!("{}", x)
+}
+
+// Normalize a string value like the VCD parser does: whitespace runs collapse.
+fn push_fst_string(chunk: &mut Chunk, sig: u32, t: i64, b: &[u8]) {
+    let s = String::from_utf8_lossy(b);
+    let v: Vec<&str> = s.split_whitespace().collect();
+    chunk.push(sig, t, &v.join(" "));
+}
+
+struct FstFile {
+    vc_blocks: Vec<(usize, u8)>, // (position of the section length, block type)
+    lens: Vec<u32>,              // per handle: bits, 0 for variable-length
+    real: Vec<bool>,             // per handle: value is a double
+    double_le: bool,             // doubles are little-endian
+}
+
+// Read the header, geometry and hierarchy of an FST file. Signals are keyed
+// by their handle, so aliases collapse to one signal as with VCD id codes.
+fn open_fst(
+    data: &[u8],
+    inc: Option<&Regex>,
+    exc: Option<&Regex>,
+) -> io::Result<(IndexMap<String, Signal>, f64, FstFile)> {
+    let mut blocks: Vec<(usize, u8, usize)> = Vec::new(); // (section pos, type, section length)
+    let mut p = 0usize;
+    while p + 9 <= data.len() {
+        let typ = data[p];
+        let len = u64be_at(data, p + 1)? as usize;
+        if len < 8 || p + 1 + len > data.len() {
+            break; // trace still being written
+        }
+        if typ == FST_BL_ZWRAPPER {
+            return Err(fst_err("gzip-wrapped FST is not supported, convert it with fst2vcd"));
+        }
+        blocks.push((p + 1, typ, len));
+        p += 1 + len;
+    }
+
+    // Header: the endianness test double (e) and the timescale exponent
+    let (hdr, _, _) = blocks.first().copied().ok_or_else(|| fst_err("missing header"))?;
+    let double_le = f64::from_le_bytes(data[hdr + 24..hdr + 32].try_into().unwrap()) == std::f64::consts::E;
+    let exp = data[hdr + 72] as i8 as i32;
+    let ps_per_tick = 10f64.powi(exp + 12);
+
+    // Geometry: per handle, the width (0: real, 0xFFFFFFFF: variable length)
+    let mut lens = Vec::new();
+    let mut real = Vec::new();
+    if let Some(&(pos, _, len)) = blocks.iter().find(|b| b.1 == FST_BL_GEOM) {
+        let mut c = Cursor::new(&data[..pos + len], pos + 8);
+        let uclen = c.u64be()? as usize;
+        let maxhandle = c.u64be()? as usize;
+        let body = c.bytes(len - 24)?;
+        let geom = if body.len() != uclen { zlib_unpack(body, uclen)? } else { body.to_vec() };
+        let mut g = Cursor::new(&geom, 0);
+        for _ in 0..maxhandle {
+            match g.varint()? {
+                0 => {
+                    lens.push(8);
+                    real.push(true);
+                }
+                v => {
+                    lens.push(if v == 0xFFFF_FFFF { 0 } else { v as u32 });
+                    real.push(false);
                 }
             }
-            merged.sort_by(|x, y| x.0.cmp(&y.0).then(x.1.cmp(&y.1)).then(x.2.cmp(y.2)));
+        }
+    } else {
+        return Err(fst_err("missing geometry block (trace not closed?)"));
+    }
 
-            let mut derived: Vec<Change> = Vec::new();
-            let mut val_a: Option<u128> = None;
-            let mut val_b: Option<u128> = None;
-            for (t, which, v) in merged {
-                let nv = parse_bits_or_int0(v);
-                if which == 0 {
-                    val_a = nv;
+    // Hierarchy: scopes and vars, in declaration order
+    let &(pos, typ, len) = blocks
+        .iter()
+        .find(|b| matches!(b.1, FST_BL_HIER | FST_BL_HIER_LZ4 | FST_BL_HIER_LZ4DUO))
+        .ok_or_else(|| fst_err("missing hierarchy block"))?;
+    let mut c = Cursor::new(&data[..pos + len], pos + 8);
+    let uclen = c.u64be()? as usize;
+    let hier = match typ {
+        FST_BL_HIER => {
+            let mut out = Vec::with_capacity(uclen);
+            flate2::read::MultiGzDecoder::new(c.bytes(len - 16)?).read_to_end(&mut out)?;
+            out
+        }
+        FST_BL_HIER_LZ4 => lz4_unpack(c.bytes(len - 16)?, uclen)?,
+        _ => {
+            let start = c.p;
+            let mid = c.varint()? as usize;
+            let body = c.bytes(len - 16 - (c.p - start))?;
+            lz4_unpack(&lz4_unpack(body, mid)?, uclen)?
+        }
+    };
+
+    let bracket_re = Regex::new(r"\s*\[.*\]$").unwrap();
+    let wanted = |full: &str| -> bool {
+        inc.is_none_or(|r| r.is_match(full)) && exc.is_none_or(|r| !r.is_match(full))
+    };
+    let mut signals: IndexMap<String, Signal> = IndexMap::new();
+    let mut scope: Vec<String> = Vec::new();
+    let mut handle = 0u64;
+    let mut h = Cursor::new(&hier, 0);
+    while !h.done() {
+        match h.u8()? {
+            FST_ST_VCD_SCOPE => {
+                h.u8()?; // scope type
+                scope.push(String::from_utf8_lossy(h.zstr()?).into_owned());
+                h.zstr()?; // component
+            }
+            FST_ST_VCD_UPSCOPE => {
+                scope.pop();
+            }
+            FST_ST_GEN_ATTRBEGIN => {
+                h.bytes(2)?; // attribute type and subtype
+                h.zstr()?;
+                h.varint()?;
+            }
+            FST_ST_GEN_ATTREND => {}
+            vt if (vt as usize) < FST_VAR_TYPES.len() => {
+                h.u8()?; // direction
+                let name = String::from_utf8_lossy(h.zstr()?).into_owned();
+                let width = h.varint()? as i64;
+                let alias = h.varint()?;
+                let vid = if alias == 0 {
+                    handle += 1;
+                    handle
                 } else {
-                    val_b = nv;
+                    alias
+                };
+                let name = bracket_re.replace(&name, "").into_owned(); // strip [31:0]
+                let full = if scope.is_empty() { name } else { format!("{}.{}", scope.join("."), name) };
+                if wanted(&full) {
+                    signals.insert(
+                        vid.to_string(),
+                        Signal { name: full, vtype: FST_VAR_TYPES[vt as usize].to_string(), width },
+                    );
                 }
-                if val_a.is_none() || val_b.is_none() {
+            }
+            t => return Err(fst_err(&format!("unknown hierarchy tag {}", t))),
+        }
+    }
+
+    let vc_blocks = blocks
+        .iter()
+        .filter(|b| matches!(b.1, FST_BL_VCDATA | FST_BL_VCDATA_DYN_ALIAS | FST_BL_VCDATA_DYN_ALIAS2))
+        .map(|b| (b.0, b.1))
+        .collect();
+    Ok((signals, ps_per_tick, FstFile { vc_blocks, lens, real, double_le }))
+}
+
+impl FstFile {
+    // Decode value-change block `k` for the handles mapped by `ids` (handle - 1
+    // -> signal index, u32::MAX if not selected). The initial values of the
+    // first block (the frame) come first, as in a VCD $dumpvars.
+    fn parse_block(&self, data: &[u8], k: usize, ids: &[u32]) -> io::Result<Chunk> {
+        let (pos, typ) = self.vc_blocks[k];
+        let end = pos + u64be_at(data, pos)? as usize;
+        let blk = &data[..end];
+        let beg = u64be_at(blk, pos + 8)? as i64;
+
+        // Time table, at the end of the block
+        if end < pos + 56 {
+            return Err(fst_err("truncated value-change block"));
+        }
+        let mut c = Cursor::new(blk, end - 24);
+        let t_uclen = c.u64be()? as usize;
+        let t_clen = c.u64be()? as usize;
+        let t_items = c.u64be()? as usize;
+        let t_pos = (end - 24).checked_sub(t_clen).ok_or_else(|| fst_err("bad time table"))?;
+        let t_raw = &blk[t_pos..end - 24];
+        let t_data = if t_clen != t_uclen { zlib_unpack(t_raw, t_uclen)? } else { t_raw.to_vec() };
+        let mut times = Vec::with_capacity(t_items);
+        let mut tc = Cursor::new(&t_data, 0);
+        let mut t = 0u64;
+        for _ in 0..t_items {
+            t = t.wrapping_add(tc.varint()?);
+            times.push(t as i64);
+        }
+
+        let mut chunk = Chunk { recs: Vec::new(), vals: String::new() };
+
+        // Frame: the values of all the signals at the block start
+        let mut c = Cursor::new(blk, pos + 32);
+        let f_uclen = c.varint()? as usize;
+        let f_clen = c.varint()? as usize;
+        let f_maxhandle = c.varint()? as usize;
+        let f_raw = c.bytes(f_clen)?;
+        if k == 0 {
+            let frame = if f_clen != f_uclen { zlib_unpack(f_raw, f_uclen)? } else { f_raw.to_vec() };
+            let mut f = Cursor::new(&frame, 0);
+            for hd in 0..f_maxhandle.min(self.lens.len()) {
+                let n = self.lens[hd] as usize;
+                let v = f.bytes(n)?;
+                let sig = ids.get(hd).copied().unwrap_or(u32::MAX);
+                if sig == u32::MAX || n == 0 {
                     continue;
                 }
-                derived.push(Change {
-                    t,
-                    val: if val_a != val_b { "1".to_string() } else { "0".to_string() },
-                });
+                if self.real[hd] {
+                    chunk.push(sig, beg, &format_real(v, self.double_le));
+                } else if n == 1 {
+                    chunk.push(sig, beg, &(v[0].to_ascii_lowercase() as char).to_string());
+                } else {
+                    chunk.push(sig, beg, &String::from_utf8_lossy(v));
+                }
             }
-            if derived.is_empty() {
+        }
+
+        let vc_maxhandle = c.varint()? as usize;
+        let vc_start = c.p;
+        let pack = c.u8()?;
+
+        // Position table: per handle, the offset of its data from vc_start
+        let chain_pos = (t_pos).checked_sub(8).ok_or_else(|| fst_err("bad position table"))?;
+        let chain_len = u64be_at(blk, chain_pos)? as usize;
+        let indx_pos = chain_pos.checked_sub(chain_len).ok_or_else(|| fst_err("bad position table"))?;
+        let mut offs: Vec<i64> = vec![0; vc_maxhandle + 1];
+        let mut lens: Vec<i64> = vec![0; vc_maxhandle + 1];
+        let mut ch = Cursor::new(&blk[..chain_pos], indx_pos);
+        let (mut idx, mut pidx, mut pval) = (0usize, 0usize, 0i64);
+        let mut prev_alias = 0i64;
+        while !ch.done() && idx < vc_maxhandle {
+            if typ == FST_BL_VCDATA_DYN_ALIAS2 {
+                if ch.b[ch.p] & 1 != 0 {
+                    let shval = ch.svarint()? >> 1;
+                    if shval > 0 {
+                        pval += shval;
+                        offs[idx] = pval;
+                        if idx != 0 {
+                            lens[pidx] = pval - offs[pidx];
+                        }
+                        pidx = idx;
+                    } else {
+                        if shval < 0 {
+                            prev_alias = shval;
+                        }
+                        lens[idx] = prev_alias;
+                    }
+                    idx += 1;
+                } else {
+                    idx += (ch.varint()? >> 1) as usize;
+                }
+            } else {
+                let val = ch.varint()? as i64;
+                if val == 0 {
+                    lens[idx] = -(ch.varint()? as i64);
+                    idx += 1;
+                } else if val & 1 != 0 {
+                    pval += val >> 1;
+                    offs[idx] = pval;
+                    if idx != 0 {
+                        lens[pidx] = pval - offs[pidx];
+                    }
+                    pidx = idx;
+                    idx += 1;
+                } else {
+                    idx += (val >> 1) as usize;
+                }
+            }
+        }
+        let idx = idx.min(vc_maxhandle);
+        offs[idx] = (indx_pos - vc_start) as i64;
+        lens[pidx] = offs[idx] - offs[pidx];
+        for i in 0..idx {
+            if lens[i] < 0 && offs[i] == 0 {
+                let a = (-(lens[i] + 1)) as usize; // aliased handle - 1
+                if a < idx {
+                    offs[i] = offs[a];
+                    lens[i] = lens[a];
+                }
+            }
+        }
+
+        // Value changes of the selected handles
+        for hd in 0..idx.min(self.lens.len()) {
+            let sig = ids.get(hd).copied().unwrap_or(u32::MAX);
+            if sig == u32::MAX || offs[hd] <= 0 || lens[hd] <= 0 {
                 continue;
             }
-            let new_vid = format!("__derived__{}.{}_ne_{}", parent, leaf_a, leaf_b);
-            let name = format!("{}.busy_derived({}!={})", parent, leaf_a, leaf_b);
-            new_signals.push((new_vid, Signal { name, vtype: "wire".to_string(), width: 1 }, derived));
+            let a = vc_start + offs[hd] as usize;
+            let b = a + lens[hd] as usize;
+            if b > indx_pos {
+                return Err(fst_err("bad value-change offset"));
+            }
+            let mut c = Cursor::new(&blk[..b], a);
+            let ulen = c.varint()? as usize;
+            let raw = c.bytes(b - c.p)?;
+            let vc = if ulen != 0 { vc_unpack(raw, ulen, pack)? } else { raw.to_vec() };
+            self.parse_changes(&vc, hd, sig, &times, &mut chunk)?;
         }
+
+        // Signals come one after the other: restore time order
+        chunk.recs.sort_by_key(|r| r.t);
+        Ok(chunk)
     }
 
-    let n = new_signals.len();
-    for (vid, sig, ch) in new_signals {
-        signals.insert(vid.clone(), sig);
-        changes.insert(vid, ch);
+    fn parse_changes(&self, vc: &[u8], hd: usize, sig: u32, times: &[i64], chunk: &mut Chunk) -> io::Result<()> {
+        let n = self.lens[hd] as usize;
+        let mut c = Cursor::new(vc, 0);
+        let mut ti = 0usize;
+        let mut bits = String::new();
+        while !c.done() {
+            let vli = c.varint()? as usize;
+            if n == 1 && !self.real[hd] {
+                let v = if vli & 1 == 0 {
+                    ti += vli >> 2;
+                    b'0' + ((vli >> 1) & 1) as u8
+                } else {
+                    ti += vli >> 4;
+                    FST_RCV_STR[(vli >> 1) & 7]
+                };
+                let t = *times.get(ti).ok_or_else(|| fst_err("bad time index"))?;
+                chunk.push(sig, t, char::from(v).encode_utf8(&mut [0; 4]));
+                continue;
+            }
+            ti += vli >> 1;
+            let t = *times.get(ti).ok_or_else(|| fst_err("bad time index"))?;
+            if self.real[hd] {
+                chunk.push(sig, t, &format_real(c.bytes(8)?, self.double_le));
+            } else if n == 0 {
+                let len = c.varint()? as usize;
+                push_fst_string(chunk, sig, t, c.bytes(len)?);
+            } else if vli & 1 == 0 {
+                // bit-packed, MSB first
+                let packed = c.bytes(n.div_ceil(8))?;
+                bits.clear();
+                for j in 0..n {
+                    bits.push(if packed[j / 8] >> (7 - (j & 7)) & 1 != 0 { '1' } else { '0' });
+                }
+                chunk.push(sig, t, &bits);
+            } else {
+                chunk.push(sig, t, &String::from_utf8_lossy(c.bytes(n)?));
+            }
+        }
+        Ok(())
+    }
+}
+
+// --------------------------------------------------------------------------
+// Input selection: VCD or FST, detected from the file contents
+// --------------------------------------------------------------------------
+
+enum Input {
+    Vcd { ids: HashMap<Vec<u8>, u32> },
+    Fst { fst: FstFile, ids: Vec<u32> },
+}
+
+struct Trace {
+    signals: IndexMap<String, Signal>,
+    ps_per_tick: f64,
+    chunks: Vec<(usize, usize)>, // input range of each chunk
+    input: Input,
+}
+
+fn open_trace(data: &[u8], inc: Option<&Regex>, exc: Option<&Regex>) -> io::Result<Trace> {
+    if is_fst(data) {
+        let (signals, ps_per_tick, fst) = open_fst(data, inc, exc)?;
+        let mut ids = vec![u32::MAX; fst.lens.len()];
+        for (i, vid) in signals.keys().enumerate() {
+            let hd = vid.parse::<usize>().unwrap_or(0);
+            if hd >= 1 && hd <= ids.len() {
+                ids[hd - 1] = i as u32;
+            }
+        }
+        let mut chunks = Vec::with_capacity(fst.vc_blocks.len());
+        for &(pos, _) in &fst.vc_blocks {
+            chunks.push((pos, pos + u64be_at(data, pos)? as usize));
+        }
+        Ok(Trace { signals, ps_per_tick, chunks, input: Input::Fst { fst, ids } })
+    } else {
+        let VcdHeader { signals, ps_per_tick, body } = parse_vcd_header(data, inc, exc);
+        let ids = signals.keys().enumerate().map(|(i, vid)| (vid.as_bytes().to_vec(), i as u32)).collect();
+        Ok(Trace { signals, ps_per_tick, chunks: split_chunks(data, body, CHUNK_BYTES), input: Input::Vcd { ids } })
+    }
+}
+
+impl Input {
+    fn parse(&self, data: &[u8], chunks: &[(usize, usize)], i: usize) -> io::Result<Chunk> {
+        match self {
+            Input::Vcd { ids } => Ok(parse_chunk(&data[chunks[i].0..chunks[i].1], ids)),
+            Input::Fst { fst, ids } => fst.parse_block(data, i, ids),
+        }
+    }
+}
+
+// --------------------------------------------------------------------------
+// --derive-busy: synthesize a busy pseudo-signal from a pair of siblings.
+// --------------------------------------------------------------------------
+
+// One LEAF_A,LEAF_B pair found under a common parent; the value of the
+// pseudo-signal is streamed chunk by chunk.
+struct Derived {
+    vid: String,
+    name: String,
+    sig_a: u32,
+    sig_b: u32,
+    val_a: Option<u128>,
+    val_b: Option<u128>,
+}
+
+impl Derived {
+    // Match the specs against the selected signals, in signals insertion order.
+    fn find(signals: &IndexMap<String, Signal>, specs: &[(String, String)]) -> Vec<Derived> {
+        // parent path -> {leaf -> signal index}
+        let mut by_parent: IndexMap<String, IndexMap<String, u32>> = IndexMap::new();
+        for (i, sig) in signals.values().enumerate() {
+            let (parent, leaf) = match sig.name.rsplit_once('.') {
+                Some((p, l)) => (p.to_string(), l.to_string()),
+                None => (String::new(), sig.name.clone()),
+            };
+            by_parent.entry(parent).or_default().insert(leaf, i as u32);
+        }
+
+        let mut found = Vec::new();
+        for (leaf_a, leaf_b) in specs {
+            for (parent, leaves) in by_parent.iter() {
+                if let (Some(&sig_a), Some(&sig_b)) = (leaves.get(leaf_a), leaves.get(leaf_b)) {
+                    found.push(Derived {
+                        vid: format!("__derived__{}.{}_ne_{}", parent, leaf_a, leaf_b),
+                        name: format!("{}.busy_derived({}!={})", parent, leaf_a, leaf_b),
+                        sig_a,
+                        sig_b,
+                        val_a: None,
+                        val_b: None,
+                    });
+                }
+            }
+        }
+        found
+    }
+
+    // Changes of the pseudo-signal within `chunk`: busy while both siblings
+    // have a value and the two differ.
+    fn step(&mut self, chunk: &Chunk, out: &mut Vec<(i64, bool)>) {
+        out.clear();
+        let mut merged: Vec<(i64, u8, &str)> = chunk
+            .recs
+            .iter()
+            .filter(|r| r.sig == self.sig_a || r.sig == self.sig_b)
+            .map(|r| (r.t, (r.sig == self.sig_b) as u8, chunk.val(r)))
+            .collect();
+        merged.sort_by(|x, y| x.0.cmp(&y.0).then(x.1.cmp(&y.1)).then(x.2.cmp(y.2)));
+
+        for (t, which, v) in merged {
+            let nv = parse_bits_or_int0(v);
+            if which == 0 {
+                self.val_a = nv;
+            } else {
+                self.val_b = nv;
+            }
+            if self.val_a.is_none() || self.val_b.is_none() {
+                continue;
+            }
+            out.push((t, self.val_a != self.val_b));
+        }
     }
-    n
 }
 
 // --------------------------------------------------------------------------
 // --state-map parsing
 // --------------------------------------------------------------------------
 
-fn parse_state_map_arg(spec: &str) -> (Regex, HashMap<u128, String>) {
-    let (leaf, mapspec) = spec.split_once('=').expect("--state-map expects 'LEAF=V:NAME,...'");
+fn parse_state_map_arg(spec: &str) -> Result<(Regex, HashMap<u128, String>), String> {
+    let (leaf, mapspec) =
+        spec.split_once('=').ok_or_else(|| format!("--state-map expects 'LEAF=V:NAME,...' (got {:?})", spec))?;
     let mut m = HashMap::new();
     for token in mapspec.split(',') {
-        let (v, name) = token.split_once(':').expect("--state-map token expects 'V:NAME'");
-        let key = parse_int0(v).expect("--state-map value must be an integer");
+        let (v, name) =
+            token.split_once(':').ok_or_else(|| format!("--state-map token expects 'V:NAME' (got {:?})", token))?;
+        let key = parse_int0(v).ok_or_else(|| format!("--state-map value must be an integer (got {:?})", v))?;
         m.insert(key, name.to_string());
     }
-    (Regex::new(leaf).expect("invalid --state-map leaf regex"), m)
+    let re = Regex::new(leaf).map_err(|e| format!("invalid --state-map leaf regex {:?}: {}", leaf, e))?;
+    Ok((re, m))
 }
 
 // --------------------------------------------------------------------------
-// convert(): signals + changes -> flat event IR
+// convert: value changes -> flat event IR
 // --------------------------------------------------------------------------
 
 struct Converter<'a> {
@@ -511,24 +1331,49 @@ impl<'a> Converter<'a> {
     }
 }
 
-fn convert(
+// How the changes of a signal become events.
+enum Kind {
+    Asm,          // --split-asm instruction slices
+    Hex,          // pc value slices (plus --symbolize function slices)
+    State(usize), // --state-map slices, index in the state maps
+    Str,          // string value slices
+    Bit,          // slices while the 1-bit signal is high
+    Counter,      // multi-bit counter samples
+}
+
+// Conversion state of one signal, carried across chunks.
+struct SigConv {
+    pid: i64,
+    tid: i64,
+    tid_fn: Option<i64>, // --symbolize companion track
+    kind: Kind,
+    leaf: String,
+    nibbles: usize,
+    open: bool,
+    cur_fn: Option<String>,
+    last_t: i64,
+}
+
+// Allocate the processes and tracks of every signal that has changes, in
+// signals order, and return their metadata events with the per-signal
+// conversion state.
+fn plan(
     signals: &IndexMap<String, Signal>,
-    changes: &HashMap<String, Vec<Change>>,
-    ps: f64,
+    seen: &[bool],
     pid_depth: usize,
     state_maps: &[(Regex, HashMap<u128, String>)],
     renames: &HashMap<String, String>,
     split_asm: bool,
     symbols: Option<&SymTable>,
-) -> Vec<Event> {
+) -> (Vec<Option<SigConv>>, Vec<Event>) {
     let mut conv = Converter::new(pid_depth, renames);
-    let us = |t: i64| -> f64 { t as f64 * ps / 1e6 };
+    let mut plans = Vec::with_capacity(signals.len());
 
-    for (vid, sig) in signals.iter() {
-        let tv = match changes.get(vid) {
-            Some(v) if !v.is_empty() => v,
-            _ => continue,
-        };
+    for (i, sig) in signals.values().enumerate() {
+        if !seen[i] {
+            plans.push(None);
+            continue;
+        }
         let parts: Vec<&str> = sig.name.split('.').collect();
         let pid = conv.get_pid(&parts);
         let sub = {
@@ -540,172 +1385,179 @@ fn convert(
             }
         };
         let leaf = parts[parts.len() - 1];
+        let mut sc = SigConv {
+            pid,
+            tid: 0,
+            tid_fn: None,
+            kind: Kind::Counter,
+            leaf: leaf.to_string(),
+            nibbles: ((sig.width + 3) / 4) as usize,
+            open: false,
+            cur_fn: None,
+            last_t: 0,
+        };
 
         // --split-asm: 'asm' string signal -> '<parent>.instruction' track.
         if split_asm && sig.vtype == "string" && leaf == "asm" {
             let base = sub.rsplit_once('.').map(|x| x.0).unwrap_or("");
             let ins_label =
                 if !base.is_empty() { format!("{}.instruction", base) } else { "instruction".to_string() };
-            let tid_ins = conv.get_tid(pid, &ins_label);
-            let mut open = false;
-            for ch in tv {
-                let ts = us(ch.t);
-                if open {
-                    conv.events.push(Event::End { pid, tid: tid_ins, ts });
-                    open = false;
-                }
-                if !is_idle(&ch.val) {
-                    let tail = ch.val.get(8..).unwrap_or("");
-                    let instr = tail.trim_matches('_').replace('_', " ");
-                    if !instr.is_empty() {
-                        conv.events.push(Event::Begin { pid, tid: tid_ins, ts, name: instr });
-                        open = true;
-                    }
-                }
-            }
-            if open {
-                let ts = us(tv.last().unwrap().t + 1);
-                conv.events.push(Event::End { pid, tid: tid_ins, ts });
-            }
+            sc.tid = conv.get_tid(pid, &ins_label);
+            sc.kind = Kind::Asm;
+            plans.push(Some(sc));
             continue;
         }
 
-        let tid = conv.get_tid(pid, &sub);
-        let state_map = state_maps.iter().find(|(re, _)| re.is_match(leaf)).map(|(_, m)| m);
+        sc.tid = conv.get_tid(pid, &sub);
+        let state_map = state_maps.iter().position(|(re, _)| re.is_match(leaf));
 
         if is_hex_leaf(leaf) && sig.vtype != "string" {
             // --symbolize: derive a companion '<parent>.function' track that maps
             // each pc value onto the enclosing symbol from the disassembly,
             // merging consecutive same-function samples into a single slice.
-            if let Some(symtab) = symbols {
+            if symbols.is_some() {
                 let base = sub.rsplit_once('.').map(|x| x.0).unwrap_or("");
                 let fn_label =
                     if !base.is_empty() { format!("{}.function", base) } else { "function".to_string() };
-                let tid_fn = conv.get_tid(pid, &fn_label);
-                let mut cur: Option<&str> = None;
-                for ch in tv {
-                    let num = match parse_bits_or_int0(&ch.val) {
-                        Some(n) => n,
-                        None => continue,
-                    };
-                    let name = symtab.lookup(num);
-                    if name == cur {
-                        continue;
-                    }
-                    let ts = us(ch.t);
-                    if cur.is_some() {
-                        conv.events.push(Event::End { pid, tid: tid_fn, ts });
-                    }
-                    if let Some(n) = name {
-                        conv.events.push(Event::Begin { pid, tid: tid_fn, ts, name: n.to_string() });
-                    }
-                    cur = name;
+                sc.tid_fn = Some(conv.get_tid(pid, &fn_label));
+            }
+            sc.kind = Kind::Hex;
+        } else if let Some(m) = state_map {
+            sc.kind = Kind::State(m);
+        } else if sig.vtype == "string" {
+            sc.kind = Kind::Str;
+        } else if sig.width == 1 {
+            sc.kind = Kind::Bit;
+        }
+        plans.push(Some(sc));
+    }
+
+    (plans, conv.events)
+}
+
+impl SigConv {
+    // Convert one value change, appending the resulting events to `out`.
+    fn change(
+        &mut self,
+        t: i64,
+        val: &str,
+        ps: f64,
+        state_maps: &[(Regex, HashMap<u128, String>)],
+        symbols: Option<&SymTable>,
+        out: &mut Vec<Event>,
+    ) {
+        let (pid, tid) = (self.pid, self.tid);
+        let ts = t as f64 * ps / 1e6;
+        self.last_t = t;
+
+        match self.kind {
+            Kind::Asm => {
+                if self.open {
+                    out.push(Event::End { pid, tid, ts });
+                    self.open = false;
                 }
-                if cur.is_some() {
-                    let ts = us(tv.last().unwrap().t + 1);
-                    conv.events.push(Event::End { pid, tid: tid_fn, ts });
+                if !is_idle(val) {
+                    let tail = val.get(8..).unwrap_or("");
+                    let instr = tail.trim_matches('_').replace('_', " ");
+                    if !instr.is_empty() {
+                        out.push(Event::Begin { pid, tid, ts, name: instr });
+                        self.open = true;
+                    }
                 }
             }
-
-            let nibbles = ((sig.width + 3) / 4) as usize;
-            let mut open = false;
-            for ch in tv {
-                let num = match parse_bits_or_int0(&ch.val) {
+            Kind::Hex => {
+                let num = match parse_bits_or_int0(val) {
                     Some(n) => n,
-                    None => continue,
+                    None => return,
                 };
-                let ts = us(ch.t);
-                if open {
-                    conv.events.push(Event::End { pid, tid, ts });
+                if let (Some(symtab), Some(tid_fn)) = (symbols, self.tid_fn) {
+                    let name = symtab.lookup(num);
+                    if name != self.cur_fn.as_deref() {
+                        if self.cur_fn.is_some() {
+                            out.push(Event::End { pid, tid: tid_fn, ts });
+                        }
+                        if let Some(n) = name {
+                            out.push(Event::Begin { pid, tid: tid_fn, ts, name: n.to_string() });
+                        }
+                        self.cur_fn = name.map(|n| n.to_string());
+                    }
+                }
+                if self.open {
+                    out.push(Event::End { pid, tid, ts });
                 }
-                conv.events.push(Event::Begin {
+                out.push(Event::Begin {
                     pid,
                     tid,
                     ts,
-                    name: format!("0x{:0width$x}", num, width = nibbles),
+                    name: format!("0x{:0width$x}", num, width = self.nibbles),
                 });
-                open = true;
-            }
-            if open {
-                let ts = us(tv.last().unwrap().t + 1);
-                conv.events.push(Event::End { pid, tid, ts });
+                self.open = true;
             }
-        } else if let Some(map) = state_map {
-            let mut open = false;
-            for ch in tv {
-                let num = match parse_bits_or_int0(&ch.val) {
+            Kind::State(m) => {
+                let num = match parse_bits_or_int0(val) {
                     Some(n) => n,
-                    None => continue,
+                    None => return,
                 };
-                let ts = us(ch.t);
+                let map = &state_maps[m].1;
                 let state_name = map.get(&num).cloned().unwrap_or_else(|| format!("state{}", num));
-                if open {
-                    conv.events.push(Event::End { pid, tid, ts });
-                    open = false;
+                if self.open {
+                    out.push(Event::End { pid, tid, ts });
+                    self.open = false;
                 }
                 if !is_idle(&state_name) {
-                    conv.events.push(Event::Begin { pid, tid, ts, name: state_name });
-                    open = true;
+                    out.push(Event::Begin { pid, tid, ts, name: state_name });
+                    self.open = true;
                 }
             }
-            if open {
-                let ts = us(tv.last().unwrap().t + 1);
-                conv.events.push(Event::End { pid, tid, ts });
-            }
-        } else if sig.vtype == "string" {
-            let mut open = false;
-            for ch in tv {
-                let ts = us(ch.t);
-                if open {
-                    conv.events.push(Event::End { pid, tid, ts });
-                    open = false;
+            Kind::Str => {
+                if self.open {
+                    out.push(Event::End { pid, tid, ts });
+                    self.open = false;
                 }
-                if !is_idle(&ch.val) {
-                    conv.events.push(Event::Begin { pid, tid, ts, name: ch.val.clone() });
-                    open = true;
+                if !is_idle(val) {
+                    out.push(Event::Begin { pid, tid, ts, name: val.to_string() });
+                    self.open = true;
                 }
             }
-            if open {
-                let ts = us(tv.last().unwrap().t + 1);
-                conv.events.push(Event::End { pid, tid, ts });
-            }
-        } else if sig.width == 1 {
-            let mut open = false;
-            for ch in tv {
-                let ts = us(ch.t);
-                if ch.val == "1" && !open {
-                    conv.events.push(Event::Begin { pid, tid, ts, name: leaf.to_string() });
-                    open = true;
-                } else if ch.val != "1" && open {
-                    conv.events.push(Event::End { pid, tid, ts });
-                    open = false;
+            Kind::Bit => {
+                if val == "1" && !self.open {
+                    out.push(Event::Begin { pid, tid, ts, name: self.leaf.clone() });
+                    self.open = true;
+                } else if val != "1" && self.open {
+                    out.push(Event::End { pid, tid, ts });
+                    self.open = false;
                 }
             }
-            if open {
-                let ts = us(tv.last().unwrap().t + 1);
-                conv.events.push(Event::End { pid, tid, ts });
+            Kind::Counter => {
+                if let Some(num) = counter_value(val) {
+                    out.push(Event::Counter { pid, tid, ts, name: self.leaf.clone(), val: num });
+                }
             }
-        } else {
-            // multi-bit -> counter track
-            for ch in tv {
-                let ts = us(ch.t);
-                let num = if is_bits(&ch.val) {
-                    match u128::from_str_radix(&ch.val, 2) {
-                        Ok(n) => Num::I(n),
-                        Err(_) => continue,
-                    }
-                } else {
-                    match ch.val.parse::<f64>() {
-                        Ok(x) => Num::F(x),
-                        Err(_) => continue,
-                    }
-                };
-                conv.events.push(Event::Counter { pid, tid, ts, name: leaf.to_string(), val: num });
+        }
+    }
+
+    // Close the slices still open one tick after the last change.
+    fn finish(&mut self, ps: f64, out: &mut Vec<Event>) {
+        let ts = (self.last_t + 1) as f64 * ps / 1e6;
+        if let Some(tid_fn) = self.tid_fn {
+            if self.cur_fn.take().is_some() {
+                out.push(Event::End { pid: self.pid, tid: tid_fn, ts });
             }
         }
+        if self.open {
+            out.push(Event::End { pid: self.pid, tid: self.tid, ts });
+            self.open = false;
+        }
     }
+}
 
-    conv.events
+// Sample of a multi-bit signal, None if the value does not parse.
+fn counter_value(val: &str) -> Option<Num> {
+    if is_bits(val) {
+        u128::from_str_radix(val, 2).ok().map(Num::I)
+    } else {
+        val.parse::<f64>().ok().map(Num::F)
+    }
 }
 
 // --------------------------------------------------------------------------
@@ -762,265 +1614,277 @@ const EV_COUNTER: u64 = 4;
 const ORDER_EXPLICIT: u64 = 3;
 const SEQ_STRUCT: u64 = 1;
 
-enum Ek {
-    B(String),
-    E,
-    C(Num),
+// Bytes of encoded output buffered before they are handed to the file.
+const OUT_BUFFER: usize = 1 << 20;
+
+fn round_ns(ts_us: f64) -> i64 {
+    (ts_us * 1000.0).round_ties_even() as i64
 }
 
-struct TrackData {
-    label: String,
-    counter: bool,
-    events: Vec<(i64, Ek)>,
+// Output file, optionally gzip-compressed.
+enum Output {
+    Plain(BufWriter<File>),
+    Gzip(GzEncoder<BufWriter<File>>),
 }
 
-fn round_ns(ts_us: f64) -> i64 {
-    (ts_us * 1000.0).round_ties_even() as i64
+impl Output {
+    fn create(path: &str, gzip_out: bool) -> io::Result<Output> {
+        let f = BufWriter::new(File::create(path)?);
+        Ok(if gzip_out { Output::Gzip(GzEncoder::new(f, Compression::default())) } else { Output::Plain(f) })
+    }
+
+    fn write_all(&mut self, data: &[u8]) -> io::Result<()> {
+        match self {
+            Output::Plain(w) => w.write_all(data),
+            Output::Gzip(w) => w.write_all(data),
+        }
+    }
+
+    fn finish(self) -> io::Result<()> {
+        match self {
+            Output::Plain(mut w) => w.flush(),
+            Output::Gzip(w) => w.finish()?.flush(),
+        }
+    }
+}
+
+// Emission state of one track: its data sequence, allocated on the first
+// event, and the slice names interned on it so far.
+struct TrackOut {
+    uuid: u64,
+    seq: u64,
+    iids: HashMap<String, u64>,
 }
 
-fn write_perfetto(events: &[Event], path: &str, intern: bool, gzip_out: bool) -> io::Result<()> {
-    // Group the flat IR by track, preserving first-seen order.
-    let mut procs: IndexMap<i64, (String, Option<i64>)> = IndexMap::new();
-    let mut tracks: IndexMap<(i64, i64), TrackData> = IndexMap::new();
+struct PerfettoWriter {
+    out: Output,
+    buf: Vec<u8>,
+    intern: bool,
+    tracks: HashMap<(i64, i64), TrackOut>,
+    counters: HashSet<(i64, i64)>,
+    next_seq: u64,
+}
 
-    for e in events {
-        match e {
-            Event::ProcName { pid, name, num } => {
-                procs.entry(*pid).or_insert_with(|| (name.clone(), *num));
-            }
-            Event::ThreadName { pid, tid, name } => {
-                tracks.entry((*pid, *tid)).or_insert_with(|| TrackData {
-                    label: name.clone(),
-                    counter: false,
-                    events: Vec::new(),
-                });
-            }
-            Event::Begin { pid, tid, ts, name } => {
-                let td = tracks.entry((*pid, *tid)).or_insert_with(|| TrackData {
-                    label: tid.to_string(),
-                    counter: false,
-                    events: Vec::new(),
-                });
-                td.events.push((round_ns(*ts), Ek::B(name.clone())));
-            }
-            Event::End { pid, tid, ts } => {
-                let td = tracks.entry((*pid, *tid)).or_insert_with(|| TrackData {
-                    label: tid.to_string(),
-                    counter: false,
-                    events: Vec::new(),
-                });
-                td.events.push((round_ns(*ts), Ek::E));
+impl PerfettoWriter {
+    // Open the output and declare every process and track up front, from the
+    // metadata events.
+    fn create(
+        path: &str,
+        gzip_out: bool,
+        intern: bool,
+        meta: &[Event],
+        counters: HashSet<(i64, i64)>,
+    ) -> io::Result<PerfettoWriter> {
+        let mut procs: IndexMap<i64, (String, Option<i64>)> = IndexMap::new();
+        let mut labels: IndexMap<(i64, i64), String> = IndexMap::new();
+        for e in meta {
+            match e {
+                Event::ProcName { pid, name, num } => {
+                    procs.entry(*pid).or_insert_with(|| (name.clone(), *num));
+                }
+                Event::ThreadName { pid, tid, name } => {
+                    labels.entry((*pid, *tid)).or_insert_with(|| name.clone());
+                }
+                _ => {}
             }
-            Event::Counter { pid, tid, ts, val, .. } => {
-                let td = tracks.entry((*pid, *tid)).or_insert_with(|| TrackData {
-                    label: tid.to_string(),
-                    counter: false,
-                    events: Vec::new(),
-                });
-                td.counter = true;
-                td.events.push((round_ns(*ts), Ek::C(val.clone())));
+        }
+
+        // Allocate uuids: root, then procs (insertion order), then tracks (order).
+        let mut uid = 0u64;
+        let mut alloc = || {
+            uid += 1;
+            uid
+        };
+        let root_uuid = alloc();
+        let mut proc_uuid: HashMap<i64, u64> = HashMap::new();
+        for pid in procs.keys() {
+            proc_uuid.insert(*pid, alloc());
+        }
+        let mut tracks: HashMap<(i64, i64), TrackOut> = HashMap::new();
+        for key in labels.keys() {
+            tracks.insert(*key, TrackOut { uuid: alloc(), seq: 0, iids: HashMap::new() });
+        }
+
+        // Root name = common leading dotted prefix of all group display names.
+        let split_names: Vec<Vec<&str>> = procs.values().map(|(n, _)| n.split('.').collect()).collect();
+        let mut common: Vec<&str> = Vec::new();
+        if !split_names.is_empty() {
+            let minlen = split_names.iter().map(|s| s.len()).min().unwrap();
+            for i in 0..minlen {
+                let c0 = split_names[0][i];
+                if split_names.iter().all(|s| s[i] == c0) {
+                    common.push(c0);
+                } else {
+                    break;
+                }
             }
         }
-    }
+        let root_name = if common.is_empty() { "trace".to_string() } else { common.join(".") };
+        let strip = if common.is_empty() { String::new() } else { format!("{}.", root_name) };
 
-    // Allocate uuids: root, then procs (insertion order), then tracks (order).
-    let mut uid = 0i64;
-    let mut alloc = || {
-        uid += 1;
-        uid
-    };
-    let root_uuid = alloc();
-    let mut proc_uuid: HashMap<i64, i64> = HashMap::new();
-    for pid in procs.keys() {
-        proc_uuid.insert(*pid, alloc());
-    }
-    let mut track_uuid: HashMap<(i64, i64), i64> = HashMap::new();
-    for key in tracks.keys() {
-        track_uuid.insert(*key, alloc());
-    }
-
-    // Root name = common leading dotted prefix of all group display names.
-    let split_names: Vec<Vec<&str>> = procs.values().map(|(n, _)| n.split('.').collect()).collect();
-    let mut common: Vec<&str> = Vec::new();
-    if !split_names.is_empty() {
-        let minlen = split_names.iter().map(|s| s.len()).min().unwrap();
-        for i in 0..minlen {
-            let c0 = split_names[0][i];
-            if split_names.iter().all(|s| s[i] == c0) {
-                common.push(c0);
-            } else {
-                break;
+        let group_name_and_rank = |name: &str, num: Option<i64>, unnumbered_idx: i64| -> (String, i64) {
+            let mut short = name;
+            if !strip.is_empty() && short.starts_with(strip.as_str()) {
+                short = &short[strip.len()..];
             }
-        }
-    }
-    let root_name = if common.is_empty() { "trace".to_string() } else { common.join(".") };
-    let strip = if common.is_empty() { String::new() } else { format!("{}.", root_name) };
+            let short = if short.is_empty() { name.rsplit('.').next().unwrap() } else { short };
+            match num {
+                Some(n) => (format!("{} {}", short, n), n),
+                None => (short.to_string(), 1_000_000 + unnumbered_idx),
+            }
+        };
+
+        let mut w = PerfettoWriter {
+            out: Output::create(path, gzip_out)?,
+            buf: Vec::with_capacity(OUT_BUFFER + 4096),
+            intern,
+            tracks,
+            counters,
+            next_seq: 2,
+        };
 
-    let group_name_and_rank = |name: &str, num: Option<i64>, unnumbered_idx: i64| -> (String, i64) {
-        let mut short = name;
-        if !strip.is_empty() && short.starts_with(strip.as_str()) {
-            short = &short[strip.len()..];
+        // --- structure sequence: declare every track up front ---
+        // Root TrackDescriptor{uuid, name, child_ordering=EXPLICIT}
+        {
+            let mut td = Vec::new();
+            pv(&mut td, 1, root_uuid);
+            ps(&mut td, 2, &root_name);
+            pv(&mut td, 11, ORDER_EXPLICIT);
+            let mut pkt = Vec::new();
+            pb(&mut pkt, 60, &td);
+            pv(&mut pkt, 10, SEQ_STRUCT);
+            emit(&mut w.buf, &pkt);
         }
-        let short = if short.is_empty() { name.rsplit('.').next().unwrap() } else { short };
-        match num {
-            Some(n) => (format!("{} {}", short, n), n),
-            None => (short.to_string(), 1_000_000 + unnumbered_idx),
+        let mut unnumbered = 0i64;
+        for (pid, (name, num)) in &procs {
+            let (gname, rank) = group_name_and_rank(name, *num, unnumbered);
+            if num.is_none() {
+                unnumbered += 1;
+            }
+            let mut td = Vec::new();
+            pv(&mut td, 1, proc_uuid[pid]);
+            ps(&mut td, 2, &gname);
+            pv(&mut td, 5, root_uuid);
+            pv(&mut td, 12, rank as u64);
+            let mut pkt = Vec::new();
+            pb(&mut pkt, 60, &td);
+            pv(&mut pkt, 10, SEQ_STRUCT);
+            emit(&mut w.buf, &pkt);
         }
-    };
-
-    let mut out: Vec<u8> = Vec::with_capacity(events.len() * 12 + 4096);
-
-    // --- structure sequence: declare every track up front ---
-    // Root TrackDescriptor{uuid, name, child_ordering=EXPLICIT}
-    {
-        let mut td = Vec::new();
-        pv(&mut td, 1, root_uuid as u64);
-        ps(&mut td, 2, &root_name);
-        pv(&mut td, 11, ORDER_EXPLICIT);
-        let mut pkt = Vec::new();
-        pb(&mut pkt, 60, &td);
-        pv(&mut pkt, 10, SEQ_STRUCT);
-        emit(&mut out, &pkt);
-    }
-    let mut unnumbered = 0i64;
-    for (pid, (name, num)) in &procs {
-        let (gname, rank) = group_name_and_rank(name, *num, unnumbered);
-        if num.is_none() {
-            unnumbered += 1;
-        }
-        let mut td = Vec::new();
-        pv(&mut td, 1, proc_uuid[pid] as u64);
-        ps(&mut td, 2, &gname);
-        pv(&mut td, 5, root_uuid as u64);
-        pv(&mut td, 12, rank as u64);
-        let mut pkt = Vec::new();
-        pb(&mut pkt, 60, &td);
-        pv(&mut pkt, 10, SEQ_STRUCT);
-        emit(&mut out, &pkt);
-    }
-    for (key, tr) in &tracks {
-        let mut td = Vec::new();
-        pv(&mut td, 1, track_uuid[key] as u64);
-        ps(&mut td, 2, &tr.label);
-        pv(&mut td, 5, proc_uuid[&key.0] as u64);
-        if tr.counter {
-            pb(&mut td, 8, &[]); // empty CounterDescriptor marks a counter track
+        for (key, label) in &labels {
+            let mut td = Vec::new();
+            pv(&mut td, 1, w.tracks[key].uuid);
+            ps(&mut td, 2, label);
+            pv(&mut td, 5, proc_uuid[&key.0]);
+            if w.counters.contains(key) {
+                pb(&mut td, 8, &[]); // empty CounterDescriptor marks a counter track
+            }
+            let mut pkt = Vec::new();
+            pb(&mut pkt, 60, &td);
+            pv(&mut pkt, 10, SEQ_STRUCT);
+            emit(&mut w.buf, &pkt);
         }
-        let mut pkt = Vec::new();
-        pb(&mut pkt, 60, &td);
-        pv(&mut pkt, 10, SEQ_STRUCT);
-        emit(&mut out, &pkt);
+        w.flush(false)?;
+        Ok(w)
     }
 
-    // --- one data sequence per track ---
-    let total_events: u64 = tracks.values().map(|tr| tr.events.len() as u64).sum();
-    let progress = ProgressBar::new(total_events);
-    progress.set_style(
-        ProgressStyle::with_template(
-            "{spinner} [{elapsed_precise}] [{bar:40}] {pos}/{len} events ({eta})",
-        )
-        .unwrap()
-        .progress_chars("=> "),
-    );
-    let mut seq = 2u64;
-    for (key, tr) in &tracks {
-        if tr.events.is_empty() {
-            continue;
+    fn flush(&mut self, force: bool) -> io::Result<()> {
+        if force || self.buf.len() >= OUT_BUFFER {
+            self.out.write_all(&self.buf)?;
+            self.buf.clear();
         }
-        let tu = track_uuid[key] as u64;
-        let sid = seq;
-        seq += 1;
-
-        let mut iid_of: IndexMap<&str, u64> = IndexMap::new();
-        if intern && !tr.counter {
-            for (_, ek) in &tr.events {
-                if let Ek::B(name) = ek {
-                    if !iid_of.contains_key(name.as_str()) {
-                        let i = iid_of.len() as u64 + 1;
-                        iid_of.insert(name.as_str(), i);
-                    }
-                }
-            }
-            if !iid_of.is_empty() {
-                let mut interned = Vec::new();
-                for (n, i) in &iid_of {
-                    let mut inner = Vec::new();
-                    pv(&mut inner, 1, *i);
-                    ps(&mut inner, 2, n);
-                    pb(&mut interned, 2, &inner); // InternedData.event_names -> EventName{iid,name}
-                }
-                let mut pkt = Vec::new();
-                pb(&mut pkt, 12, &interned);
-                pv(&mut pkt, 10, sid);
-                pv(&mut pkt, 13, SEQ_CLEARED);
-                emit(&mut out, &pkt);
-            }
+        Ok(())
+    }
+
+    // Encode one track event; every track gets its own data sequence.
+    fn event(&mut self, e: &Event) -> io::Result<()> {
+        let (key, ts) = match e {
+            Event::Begin { pid, tid, ts, .. }
+            | Event::End { pid, tid, ts }
+            | Event::Counter { pid, tid, ts, .. } => ((*pid, *tid), *ts),
+            _ => return Ok(()),
+        };
+        let counter = self.counters.contains(&key);
+        let intern = self.intern && !counter;
+        let tr = match self.tracks.get_mut(&key) {
+            Some(tr) => tr,
+            None => return Ok(()),
+        };
+        if tr.seq == 0 {
+            tr.seq = self.next_seq;
+            self.next_seq += 1;
         }
-        let use_iid = !iid_of.is_empty();
+        let (tu, sid) = (tr.uuid, tr.seq);
+        let ts_u = round_ns(ts) as u64;
 
-        for (ts, ek) in &tr.events {
-            let ts_u = *ts as u64;
-            let mut pkt = Vec::new();
-            match ek {
-                Ek::B(name) => {
-                    let mut te = Vec::new();
-                    pv(&mut te, 9, EV_BEGIN);
-                    pv(&mut te, 11, tu);
-                    if use_iid {
-                        pv(&mut te, 10, iid_of[name.as_str()]);
-                        pv(&mut pkt, 8, ts_u);
-                        pb(&mut pkt, 11, &te);
-                        pv(&mut pkt, 10, sid);
-                        pv(&mut pkt, 13, SEQ_NEEDS);
-                    } else {
-                        ps(&mut te, 23, name);
-                        pv(&mut pkt, 8, ts_u);
-                        pb(&mut pkt, 11, &te);
-                        pv(&mut pkt, 10, sid);
-                    }
-                }
-                Ek::E => {
-                    let mut te = Vec::new();
-                    pv(&mut te, 9, EV_END);
-                    pv(&mut te, 11, tu);
+        let mut pkt = Vec::new();
+        match e {
+            Event::Begin { name, .. } => {
+                let mut te = Vec::new();
+                pv(&mut te, 9, EV_BEGIN);
+                pv(&mut te, 11, tu);
+                if intern {
+                    // Intern each name once per sequence, right before its first use.
+                    let iid = match tr.iids.get(name.as_str()) {
+                        Some(i) => *i,
+                        None => {
+                            let i = tr.iids.len() as u64 + 1;
+                            tr.iids.insert(name.clone(), i);
+                            let mut inner = Vec::new();
+                            pv(&mut inner, 1, i);
+                            ps(&mut inner, 2, name);
+                            let mut interned = Vec::new();
+                            pb(&mut interned, 2, &inner); // InternedData.event_names -> EventName{iid,name}
+                            let mut ipkt = Vec::new();
+                            pb(&mut ipkt, 12, &interned);
+                            pv(&mut ipkt, 10, sid);
+                            pv(&mut ipkt, 13, if i == 1 { SEQ_CLEARED } else { SEQ_NEEDS });
+                            emit(&mut self.buf, &ipkt);
+                            i
+                        }
+                    };
+                    pv(&mut te, 10, iid);
                     pv(&mut pkt, 8, ts_u);
                     pb(&mut pkt, 11, &te);
                     pv(&mut pkt, 10, sid);
-                }
-                Ek::C(val) => {
-                    let mut te = Vec::new();
-                    pv(&mut te, 9, EV_COUNTER);
-                    pv(&mut te, 11, tu);
-                    match val {
-                        Num::F(x) => pd(&mut te, 44, *x),
-                        Num::I(n) => pv(&mut te, 30, (*n & (u64::MAX as u128)) as u64),
-                    }
+                    pv(&mut pkt, 13, SEQ_NEEDS);
+                } else {
+                    ps(&mut te, 23, name);
                     pv(&mut pkt, 8, ts_u);
                     pb(&mut pkt, 11, &te);
                     pv(&mut pkt, 10, sid);
                 }
             }
-            emit(&mut out, &pkt);
+            Event::End { .. } => {
+                let mut te = Vec::new();
+                pv(&mut te, 9, EV_END);
+                pv(&mut te, 11, tu);
+                pv(&mut pkt, 8, ts_u);
+                pb(&mut pkt, 11, &te);
+                pv(&mut pkt, 10, sid);
+            }
+            Event::Counter { val, .. } => {
+                let mut te = Vec::new();
+                pv(&mut te, 9, EV_COUNTER);
+                pv(&mut te, 11, tu);
+                match val {
+                    Num::F(x) => pd(&mut te, 44, *x),
+                    Num::I(n) => pv(&mut te, 30, (*n & (u64::MAX as u128)) as u64),
+                }
+                pv(&mut pkt, 8, ts_u);
+                pb(&mut pkt, 11, &te);
+                pv(&mut pkt, 10, sid);
+            }
+            _ => {}
         }
-        progress.inc(tr.events.len() as u64);
+        emit(&mut self.buf, &pkt);
+        self.flush(false)
     }
-    progress.finish_with_message("done");
-
-    write_bytes(path, &out, gzip_out)
-}
 
-fn write_bytes(path: &str, data: &[u8], gzip_out: bool) -> io::Result<()> {
-    let f = File::create(path)?;
-    if gzip_out {
-        let mut e = GzEncoder::new(BufWriter::new(f), Compression::default());
-        e.write_all(data)?;
-        e.finish()?;
-    } else {
-        let mut w = BufWriter::new(f);
-        w.write_all(data)?;
-        w.flush()?;
+    fn finish(mut self) -> io::Result<()> {
+        self.flush(true)?;
+        self.out.finish()
     }
-    Ok(())
 }
 
 // --------------------------------------------------------------------------
@@ -1053,140 +1917,462 @@ fn num_json(val: &Num) -> String {
     }
 }
 
-fn write_json(events: &[Event], path: &str, gzip_out: bool) -> io::Result<()> {
-    let mut s = String::with_capacity(events.len() * 48 + 64);
-    s.push_str("{\"traceEvents\": [");
-    for (i, e) in events.iter().enumerate() {
-        if i > 0 {
-            s.push_str(", ");
+fn json_event(e: &Event, s: &mut String) {
+    match e {
+        Event::ProcName { pid, name, num } => {
+            s.push_str("{\"ph\": \"M\", \"name\": \"process_name\", \"pid\": ");
+            s.push_str(&pid.to_string());
+            s.push_str(", \"args\": {\"name\": ");
+            json_escape(name, s);
+            s.push_str(", \"num\": ");
+            match num {
+                Some(n) => s.push_str(&n.to_string()),
+                None => s.push_str("null"),
+            }
+            s.push_str("}}");
+        }
+        Event::ThreadName { pid, tid, name } => {
+            s.push_str("{\"ph\": \"M\", \"name\": \"thread_name\", \"pid\": ");
+            s.push_str(&pid.to_string());
+            s.push_str(", \"tid\": ");
+            s.push_str(&tid.to_string());
+            s.push_str(", \"args\": {\"name\": ");
+            json_escape(name, s);
+            s.push_str("}}");
+        }
+        Event::Begin { pid, tid, ts, name } => {
+            s.push_str("{\"ph\": \"B\", \"name\": ");
+            json_escape(name, s);
+            s.push_str(", \"pid\": ");
+            s.push_str(&pid.to_string());
+            s.push_str(", \"tid\": ");
+            s.push_str(&tid.to_string());
+            s.push_str(", \"ts\": ");
+            s.push_str(&format!("{:?}", ts));
+            s.push('}');
+        }
+        Event::End { pid, tid, ts } => {
+            s.push_str("{\"ph\": \"E\", \"pid\": ");
+            s.push_str(&pid.to_string());
+            s.push_str(", \"tid\": ");
+            s.push_str(&tid.to_string());
+            s.push_str(", \"ts\": ");
+            s.push_str(&format!("{:?}", ts));
+            s.push('}');
+        }
+        Event::Counter { pid, tid, ts, name, val } => {
+            s.push_str("{\"ph\": \"C\", \"name\": ");
+            json_escape(name, s);
+            s.push_str(", \"pid\": ");
+            s.push_str(&pid.to_string());
+            s.push_str(", \"tid\": ");
+            s.push_str(&tid.to_string());
+            s.push_str(", \"ts\": ");
+            s.push_str(&format!("{:?}", ts));
+            s.push_str(", \"args\": {");
+            json_escape(name, s);
+            s.push_str(": ");
+            s.push_str(&num_json(val));
+            s.push_str("}}");
+        }
+    }
+}
+
+struct JsonWriter {
+    out: Output,
+    buf: String,
+    first: bool,
+}
+
+impl JsonWriter {
+    fn create(path: &str, gzip_out: bool) -> io::Result<JsonWriter> {
+        let mut buf = String::with_capacity(OUT_BUFFER + 4096);
+        buf.push_str("{\"traceEvents\": [");
+        Ok(JsonWriter { out: Output::create(path, gzip_out)?, buf, first: true })
+    }
+
+    fn event(&mut self, e: &Event) -> io::Result<()> {
+        if !self.first {
+            self.buf.push_str(", ");
         }
+        self.first = false;
+        json_event(e, &mut self.buf);
+        if self.buf.len() >= OUT_BUFFER {
+            self.out.write_all(self.buf.as_bytes())?;
+            self.buf.clear();
+        }
+        Ok(())
+    }
+
+    fn finish(mut self) -> io::Result<()> {
+        self.buf.push_str("], \"displayTimeUnit\": \"ns\"}");
+        self.out.write_all(self.buf.as_bytes())?;
+        self.out.finish()
+    }
+}
+
+// --------------------------------------------------------------------------
+// --stats: per (process, thread, slice-name) total duration / count.
+// --------------------------------------------------------------------------
+
+#[derive(Default)]
+struct Stats {
+    proc_names: HashMap<i64, String>,
+    thread_names: HashMap<(i64, i64), String>,
+    open_b: HashMap<(i64, i64), (String, f64)>,
+    totals: IndexMap<(i64, i64, String), (f64, i64)>,
+}
+
+impl Stats {
+    fn event(&mut self, e: &Event) {
         match e {
-            Event::ProcName { pid, name, num } => {
-                s.push_str("{\"ph\": \"M\", \"name\": \"process_name\", \"pid\": ");
-                s.push_str(&pid.to_string());
-                s.push_str(", \"args\": {\"name\": ");
-                json_escape(name, &mut s);
-                s.push_str(", \"num\": ");
-                match num {
-                    Some(n) => s.push_str(&n.to_string()),
-                    None => s.push_str("null"),
-                }
-                s.push_str("}}");
+            Event::ProcName { pid, name, .. } => {
+                self.proc_names.insert(*pid, name.clone());
             }
             Event::ThreadName { pid, tid, name } => {
-                s.push_str("{\"ph\": \"M\", \"name\": \"thread_name\", \"pid\": ");
-                s.push_str(&pid.to_string());
-                s.push_str(", \"tid\": ");
-                s.push_str(&tid.to_string());
-                s.push_str(", \"args\": {\"name\": ");
-                json_escape(name, &mut s);
-                s.push_str("}}");
+                self.thread_names.insert((*pid, *tid), name.clone());
             }
             Event::Begin { pid, tid, ts, name } => {
-                s.push_str("{\"ph\": \"B\", \"name\": ");
-                json_escape(name, &mut s);
-                s.push_str(", \"pid\": ");
-                s.push_str(&pid.to_string());
-                s.push_str(", \"tid\": ");
-                s.push_str(&tid.to_string());
-                s.push_str(", \"ts\": ");
-                s.push_str(&format!("{:?}", ts));
-                s.push('}');
+                self.open_b.insert((*pid, *tid), (name.clone(), *ts));
             }
             Event::End { pid, tid, ts } => {
-                s.push_str("{\"ph\": \"E\", \"pid\": ");
-                s.push_str(&pid.to_string());
-                s.push_str(", \"tid\": ");
-                s.push_str(&tid.to_string());
-                s.push_str(", \"ts\": ");
-                s.push_str(&format!("{:?}", ts));
-                s.push('}');
-            }
-            Event::Counter { pid, tid, ts, name, val } => {
-                s.push_str("{\"ph\": \"C\", \"name\": ");
-                json_escape(name, &mut s);
-                s.push_str(", \"pid\": ");
-                s.push_str(&pid.to_string());
-                s.push_str(", \"tid\": ");
-                s.push_str(&tid.to_string());
-                s.push_str(", \"ts\": ");
-                s.push_str(&format!("{:?}", ts));
-                s.push_str(", \"args\": {");
-                json_escape(name, &mut s);
-                s.push_str(": ");
-                s.push_str(&num_json(val));
-                s.push_str("}}");
-            }
-        }
-    }
-    s.push_str("], \"displayTimeUnit\": \"ns\"}");
-    write_bytes(path, s.as_bytes(), gzip_out)
+                if let Some((name, ts0)) = self.open_b.remove(&(*pid, *tid)) {
+                    let ent = self.totals.entry((*pid, *tid, name)).or_insert((0.0, 0));
+                    ent.0 += *ts - ts0;
+                    ent.1 += 1;
+                }
+            }
+            _ => {}
+        }
+    }
+
+    fn print(self) {
+        let Stats { proc_names, thread_names, totals, .. } = self;
+        let mut rows: Vec<(f64, String, String, String, i64)> = totals
+            .into_iter()
+            .map(|((pid, tid, name), (dur, cnt))| {
+                (
+                    dur,
+                    proc_names.get(&pid).cloned().unwrap_or_else(|| pid.to_string()),
+                    thread_names.get(&(pid, tid)).cloned().unwrap_or_else(|| tid.to_string()),
+                    name,
+                    cnt,
+                )
+            })
+            .collect();
+        rows.sort_by(|a, b| {
+            b.0.partial_cmp(&a.0)
+                .unwrap_or(std::cmp::Ordering::Equal)
+                .then_with(|| b.1.cmp(&a.1))
+                .then_with(|| b.2.cmp(&a.2))
+                .then_with(|| b.3.cmp(&a.3))
+                .then_with(|| b.4.cmp(&a.4))
+        });
+
+        println!("{:>14}  {:>7}  process / thread / phase", "us total", "count");
+        for (dur, proc, thread, name, cnt) in rows.iter().take(200) {
+            println!("{:14.1}  {:7}  {} / {} / {}", dur, cnt, proc, thread, name);
+        }
+        if rows.len() > 200 {
+            println!("... ({} more rows omitted)", rows.len() - 200);
+        }
+    }
 }
 
 // --------------------------------------------------------------------------
-// --stats: per (process, thread, slice-name) total duration / count.
+// --util: per-tile engine utilisation and compute/DMA overlap, from the raw
+// value changes, with a mesh heat-map of each metric.
 // --------------------------------------------------------------------------
 
-fn print_stats(events: &[Event]) {
-    let mut proc_names: HashMap<i64, String> = HashMap::new();
-    let mut thread_names: HashMap<(i64, i64), String> = HashMap::new();
-    for e in events {
-        match e {
-            Event::ProcName { pid, name, .. } => {
-                proc_names.insert(*pid, name.clone());
+// Per-tile metrics: the engine busy times, then the compute/DMA overlap.
+const UTIL_METRICS: [&str; 6] = ["redmule", "idma_in", "idma_out", "fsync", "vfu", "overlap"];
+const UTIL_REDMULE: usize = 0;
+const UTIL_IDMA_IN: usize = 1; // idma0: L2 -> L1
+const UTIL_IDMA_OUT: usize = 2; // idma1: L1 -> L2
+const UTIL_FSYNC: usize = 3;
+const UTIL_VFU: usize = 4;
+const UTIL_OVERLAP: usize = 5;
+const UTIL_COMPUTE: u8 = 1 << UTIL_REDMULE | 1 << UTIL_VFU;
+const UTIL_DMA: u8 = 1 << UTIL_IDMA_IN | 1 << UTIL_IDMA_OUT;
+
+// How the value of a probed signal tells whether its engine is busy.
+enum Busy {
+    Fsm,      // redmule fsm_state: preload, routine or storing
+    NonZero,  // iDMA backend state: anything but idle
+    High,     // 1-bit activity signal
+    AsmFsync, // core asm: the current instruction is an fsync
+    FnFsync,  // core func: the current function is an fsync one
+    PcFsync,  // core pc: --symbolize maps it into an fsync function
+}
+
+struct Probe {
+    tile: usize,
+    metric: usize,
+    input: u8, // bit of this signal among the inputs of the metric
+    busy: Busy,
+}
+
+#[derive(Default, Clone)]
+struct TileUtil {
+    last: Option<i64>,
+    inputs: [u8; 5], // per engine metric, the inputs currently busy
+    busy: u8,        // engine metrics currently busy
+    time: [i64; 6],  // busy ticks per metric
+    probed: u8,      // metrics with at least one probed signal
+}
+
+impl TileUtil {
+    fn advance(&mut self, t: i64) {
+        if let Some(last) = self.last {
+            let dt = t - last;
+            for m in 0..UTIL_OVERLAP {
+                if self.busy & 1 << m != 0 {
+                    self.time[m] += dt;
+                }
             }
-            Event::ThreadName { pid, tid, name } => {
-                thread_names.insert((*pid, *tid), name.clone());
+            if self.busy & UTIL_COMPUTE != 0 && self.busy & UTIL_DMA != 0 {
+                self.time[UTIL_OVERLAP] += dt;
             }
-            _ => {}
         }
+        self.last = Some(t);
     }
+}
 
-    let mut open_b: HashMap<(i64, i64), (String, f64)> = HashMap::new();
-    let mut totals: IndexMap<(i64, i64, String), (f64, i64)> = IndexMap::new();
-    for e in events {
-        match e {
-            Event::Begin { pid, tid, ts, name } => {
-                open_b.insert((*pid, *tid), (name.clone(), *ts));
+struct Util {
+    probes: Vec<Option<Probe>>, // per signal
+    tiles: Vec<TileUtil>,
+    span: Option<(i64, i64)>, // first and last change
+}
+
+impl Util {
+    fn new(signals: &IndexMap<String, Signal>) -> Util {
+        let re = Regex::new(
+            r"(?x) tile-(\d+)-(?:
+                (redmule\.fsm_state)
+              | (idma0\.be\.be_state) | (idma1\.be\.be_state)
+              | cv32-core\.(?: (asm) | (func) | (active_pc) )
+              | (snitch-spatz\.ara\.active)
+            )$",
+        )
+        .unwrap();
+        let mut tiles: Vec<TileUtil> = Vec::new();
+        let mut probes = Vec::with_capacity(signals.len());
+        for sig in signals.values() {
+            let cap = match re.captures(&sig.name) {
+                Some(c) => c,
+                None => {
+                    probes.push(None);
+                    continue;
+                }
+            };
+            let tile: usize = cap[1].parse().unwrap_or(0);
+            let (metric, input, busy) = if cap.get(2).is_some() {
+                (UTIL_REDMULE, 0, Busy::Fsm)
+            } else if cap.get(3).is_some() {
+                (UTIL_IDMA_IN, 0, Busy::NonZero)
+            } else if cap.get(4).is_some() {
+                (UTIL_IDMA_OUT, 0, Busy::NonZero)
+            } else if cap.get(5).is_some() {
+                (UTIL_FSYNC, 0, Busy::AsmFsync)
+            } else if cap.get(6).is_some() {
+                (UTIL_FSYNC, 1, Busy::FnFsync)
+            } else if cap.get(7).is_some() {
+                (UTIL_FSYNC, 2, Busy::PcFsync)
+            } else {
+                (UTIL_VFU, 0, Busy::High)
+            };
+            if tiles.len() <= tile {
+                tiles.resize(tile + 1, TileUtil::default());
             }
-            Event::End { pid, tid, ts } => {
-                if let Some((name, ts0)) = open_b.remove(&(*pid, *tid)) {
-                    let ent = totals.entry((*pid, *tid, name)).or_insert((0.0, 0));
-                    ent.0 += *ts - ts0;
-                    ent.1 += 1;
+            tiles[tile].probed |= 1 << metric;
+            probes.push(Some(Probe { tile, metric, input: 1 << input, busy }));
+        }
+        Util { probes, tiles, span: None }
+    }
+
+    fn change(&mut self, sig: u32, t: i64, val: &str, symbols: Option<&SymTable>) {
+        self.span = Some(self.span.map_or((t, t), |(a, _)| (a, t)));
+        let p = match self.probes.get(sig as usize) {
+            Some(Some(p)) => p,
+            _ => return,
+        };
+        let busy = match p.busy {
+            Busy::Fsm => matches!(parse_bits_or_int0(val), Some(1..=3)),
+            Busy::NonZero => matches!(parse_bits_or_int0(val), Some(n) if n != 0),
+            Busy::High => val == "1",
+            // "<8 hex pc>_<mnemonic>_<operands>_"
+            Busy::AsmFsync => val.get(8..).unwrap_or("").trim_start_matches('_').starts_with("fsync"),
+            Busy::FnFsync => val.contains("fsync"),
+            Busy::PcFsync => match (symbols, parse_bits_or_int0(val)) {
+                (Some(st), Some(pc)) => st.lookup(pc).is_some_and(|f| f.contains("fsync")),
+                _ => false,
+            },
+        };
+        let tu = &mut self.tiles[p.tile];
+        tu.advance(t);
+        let inputs = &mut tu.inputs[p.metric];
+        if busy {
+            *inputs |= p.input;
+        } else {
+            *inputs &= !p.input;
+        }
+        if *inputs != 0 {
+            tu.busy |= 1 << p.metric;
+        } else {
+            tu.busy &= !(1 << p.metric);
+        }
+    }
+
+    // Busy percentage of every metric per tile, over the whole trace (up to one
+    // tick after the last change, like the slices); None where not probed.
+    fn finish(mut self) -> Vec<[Option<f64>; 6]> {
+        let (t0, t1) = match self.span {
+            Some((a, b)) => (a, b + 1),
+            None => return Vec::new(),
+        };
+        let span = (t1 - t0) as f64;
+        self.tiles
+            .iter_mut()
+            .map(|tu| {
+                tu.advance(t1);
+                let mut row = [None; 6];
+                for (m, cell) in row.iter_mut().enumerate().take(UTIL_METRICS.len()) {
+                    let probed = if m == UTIL_OVERLAP {
+                        tu.probed & UTIL_COMPUTE != 0 && tu.probed & UTIL_DMA != 0
+                    } else {
+                        tu.probed & 1 << m != 0
+                    };
+                    if probed {
+                        *cell = Some(100.0 * tu.time[m] as f64 / span);
+                    }
                 }
+                row
+            })
+            .collect()
+    }
+}
+
+// Side of the (square) mesh holding `n` tiles; tile i sits at x = i % side,
+// y = i / side, as GET_X_ID/GET_Y_ID lay them out.
+fn mesh_side(n: usize) -> usize {
+    let mut side = 1;
+    while side * side < n {
+        side *= 2;
+    }
+    side
+}
+
+fn util_cell(v: Option<f64>) -> String {
+    v.map_or("-".to_string(), |p| format!("{:.1}", p))
+}
+
+fn print_util(rows: &[[Option<f64>; 6]]) {
+    println!("\nutilisation (% of the trace, {} tiles)", rows.len());
+    print!("{:>6}", "tile");
+    for m in UTIL_METRICS {
+        print!("  {:>8}", m);
+    }
+    println!();
+    for (tile, row) in rows.iter().enumerate() {
+        if row.iter().all(|v| v.is_none()) {
+            continue;
+        }
+        print!("{:>6}", tile);
+        for v in row {
+            print!("  {:>8}", util_cell(*v));
+        }
+        println!();
+    }
+
+    let side = mesh_side(rows.len());
+    for (m, name) in UTIL_METRICS.iter().enumerate() {
+        if rows.iter().all(|r| r[m].is_none()) {
+            continue;
+        }
+        println!("\n{} % (mesh, row = y, column = x)", name);
+        print!("{:>4}", "");
+        for x in 0..side {
+            print!("  {:>5}", format!("x{}", x));
+        }
+        println!();
+        for y in 0..side {
+            print!("{:>4}", format!("y{}", y));
+            for x in 0..side {
+                print!("  {:>5}", util_cell(rows.get(y * side + x).and_then(|r| r[m])));
             }
-            _ => {}
+            println!();
         }
     }
+}
 
-    let mut rows: Vec<(f64, String, String, String, i64)> = totals
-        .into_iter()
-        .map(|((pid, tid, name), (dur, cnt))| {
-            (
-                dur,
-                proc_names.get(&pid).cloned().unwrap_or_else(|| pid.to_string()),
-                thread_names.get(&(pid, tid)).cloned().unwrap_or_else(|| tid.to_string()),
-                name,
-                cnt,
-            )
-        })
-        .collect();
-    rows.sort_by(|a, b| {
-        b.0.partial_cmp(&a.0)
-            .unwrap_or(std::cmp::Ordering::Equal)
-            .then_with(|| b.1.cmp(&a.1))
-            .then_with(|| b.2.cmp(&a.2))
-            .then_with(|| b.3.cmp(&a.3))
-            .then_with(|| b.4.cmp(&a.4))
-    });
+fn write_util_csv(path: &str, rows: &[[Option<f64>; 6]]) -> io::Result<()> {
+    let side = mesh_side(rows.len());
+    let mut w = BufWriter::new(File::create(path)?);
+    writeln!(w, "tile,x,y,{}", UTIL_METRICS.join(","))?;
+    for (tile, row) in rows.iter().enumerate() {
+        if row.iter().all(|v| v.is_none()) {
+            continue;
+        }
+        write!(w, "{},{},{}", tile, tile % side, tile / side)?;
+        for v in row {
+            match v {
+                Some(p) => write!(w, ",{:.2}", p)?,
+                None => write!(w, ",")?,
+            }
+        }
+        writeln!(w)?;
+    }
+    w.flush()
+}
+
+// --------------------------------------------------------------------------
+// Event sink: the output writer, plus the --stats accumulators
+// --------------------------------------------------------------------------
+
+enum Writer {
+    Perfetto(PerfettoWriter),
+    Json(JsonWriter),
+}
+
+struct Sink {
+    writer: Writer,
+    stats: Option<Stats>,
+    events: u64,
+    tracks: HashSet<(i64, i64)>,
+}
 
-    println!("{:>14}  {:>7}  process / thread / phase", "us total", "count");
-    for (dur, proc, thread, name, cnt) in rows.iter().take(200) {
-        println!("{:14.1}  {:7}  {} / {} / {}", dur, cnt, proc, thread, name);
+impl Sink {
+    fn push(&mut self, e: &Event) -> io::Result<()> {
+        self.events += 1;
+        match e {
+            Event::Begin { pid, tid, .. } | Event::End { pid, tid, .. } | Event::Counter { pid, tid, .. } => {
+                self.tracks.insert((*pid, *tid));
+            }
+            _ => {}
+        }
+        if let Some(st) = &mut self.stats {
+            st.event(e);
+        }
+        match &mut self.writer {
+            Writer::Perfetto(w) => w.event(e),
+            Writer::Json(w) => w.event(e),
+        }
+    }
+
+    fn drain(&mut self, events: &mut Vec<Event>) -> io::Result<()> {
+        for e in events.iter() {
+            self.push(e)?;
+        }
+        events.clear();
+        Ok(())
     }
-    if rows.len() > 200 {
-        println!("... ({} more rows omitted)", rows.len() - 200);
+
+    fn finish(self) -> io::Result<(u64, usize, Option<Stats>)> {
+        match self.writer {
+            Writer::Perfetto(w) => w.finish()?,
+            Writer::Json(w) => w.finish()?,
+        }
+        Ok((self.events, self.tracks.len(), self.stats))
     }
 }
 
@@ -1209,6 +2395,9 @@ struct Args {
     split_asm: bool,
     symbolize: Option<String>,
     stats: bool,
+    util: bool,
+    util_csv: Option<String>,
+    jobs: usize,
 }
 
 fn parse_args() -> Result<Args, String> {
@@ -1227,6 +2416,9 @@ fn parse_args() -> Result<Args, String> {
         split_asm: false,
         symbolize: None,
         stats: false,
+        util: false,
+        util_csv: None,
+        jobs: std::thread::available_parallelism().map_or(1, |n| n.get()),
     };
     let argv: Vec<String> = std::env::args().skip(1).collect();
     let mut got_vcd = false;
@@ -1266,6 +2458,17 @@ fn parse_args() -> Result<Args, String> {
             "--split-asm" => a.split_asm = true,
             "--symbolize" => a.symbolize = Some(take_val(&mut i)?),
             "--stats" => a.stats = true,
+            "--util" => a.util = true,
+            "--util-csv" => {
+                a.util_csv = Some(take_val(&mut i)?);
+                a.util = true;
+            }
+            "-j" | "--jobs" => {
+                a.jobs = take_val(&mut i)?.parse().map_err(|_| "--jobs: bad int".to_string())?;
+                if a.jobs == 0 {
+                    return Err("--jobs must be >= 1".to_string());
+                }
+            }
             "-h" | "--help" => {
                 print_help();
                 std::process::exit(0);
@@ -1281,7 +2484,7 @@ fn parse_args() -> Result<Args, String> {
         i += 1;
     }
     if !got_vcd {
-        return Err("missing input VCD (use fst2vcd for FST dumps)".to_string());
+        return Err("missing input trace (VCD or FST)".to_string());
     }
     if a.format != "perfetto" && a.format != "json" {
         return Err(format!("--format must be perfetto|json (got {})", a.format));
@@ -1291,12 +2494,32 @@ fn parse_args() -> Result<Args, String> {
 
 fn print_help() {
     eprintln!(
-        "gvsoc2perfetto <vcd> [-o OUT] [--format perfetto|json] [--no-intern] [--gzip]\n\
+        "gvsoc2perfetto <vcd|fst> [-o OUT] [--format perfetto|json] [--no-intern] [--gzip]\n\
          \x20 [--pid-depth N] [--include RE] [--exclude RE] [--state-map LEAF=V:NAME,...]\n\
          \x20 [--derive-busy LEAF_A,LEAF_B] [--rename OLD=NEW] [--split-asm]\n\
-         \x20 [--symbolize FILE.s] [--stats]\n\
-         See scripts/gvsoc2perfetto.py for the full documentation of each flag."
+         \x20 [--symbolize FILE.s] [--stats] [--util] [--util-csv FILE] [-j|--jobs N]\n\
+         See scripts/gvsoc2perfetto.py for the full documentation of each flag;\n\
+         --jobs sets the trace parser threads (default: all CPUs).\n\
+         --util prints, per tile, the % of the trace RedMulE is busy (fsm_state\n\
+         preload/routine/storing), each iDMA backend is active (idma_in: idma0,\n\
+         L2->L1; idma_out: idma1, L1->L2), the core sits in fsync (fsync\n\
+         instruction, or fsync function with --symbolize), the Spatz VFU is\n\
+         active, and compute (RedMulE or VFU) overlaps DMA, plus a mesh heat-map\n\
+         of each; --util-csv also writes the table as CSV (tile,x,y,metrics)."
+    );
+}
+
+fn progress_bar(len: u64, msg: &'static str) -> ProgressBar {
+    let progress = ProgressBar::new(len);
+    progress.set_style(
+        ProgressStyle::with_template(
+            "{spinner} {msg} [{elapsed_precise}] [{bar:40}] {bytes}/{total_bytes} ({eta})",
+        )
+        .unwrap()
+        .progress_chars("=> "),
     );
+    progress.set_message(msg);
+    progress
 }
 
 fn run() -> Result<(), Box<dyn std::error::Error>> {
@@ -1311,23 +2534,64 @@ fn run() -> Result<(), Box<dyn std::error::Error>> {
         None => None,
     };
 
-    let (mut signals, mut changes, ps) = parse_vcd(&args.vcd, inc.as_ref(), exc.as_ref())?;
+    let mut specs: Vec<(String, String)> = Vec::new();
+    for s in &args.derive_busy {
+        let parts: Vec<&str> = s.splitn(2, ',').collect();
+        if parts.len() != 2 || parts[0].is_empty() || parts[1].is_empty() {
+            return Err(format!("--derive-busy expects 'LEAF_A,LEAF_B' (got {:?})", s).into());
+        }
+        specs.push((parts[0].to_string(), parts[1].to_string()));
+    }
 
-    if !args.derive_busy.is_empty() {
-        let mut specs: Vec<(String, String)> = Vec::new();
-        for s in &args.derive_busy {
-            let parts: Vec<&str> = s.splitn(2, ',').collect();
-            if parts.len() != 2 || parts[0].is_empty() || parts[1].is_empty() {
-                return Err(format!("--derive-busy expects 'LEAF_A,LEAF_B' (got {:?})", s).into());
+    let map = Mmap::open(&args.vcd)?;
+    let data = map.bytes();
+    let Trace { mut signals, ps_per_tick: ps, chunks, input } = open_trace(data, inc.as_ref(), exc.as_ref())?;
+    let parse = |i: usize| input.parse(data, &chunks, i);
+    let body_len: u64 = chunks.iter().map(|(a, b)| (b - a) as u64).sum();
+    let n_vcd = signals.len();
+
+    // First pass: find the signals with changes, and the counter tracks, so
+    // that every track can be declared before the events stream out.
+    let mut derived = Derived::find(&signals, &specs);
+    let mut seen = vec![false; n_vcd + derived.len()];
+    let mut has_num = vec![false; n_vcd];
+    let mut dchanges: Vec<(i64, bool)> = Vec::new();
+    let progress = progress_bar(body_len, "scan");
+    for_each_chunk(&map, &chunks, args.jobs, &progress, parse, |chunk| {
+        for r in &chunk.recs {
+            let i = r.sig as usize;
+            seen[i] = true;
+            if !has_num[i] && counter_value(chunk.val(r)).is_some() {
+                has_num[i] = true;
             }
-            specs.push((parts[0].to_string(), parts[1].to_string()));
         }
-        let n = inject_derived_busy(&mut signals, &mut changes, &specs);
-        eprintln!("--derive-busy: synthesized {} busy_derived signal(s)", n);
+        for (k, d) in derived.iter_mut().enumerate() {
+            d.step(chunk, &mut dchanges);
+            seen[n_vcd + k] |= !dchanges.is_empty();
+        }
+        Ok(())
+    })?;
+    progress.finish_and_clear();
+
+    // Pseudo-signals without changes are dropped, the others follow the VCD ones.
+    let mut kept = Vec::new();
+    for (k, mut d) in derived.into_iter().enumerate() {
+        if seen[n_vcd + k] {
+            d.val_a = None;
+            d.val_b = None;
+            signals.insert(d.vid.clone(), Signal { name: d.name.clone(), vtype: "wire".to_string(), width: 1 });
+            kept.push(d);
+        }
+    }
+    let mut derived = kept;
+    seen.truncate(n_vcd);
+    seen.resize(n_vcd + derived.len(), true);
+    if !args.derive_busy.is_empty() {
+        eprintln!("--derive-busy: synthesized {} busy_derived signal(s)", derived.len());
     }
 
     let state_maps: Vec<(Regex, HashMap<u128, String>)> =
-        args.state_map.iter().map(|s| parse_state_map_arg(s)).collect();
+        args.state_map.iter().map(|s| parse_state_map_arg(s)).collect::<Result<_, _>>()?;
     let renames: HashMap<String, String> = args
         .rename
         .iter()
@@ -1351,16 +2615,17 @@ fn run() -> Result<(), Box<dyn std::error::Error>> {
         None => None,
     };
 
-    let events = convert(
-        &signals,
-        &changes,
-        ps,
-        args.pid_depth,
-        &state_maps,
-        &renames,
-        args.split_asm,
-        symbols.as_ref(),
-    );
+    let (mut convs, meta) =
+        plan(&signals, &seen, args.pid_depth, &state_maps, &renames, args.split_asm, symbols.as_ref());
+    let mut util = if args.util { Some(Util::new(&signals)) } else { None };
+    let mut counters: HashSet<(i64, i64)> = HashSet::new();
+    for (i, sc) in convs.iter().enumerate().take(n_vcd) {
+        if let Some(sc) = sc {
+            if matches!(sc.kind, Kind::Counter) && has_num[i] {
+                counters.insert((sc.pid, sc.tid));
+            }
+        }
+    }
 
     let mut out = args.output.clone().unwrap_or_else(|| {
         if args.format == "perfetto" {
@@ -1373,33 +2638,68 @@ fn run() -> Result<(), Box<dyn std::error::Error>> {
         out.push_str(".gz");
     }
 
-    if args.format == "perfetto" {
-        write_perfetto(&events, &out, !args.no_intern, args.gzip)?;
+    let writer = if args.format == "perfetto" {
+        Writer::Perfetto(PerfettoWriter::create(&out, args.gzip, !args.no_intern, &meta, counters)?)
     } else {
-        write_json(&events, &out, args.gzip)?;
+        Writer::Json(JsonWriter::create(&out, args.gzip)?)
+    };
+    let mut sink = Sink {
+        writer,
+        stats: if args.stats { Some(Stats::default()) } else { None },
+        events: 0,
+        tracks: HashSet::new(),
+    };
+    for e in &meta {
+        sink.push(e)?;
     }
 
-    let mut track_set: HashSet<(i64, i64)> = HashSet::new();
-    for e in &events {
-        match e {
-            Event::Begin { pid, tid, .. }
-            | Event::End { pid, tid, .. }
-            | Event::Counter { pid, tid, .. } => {
-                track_set.insert((*pid, *tid));
+    // Second pass: convert the chunks in order and stream the events out.
+    let mut events: Vec<Event> = Vec::new();
+    let progress = progress_bar(body_len, "convert");
+    for_each_chunk(&map, &chunks, args.jobs, &progress, parse, |chunk| {
+        for r in &chunk.recs {
+            if let Some(u) = &mut util {
+                u.change(r.sig, r.t, chunk.val(r), symbols.as_ref());
+            }
+            if let Some(sc) = &mut convs[r.sig as usize] {
+                sc.change(r.t, chunk.val(r), ps, &state_maps, symbols.as_ref(), &mut events);
+            }
+        }
+        for (k, d) in derived.iter_mut().enumerate() {
+            d.step(chunk, &mut dchanges);
+            if let Some(sc) = &mut convs[n_vcd + k] {
+                for &(t, busy) in &dchanges {
+                    sc.change(t, if busy { "1" } else { "0" }, ps, &state_maps, symbols.as_ref(), &mut events);
+                }
             }
-            _ => {}
         }
+        sink.drain(&mut events)
+    })?;
+    progress.finish_with_message("done");
+    for sc in convs.iter_mut().flatten() {
+        sc.finish(ps, &mut events);
     }
+    sink.drain(&mut events)?;
+
+    let (n_events, n_tracks, stats) = sink.finish()?;
     eprintln!(
-        "{}: {} events on {} tracks ({} signals in VCD). Open at https://ui.perfetto.dev",
+        "{}: {} events on {} tracks ({} signals in trace). Open at https://ui.perfetto.dev",
         out,
-        events.len(),
-        track_set.len(),
+        n_events,
+        n_tracks,
         signals.len()
     );
 
-    if args.stats {
-        print_stats(&events);
+    if let Some(st) = stats {
+        st.print();
+    }
+    if let Some(u) = util {
+        let rows = u.finish();
+        print_util(&rows);
+        if let Some(path) = &args.util_csv {
+            write_util_csv(path, &rows)?;
+            eprintln!("--util-csv: wrote {}", path);
+        }
     }
     Ok(())
 }
@@ -1413,3 +2713,204 @@ fn main() {
         }
     });
 }
+
+// --------------------------------------------------------------------------
+// Tests
+// --------------------------------------------------------------------------
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    // Value changes of a chunk as (signal, time, value) tuples.
+    fn changes(chunk: &Chunk) -> Vec<(u32, i64, String)> {
+        chunk.recs.iter().map(|r| (r.sig, r.t, chunk.val(r).to_string())).collect()
+    }
+
+    // Write `data` to a temporary file and map it.
+    fn map_bytes(name: &str, data: &[u8]) -> Mmap {
+        let path = std::env::temp_dir().join(format!("gvsoc2perfetto-{}-{}", std::process::id(), name));
+        std::fs::write(&path, data).unwrap();
+        let map = Mmap::open(path.to_str().unwrap()).unwrap();
+        std::fs::remove_file(&path).unwrap();
+        map
+    }
+
+    // Ids use '#' too, so that a value-change line can look like a timestamp
+    // to a careless split. Several changes per timestamp, and a timestamp
+    // repeated back-to-back, so that the probe of some chunk sizes lands in
+    // the middle of a run of changes.
+    const VCD: &[u8] = b"$timescale 1ps $end
+$scope module top $end
+$var wire 1 ! busy $end
+$var wire 8 # data [7:0] $end
+$var string 1 \" state $end
+$upscope $end
+$enddefinitions $end
+$dumpvars
+0!
+b0 #
+s \"
+$end
+#10
+1!
+b101 #
+sRUN \"
+#10
+X!
+#25
+0!
+b11111111 #
+sWAIT SYNC \"
+#40
+z!
+1!
+b1 #
+#1000
+0!
+";
+
+    #[test]
+    fn vcd_chunks_match_single_chunk() {
+        let map = map_bytes("vcd", VCD);
+        let data = map.bytes();
+        let trace = open_trace(data, None, None).unwrap();
+        assert_eq!(trace.signals.len(), 3);
+        let body = trace.chunks[0].0;
+        let reference = changes(&trace.input.parse(data, &[(body, data.len())], 0).unwrap());
+        assert_eq!(reference.len(), 14);
+        assert!(reference.contains(&(2, 25, "WAIT SYNC".to_string())));
+
+        for size in 1..=data.len() - body {
+            let chunks = split_chunks(data, body, size);
+            assert_eq!(chunks.first().unwrap().0, body);
+            assert_eq!(chunks.last().unwrap().1, data.len());
+            for w in chunks.windows(2) {
+                assert_eq!(w[0].1, w[1].0);
+                assert_eq!(data[w[1].0], b'#', "chunk {:?} of size {} not on a timestamp", w[1], size);
+            }
+
+            for jobs in [1, 3] {
+                let mut got = Vec::new();
+                let parse = |i: usize| trace.input.parse(data, &chunks, i);
+                for_each_chunk(&map, &chunks, jobs, &ProgressBar::hidden(), parse, |chunk| {
+                    got.extend(changes(chunk));
+                    Ok(())
+                })
+                .unwrap();
+                assert_eq!(got, reference, "chunk size {}, {} jobs", size, jobs);
+            }
+        }
+    }
+
+    #[test]
+    fn vcd_chunk_errors_stop_the_workers() {
+        let map = map_bytes("vcd-err", VCD);
+        let data = map.bytes();
+        let trace = open_trace(data, None, None).unwrap();
+        let chunks = split_chunks(data, trace.chunks[0].0, 1);
+        let parse = |i: usize| {
+            if i == 2 {
+                Err(io::Error::other("bad chunk"))
+            } else {
+                trace.input.parse(data, &chunks, i)
+            }
+        };
+        let mut consumed = 0;
+        let res = for_each_chunk(&map, &chunks, 2, &ProgressBar::hidden(), parse, |_| {
+            consumed += 1;
+            Ok(())
+        });
+        assert!(res.is_err());
+        assert_eq!(consumed, 2);
+    }
+
+    fn hex(s: &str) -> Vec<u8> {
+        (0..s.len()).step_by(2).map(|i| u8::from_str_radix(&s[i..i + 2], 16).unwrap()).collect()
+    }
+
+    // Block of `lz4 -9` on LIT, "busy idle " x 40, LIT[..20], "end": extended
+    // literal and match lengths, overlapping copies.
+    const LZ4_LIT: &str = "a54dca182530bb1d6d132cded6237b2ed91e3f721fcb1971174494d6493c9d5c3460be31201e69fe";
+    const LZ4_BLOCK: &str = "ff23a54dca182530bb1d6d132cded6237b2ed91e3f721fcb1971174494d6493c9d5c3460be31201e69fe\
+                             627573792069646c65200a00ff740eb801503f72656e64";
+
+    #[test]
+    fn lz4_block() {
+        let lit = hex(LZ4_LIT);
+        let mut want = lit.clone();
+        want.extend(b"busy idle ".repeat(40));
+        want.extend(&lit[..20]);
+        want.extend(b"end");
+        let src = hex(LZ4_BLOCK);
+        assert_eq!(vc_unpack(&src, want.len(), b'4').unwrap(), want);
+
+        // Offset before the start of the output, truncated block, wrong length
+        assert!(lz4_unpack(&[0x10, b'a', 0x02, 0x00], 8).is_err());
+        assert!(lz4_unpack(&src[..src.len() - 4], want.len()).is_err());
+        assert!(vc_unpack(&src, want.len() + 1, b'4').is_err());
+    }
+
+    #[test]
+    fn fastlz_level1() {
+        // "abc", then 9 bytes from distance 3 (extended length), then "X"
+        let src = [0x02, b'a', b'b', b'c', 0xe0, 0x00, 0x02, 0x00, b'X'];
+        assert_eq!(vc_unpack(&src, 13, b'F').unwrap(), b"abcabcabcabcX");
+        // 4 bytes from distance 2
+        let src = [0x01, b'a', b'b', 0x40, 0x01];
+        assert_eq!(fastlz_unpack(&src, 6).unwrap(), b"ababab");
+        assert!(fastlz_unpack(&[0x00, b'a', 0x40, 0x01], 4).is_err());
+    }
+
+    #[test]
+    fn fastlz_level2() {
+        // "ab", then 302 bytes from distance 2 (length extended over two bytes), then "Z"
+        let src = [0x21, b'a', b'b', 0xe0, 0xff, 0x26, 0x01, 0x00, b'Z'];
+        let mut want = b"ab".repeat(152);
+        want.push(b'Z');
+        assert_eq!(vc_unpack(&src, want.len(), b'F').unwrap(), want);
+
+        // 9000 literals, then 3 bytes from distance 9000 (16-bit distance)
+        let lit: Vec<u8> = (0..9000u32).map(|i| (i * 7 % 251) as u8).collect();
+        let mut src = Vec::new();
+        for run in lit.chunks(32) {
+            src.push(run.len() as u8 - 1);
+            src.extend(run);
+        }
+        src[0] |= 1 << 5;
+        src.extend([0x3f, 0xff, 0x03, 0x28]);
+        let mut want = lit.clone();
+        want.extend(&lit[..3]);
+        assert_eq!(fastlz_unpack(&src, want.len()).unwrap(), want);
+    }
+
+    #[test]
+    fn fst_changes() {
+        let fst = FstFile { vc_blocks: Vec::new(), lens: vec![1, 4, 0], real: vec![false; 3], double_le: true };
+        let times = [0, 10, 20];
+        let mut chunk = Chunk { recs: Vec::new(), vals: String::new() };
+        // Scalar: 1 at #0, 0 at #10, x at #20
+        fst.parse_changes(&[0x02, 0x04, 0x11], 0, 0, &times, &mut chunk).unwrap();
+        // 4 bits, bit-packed: 1010 at #10
+        fst.parse_changes(&[0x02, 0xa0], 1, 1, &times, &mut chunk).unwrap();
+        // String: "RUN  A" at #20, whitespace collapses
+        fst.parse_changes(&[0x04, 0x06, b'R', b'U', b'N', b' ', b' ', b'A'], 2, 2, &times, &mut chunk).unwrap();
+        let want = [(0, 0, "1"), (0, 10, "0"), (0, 20, "x"), (1, 10, "1010"), (2, 20, "RUN A")];
+        let want: Vec<_> = want.iter().map(|&(s, t, v)| (s, t, v.to_string())).collect();
+        assert_eq!(changes(&chunk), want);
+
+        // A time index past the time table is an error, not a panic
+        assert!(fst.parse_changes(&[0x10], 0, 0, &times, &mut chunk).is_err());
+    }
+
+    #[test]
+    fn state_map_arg() {
+        let (re, m) = parse_state_map_arg("state$=0:IDLE,0x1:RUN").unwrap();
+        assert!(re.is_match("tile.state"));
+        assert_eq!(m[&0], "IDLE");
+        assert_eq!(m[&1], "RUN");
+        for bad in ["state", "state=0", "state=zz:IDLE", "(=0:IDLE"] {
+            assert!(parse_state_map_arg(bad).is_err(), "{:?}", bad);
+        }
+    }
+}
@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+# Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+# Licensed under the Apache License, Version 2.0, see LICENSE for details.
+# SPDX-License-Identifier: Apache-2.0
+"""
+prof_table.py — per-tile table of the region profiler results (utils/prof_utils.h).
+
+Usage:
+    # Lines printed by prof_report (the host target prints them at exit)
+    ./prof_table.py run.log
+    # Raw little-endian dump of the L2 area at PROF_L2_BASE
+    ./prof_table.py --bin prof.bin
+
+For every tile the busy cycles of the input communication (cmi), output
+communication (cmo), computation (cmp) and synchronization (snc) categories
+are shown with their share of the profiled time, followed by the inclusive
+cycles of the regions opened with prof_begin.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+PROF_MAGIC = 0x50524F46
+PROF_N_CAT = 4
+PROF_MAX_REGIONS = 16
+CATEGORIES = ("cmi", "cmo", "cmp", "snc")
+
+# prof_record_t: magic, hartid, total, errors, then the per-category and per-region arrays
+RECORD_WORDS = 4 + 2 * PROF_N_CAT + 2 * PROF_MAX_REGIONS
+
+TILE_RE = re.compile(r"\[prof\] tile (\d+) total (\d+) cmi (\d+) cmo (\d+) cmp (\d+) snc (\d+) "
+                     r"errors (\d+)")
+REGION_RE = re.compile(r"\[prof\] tile (\d+) region (\d+) cycles (\d+) count (\d+)")
+
+
+def new_tile(total, cats, errors):
+    return {"total": total, "cats": cats, "errors": errors, "regions": {}}
+
+
+def parse_log(path):
+    tiles = {}
+    with open(path, "r", errors="replace") as f:
+        for line in f:
+            m = TILE_RE.search(line)
+            if m:
+                v = [int(x) for x in m.groups()]
+                tiles[v[0]] = new_tile(v[1], v[2:6], v[6])
+                continue
+            m = REGION_RE.search(line)
+            if m:
+                tile, region, cycles, count = (int(x) for x in m.groups())
+                if tile in tiles:
+                    tiles[tile]["regions"][region] = (cycles, count)
+    return tiles
+
+
+def parse_bin(path):
+    tiles = {}
+    with open(path, "rb") as f:
+        data = f.read()
+    size = RECORD_WORDS * 4
+    for h in range(len(data) // size):
+        w = struct.unpack_from("<%dI" % RECORD_WORDS, data, h * size)
+        if w[0] != PROF_MAGIC or w[1] != h:
+            continue
+        cats = list(w[4:4 + PROF_N_CAT])
+        tile = new_tile(w[2], cats, w[3])
+        base = 4 + 2 * PROF_N_CAT
+        for r in range(PROF_MAX_REGIONS):
+            cycles, count = w[base + r], w[base + PROF_MAX_REGIONS + r]
+            if count:
+                tile["regions"][r] = (cycles, count)
+        tiles[h] = tile
+    return tiles
+
+
+def share(cycles, total):
+    return "%5.1f%%" % (100.0 * cycles / total) if total else "    -"
+
+
+def print_table(tiles, out):
+    if not tiles:
+        out.write("No profiler records found.\n")
+        return
+    header = "%5s %12s" % ("tile", "total")
+    for c in CATEGORIES:
+        header += " %12s %6s" % (c, "")
+    header += " %6s\n" % "errors"
+    out.write(header)
+    for h in sorted(tiles):
+        t = tiles[h]
+        row = "%5d %12d" % (h, t["total"])
+        for cycles in t["cats"]:
+            row += " %12d %6s" % (cycles, share(cycles, t["total"]))
+        row += " %6d\n" % t["errors"]
+        out.write(row)
+
+    regions = [(h, r, c) for h in sorted(tiles) for r, c in sorted(tiles[h]["regions"].items())]
+    if regions:
+        out.write("\n%5s %6s %12s %8s %12s %6s\n" %
+                  ("tile", "region", "cycles", "count", "avg", "share"))
+        for h, r, (cycles, count) in regions:
+            out.write("%5d %6d %12d %8d %12d %6s\n" %
+                      (h, r, cycles, count, cycles // count, share(cycles, tiles[h]["total"])))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="run log, or L2 dump with --bin")
+    parser.add_argument("--bin", action="store_true", help="input is a raw dump of PROF_L2_BASE")
+    args = parser.parse_args()
+
+    tiles = parse_bin(args.input) if args.bin else parse_log(args.input)
+    print_table(tiles, sys.stdout)
+    return 0 if tiles else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,37 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+//
+// MAGIA Host Tile Address Map
+//
+// Same logical map as magia_v2: the L1 of every tile is a host mapping at the address the tile
+// would see on the mesh. L2 holds the program data, so it is wherever the host image is loaded
+// (see targets/magia_host/CMakeLists.txt) instead of L2_BASE. No register is mapped.
+
+#ifndef _TILE_ADDR_MAP_INCLUDE_GUARD_
+#define _TILE_ADDR_MAP_INCLUDE_GUARD_
+
+#define NUM_L1_BANKS   (32)
+#define WORDS_BANK     (8192)
+#define BITS_WORD      (32)
+#define BITS_BYTE      (8)
+
+#define L1_BASE        (0x00020000)
+#define L1_SIZE        (0x000DFFFF)
+#define L1_TILE_OFFSET (0x00100000)
+#define L2_BASE        (0xCC000000)
+#define PROF_L1_SIZE   (0x00000200)
+#define PROF_L1_OFFSET (L1_SIZE + 1 - PROF_L1_SIZE)
+#define PROF_L2_BASE   (0xCCF80000) // Mapped by src/host.c
+#define PROF_L2_SIZE   (0x00010000)
+
+#include "tile_config.h"
+#define NUM_HARTS          (MESH_X_TILES * MESH_Y_TILES)
+
+#define GET_X_ID(mhartid)  ((mhartid) % MESH_Y_TILES)
+#define GET_Y_ID(mhartid)  ((mhartid) / MESH_Y_TILES)
+#define GET_ID(y_id, x_id) (((y_id) * MESH_Y_TILES) + (x_id))
+
+#endif // _TILE_ADDR_MAP_INCLUDE_GUARD_
@@ -0,0 +1,30 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+
+#ifndef _TILE_INCLUDE_GUARD_
+#define _TILE_INCLUDE_GUARD_
+
+/*
+ * Host tile: the headers of this folder replace the ones of magia_v2 that touch the core or the
+ * tile registers, the pure software utilities are taken from targets/magia_v2/include.
+ * Every header shadowing a magia_v2 one keeps its include guard, so that the magia_v2 utilities
+ * including them by relative path pick up the host definitions.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "regs/tile_ctrl.h"
+#include "addr_map/tile_addr_map.h"
+#include "utils/printf.h"
+#include "utils/magia_tile_utils.h"
+#include "utils/magia_utils.h"
+#include "utils/performance_utils.h"
+#include "utils/prof_utils.h"
+#include "utils/fsync_isa_utils.h"
+#include "utils/eu_isa_utils.h"
+#include "utils/alloc.h"
+
+#endif //_TILE_INCLUDE_GUARD_
@@ -0,0 +1,144 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+//
+// MAGIA Host Event Unit Utils
+//
+// The event buffer of a tile is a word private to its thread. The host drivers complete every
+// operation before returning and set its event, so waiting never blocks.
+
+#ifndef EVENT_UNIT_UTILS_H
+#define EVENT_UNIT_UTILS_H
+
+#include <stdint.h>
+#include "magia_tile_utils.h"
+#include "regs/tile_ctrl.h"
+
+extern __thread uint32_t magia_host_events;
+extern __thread uint32_t magia_host_event_mask;
+
+static inline void eu_enable_events(uint32_t event_mask)
+{
+    magia_host_event_mask |= event_mask;
+}
+
+static inline void eu_disable_events(uint32_t event_mask)
+{
+    magia_host_event_mask &= ~event_mask;
+}
+
+static inline void eu_enable_irq(uint32_t irq_mask)
+{
+    (void)irq_mask;
+}
+
+static inline void eu_disable_irq(uint32_t irq_mask)
+{
+    (void)irq_mask;
+}
+
+static inline void eu_clear_events(uint32_t event_mask)
+{
+    magia_host_events &= ~event_mask;
+}
+
+/**
+ * @brief Set events in the buffer of the calling tile, used by the host drivers.
+ * The completion interrupts of the engines are raised along with their events.
+ */
+static inline void eu_host_set_events(uint32_t event_mask)
+{
+    uint32_t index_oh = 0;
+
+    magia_host_events |= event_mask;
+
+    if (event_mask & EU_IDMA_A2O_DONE_MASK)
+        index_oh |= (1 << IRQ_A2O_DONE);
+    if (event_mask & EU_IDMA_O2A_DONE_MASK)
+        index_oh |= (1 << IRQ_O2A_DONE);
+    if (event_mask & EU_REDMULE_DONE_MASK)
+        index_oh |= (1u << IRQ_REDMULE_EVT_0);
+    if (event_mask & EU_FSYNC_DONE_MASK)
+        index_oh |= (1 << IRQ_FSYNC_DONE);
+    if (index_oh)
+        irq_host_raise(index_oh);
+}
+
+static inline uint32_t eu_get_events(void)
+{
+    return magia_host_events;
+}
+
+static inline uint32_t eu_get_events_masked(void)
+{
+    return magia_host_events & magia_host_event_mask;
+}
+
+static inline uint32_t eu_get_events_irq_masked(void)
+{
+    return 0;
+}
+
+static inline uint32_t eu_check_events(uint32_t event_mask)
+{
+    return eu_get_events_masked() & event_mask;
+}
+
+static inline unsigned int evt_read32(unsigned int addr)
+{
+    (void)addr;
+    return magia_host_events;
+}
+
+/**
+ * @brief Consume the events, whose operations have already completed.
+ * @return Non-zero, there is nothing to wait for.
+ */
+static inline uint32_t eu_wait_events(uint32_t event_mask, int mode, uint32_t timeout_cycles)
+{
+    (void)mode;
+    (void)timeout_cycles;
+    eu_clear_events(event_mask);
+    return 1;
+}
+
+static inline uint32_t eu_wait_events_polling(uint32_t event_mask, uint32_t timeout_cycles)
+{
+    return eu_wait_events(event_mask, 0, timeout_cycles);
+}
+
+static inline uint32_t eu_wait_events_wfe(uint32_t event_mask)
+{
+    return eu_wait_events(event_mask, 1, 0);
+}
+
+/**
+ * @brief Consume the events present among event_mask.
+ * @return The events consumed, or the whole mask if none is set: there is nothing to wait for.
+ */
+static inline uint32_t eu_wait_any_events(uint32_t event_mask, int mode, uint32_t timeout_cycles)
+{
+    uint32_t detected_events = magia_host_events & event_mask;
+
+    (void)mode;
+    (void)timeout_cycles;
+    if (detected_events == 0)
+        return event_mask;
+    eu_clear_events(detected_events);
+    return detected_events;
+}
+
+static inline uint32_t eu_wait_all_events(uint32_t event_mask, int mode, uint32_t timeout_cycles)
+{
+    eu_wait_events(event_mask, mode, timeout_cycles);
+    return event_mask;
+}
+
+static inline uint32_t eu_clock_is_enabled(void)
+{
+    return 1;
+}
+
+#endif /*EVENT_UNIT_UTILS_H*/
@@ -0,0 +1,55 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+//
+// MAGIA Host FractalSync ISA Utils
+
+#ifndef FSYNC_ISA_UTILS_H
+#define FSYNC_ISA_UTILS_H
+
+#include "printf.h"
+#include "addr_map/tile_addr_map.h"
+#include "regs/tile_ctrl.h"
+#include "utils/prof_utils.h"
+
+#define _FS_GLOBAL_AGGR (0xFFFFFFFF >> (1 + __builtin_clz(NUM_HARTS)))
+#define _FS_GLOBAL_ID   (-1)
+#define _FS_HNBR_AGGR   (0x1)
+#define _FS_HNBR_ID     (0)
+#define _FS_VNBR_AGGR   (0x1)
+#define _FS_VNBR_ID     (1)
+#define _FS_HRING_AGGR  (0x1)
+#define _FS_HRING_ID    (2)
+#define _FS_VRING_AGGR  (0x1)
+#define _FS_VRING_ID    (3)
+#define _FS_RC_LVL      (NUM_HARTS == 1) ? (0) : (0x1 << (29 - __builtin_clz(NUM_HARTS)))
+#define _FS_RC_AGGR     (0x155 >> (__builtin_clz(NUM_HARTS) - 21))
+
+/**
+ * Barrier model of the FractalSync tree, see targets/magia_host/src/fsync.c.
+ */
+extern void magia_host_fsync(uint32_t id, uint32_t aggregate);
+
+/**
+ * Same semantics as the magia_v2 synch instruction: blocks until all the tiles of the barrier
+ * selected by ID and AGGREGATE have arrived, then raises the fsync event.
+ * The model has no split phase, the barrier is already open when the instruction returns.
+ */
+static inline void fsync_issue(volatile uint32_t id, volatile uint32_t aggregate)
+{
+    prof_snc_s();
+    magia_host_fsync(id, aggregate);
+}
+
+static inline void fsync_poll(void)
+{
+}
+
+static inline void fsync(volatile uint32_t id, volatile uint32_t aggregate)
+{
+    fsync_issue(id, aggregate);
+}
+
+#endif /*FSYNC_ISA_UTILS_H*/
@@ -0,0 +1,92 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+//
+// MAGIA Host Tile Utils
+
+#ifndef MAGIA_TILE_UTILS_H
+#define MAGIA_TILE_UTILS_H
+
+#include <stdint.h>
+#include "printf.h"
+
+/* Addresses are 32-bit on the mesh, widen them before the cast to a host pointer */
+#define mmio64(x)    (*(volatile uint64_t *)(uintptr_t)(x))
+#define mmio32(x)    (*(volatile uint32_t *)(uintptr_t)(x))
+#define mmio16(x)    (*(volatile uint16_t *)(uintptr_t)(x))
+#define mmio8(x)     (*(volatile uint8_t *)(uintptr_t)(x))
+
+#define mmio_fp64(x) (*(volatile float64 *)(uintptr_t)(x))
+#define mmio_fp32(x) (*(volatile float32 *)(uintptr_t)(x))
+#define mmio_fp16(x) (*(volatile float16 *)(uintptr_t)(x))
+
+#define addr64(x)    (*(uint64_t *)(&x))
+#define addr32(x)    (*(uint32_t *)(&x))
+#define addr16(x)    (*(uint16_t *)(&x))
+#define addr8(x)     (*(uint8_t *)(&x))
+
+extern __thread uint32_t magia_host_irq_mask;
+extern __thread uint32_t magia_host_irq_global;
+extern __thread void *magia_host_irq_context;
+
+/**
+ * Take the interrupt lines raised by a host driver, see src/irq.c.
+ */
+extern void irq_host_raise(uint32_t index_oh);
+
+/* The interrupts of a tile are taken on its thread, by the drivers raising them */
+static inline void irq_en(volatile uint32_t index_oh)
+{
+    magia_host_irq_mask |= index_oh;
+}
+
+static inline void irq_dis(volatile uint32_t index_oh)
+{
+    magia_host_irq_mask &= ~index_oh;
+}
+
+/* Global interrupt enable of the tile, the lines raised while it is off are not taken */
+static inline void irq_global_en()
+{
+    magia_host_irq_global = 1;
+}
+
+static inline void irq_global_dis()
+{
+    magia_host_irq_global = 0;
+}
+
+static inline uint32_t irq_st()
+{
+    return 0;
+}
+
+static inline void irq_set_context(void *context)
+{
+    magia_host_irq_context = context;
+}
+
+static inline void *irq_get_context()
+{
+    return magia_host_irq_context;
+}
+
+/* Sentinels and the cycle counter enable have no meaning on the host */
+
+static inline void wait_nop(uint32_t nops)
+{
+    for (volatile unsigned i = 0; i < nops; i++)
+        ;
+}
+
+static inline void sentinel_instr_id() {}
+
+static inline void sentinel_instr_ex() {}
+
+static inline void ccount_en() {}
+
+static inline void ccount_dis() {}
+
+#endif /* MAGIA_TILE_UTILS_H */
@@ -0,0 +1,47 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+//
+// MAGIA Host Utils
+
+#ifndef MAGIA_UTILS_H
+#define MAGIA_UTILS_H
+
+#include "magia_tile_utils.h"
+#include "addr_map/tile_addr_map.h"
+#include "regs/tile_ctrl.h"
+
+/* Mesh tile run by the calling thread, set by the host runtime before entering main */
+extern __thread uint32_t magia_host_hartid;
+
+static inline uint32_t get_hartid()
+{
+    return magia_host_hartid;
+}
+
+// Lookup table indicating the id of row synchronization
+static inline uint32_t row_id_lookup(volatile uint32_t hartid_y)
+{
+    if (hartid_y < MESH_Y_TILES / 2)
+        return 2 * hartid_y;
+    else
+        return 2 * (hartid_y - MESH_Y_TILES / 2);
+}
+
+// Lookup table indicating the id of column synchronization
+static inline uint32_t col_id_lookup(volatile uint32_t hartid_x)
+{
+    if (hartid_x < MESH_X_TILES / 2)
+        return 2 * hartid_x + 1;
+    else
+        return 2 * (hartid_x - MESH_X_TILES / 2) + 1;
+}
+
+static inline uint32_t get_l1_base(uint32_t hartid)
+{
+    return L1_BASE + hartid * L1_TILE_OFFSET;
+}
+
+#endif /* MAGIA_UTILS_H */
@@ -0,0 +1,48 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+//
+// MAGIA Host Performance Utils
+
+#ifndef PERFORMANCE_UTILS_H
+#define PERFORMANCE_UTILS_H
+
+#include <time.h>
+
+/* The host clock always runs */
+static inline void perf_enable_cycles() {}
+
+/**
+ * @brief Returns the host monotonic clock in nanoseconds, truncated to 32 bits.
+ * Only differences are meaningful, and they measure the functional model, not the mesh.
+ */
+static inline unsigned int perf_get_cycles()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned int)((uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec);
+}
+
+/* The testbench sentinels do nothing on the host */
+static inline void sentinel_start() {}
+static inline void sentinel_end() {}
+static inline void stnl_cmi_s() {}
+static inline void stnl_cmo_s() {}
+static inline void stnl_cmp_s() {}
+static inline void stnl_snc_s() {}
+static inline void stnl_ts_s() {}
+static inline void stnl_cmi_f() {}
+static inline void stnl_cmo_f() {}
+static inline void stnl_cmp_f() {}
+static inline void stnl_snc_f() {}
+static inline void stnl_ts_f() {}
+static inline void stnl_cmi_r() {}
+static inline void stnl_cmo_r() {}
+static inline void stnl_cmp_r() {}
+static inline void stnl_snc_r() {}
+static inline void stnl_ts_r() {}
+static inline void stnl_r() {}
+
+#endif
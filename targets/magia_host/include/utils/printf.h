@@ -0,0 +1,13 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+
+#ifndef PRINTF_H
+#define PRINTF_H
+
+/* The tiles print on the host standard output */
+#include <stdio.h>
+
+#endif // PRINTF_H
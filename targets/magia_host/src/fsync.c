@@ -0,0 +1,119 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+//
+// FractalSync model: the synch instruction climbs the tree from the tile, stopping at the levels
+// set in AGGREGATE. Each node of those levels is a barrier merging the two subtrees below it:
+// the first tile arriving sleeps on it, the second one carries on to the next level. The tile
+// completing the highest level opens the barriers it went through, and so do the tiles woken
+// up, until the whole group is released. The ID selects one of the barriers of each node.
+
+#include <stdint.h>
+#include <pthread.h>
+
+#include "addr_map/tile_addr_map.h"
+#include "regs/tile_ctrl.h"
+#include "utils/magia_utils.h"
+#include "utils/eu_isa_utils.h"
+#include "utils/fsync_isa_utils.h"
+
+/* Every barrier in use has a tile sleeping on it */
+#define FSYNC_HOST_BARRIERS (NUM_HARTS)
+
+/* Barrier between the pair of tiles across the boundary of a level 0 node */
+#define FSYNC_HOST_CROSS    (1ull << 47)
+
+typedef struct {
+    uint64_t key;     /**< ID, level and tree node of the barrier. */
+    uint32_t arrived; /**< Tiles arrived from the subtrees, 0 if the slot is free. */
+    uint32_t phase;   /**< Incremented each time the barrier opens. */
+} fsync_host_barrier_t;
+
+static pthread_mutex_t fsync_host_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t fsync_host_cond  = PTHREAD_COND_INITIALIZER;
+static fsync_host_barrier_t fsync_host_barriers[FSYNC_HOST_BARRIERS];
+
+/**
+ * @return Tree node of the given level above the tile, see fsync_getgroup_level.
+ */
+static uint32_t fsync_host_node(uint32_t hartid, uint32_t level, uint32_t dir)
+{
+    uint32_t x_shift = dir ? (level + 1) / 2 : (level + 2) / 2;
+    uint32_t y_shift = dir ? (level + 2) / 2 : (level + 1) / 2;
+
+    return (GET_X_ID(hartid) >> x_shift) +
+           (GET_Y_ID(hartid) >> y_shift) * (MESH_X_TILES >> x_shift);
+}
+
+/**
+ * @return Key of the barrier reached by the tile at the given level.
+ */
+static uint64_t fsync_host_key(uint32_t hartid, uint32_t id, uint32_t aggregate, uint32_t level)
+{
+    uint32_t dir = id & 0x1;
+
+    if (aggregate == 1 && (id == _FS_HRING_ID || id == _FS_VRING_ID)) {
+        /* The pairs are shifted by one tile with respect to the level 0 nodes */
+        uint32_t coord = dir ? GET_Y_ID(hartid) : GET_X_ID(hartid);
+        uint32_t other = dir ? GET_X_ID(hartid) : GET_Y_ID(hartid);
+        return ((uint64_t)id << 48) | FSYNC_HOST_CROSS | (((coord - 1) | 1) << 16) | other;
+    }
+    return ((uint64_t)id << 48) | ((uint64_t)level << 40) | fsync_host_node(hartid, level, dir);
+}
+
+/**
+ * @return The barrier with the given key waiting for its second tile, or a free one.
+ */
+static fsync_host_barrier_t *fsync_host_barrier(uint64_t key)
+{
+    fsync_host_barrier_t *free_slot = NULL;
+
+    for (uint32_t i = 0; i < FSYNC_HOST_BARRIERS; i++) {
+        fsync_host_barrier_t *barrier = &fsync_host_barriers[i];
+        if (barrier->arrived == 1 && barrier->key == key)
+            return barrier;
+        if (barrier->arrived == 0 && free_slot == NULL)
+            free_slot = barrier;
+    }
+    free_slot->key = key;
+    return free_slot;
+}
+
+void magia_host_fsync(uint32_t id, uint32_t aggregate)
+{
+    uint32_t hartid = get_hartid();
+    uint32_t levels = aggregate & ((1u << MAX_SYNC_LVL) - 1);
+    fsync_host_barrier_t *merged[32];
+    uint32_t n_merged = 0;
+
+    pthread_mutex_lock(&fsync_host_lock);
+    for (uint32_t level = 0; level < MAX_SYNC_LVL; level++) {
+        if ((levels & (1u << level)) == 0)
+            continue;
+
+        fsync_host_barrier_t *barrier =
+            fsync_host_barrier(fsync_host_key(hartid, id, aggregate, level));
+        if (barrier->arrived == 0) {
+            /* First from the subtrees, sleep until the group is released */
+            uint32_t phase   = barrier->phase;
+            barrier->arrived = 1;
+            while (barrier->phase == phase)
+                pthread_cond_wait(&fsync_host_cond, &fsync_host_lock);
+            break;
+        }
+        barrier->arrived    = 2;
+        merged[n_merged++] = barrier;
+    }
+
+    for (uint32_t i = 0; i < n_merged; i++) {
+        merged[i]->arrived = 0;
+        merged[i]->phase++;
+    }
+    if (n_merged)
+        pthread_cond_broadcast(&fsync_host_cond);
+    pthread_mutex_unlock(&fsync_host_lock);
+
+    eu_host_set_events(EU_FSYNC_DONE_MASK);
+}
@@ -0,0 +1,105 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+//
+// Host runtime: maps the L1 of the mesh tiles at their logical addresses and runs the test main
+// on one thread per tile, as the crt0 of magia_v2 does on every core.
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <sys/mman.h>
+
+#include "addr_map/tile_addr_map.h"
+#include "utils/prof_utils.h"
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE (0x100000)
+#endif
+
+/* Tile stacks, addresses of locals are passed around as 32-bit values */
+#define HOST_STACK_SIZE (0x00100000)
+
+/* Test main, renamed by the runtime compile definitions */
+extern int magia_tile_main(void);
+
+__thread uint32_t magia_host_hartid;
+__thread uint32_t magia_host_events;
+__thread uint32_t magia_host_event_mask;
+
+static int exit_codes[NUM_HARTS];
+
+static void *tile_thread(void *arg)
+{
+    uint32_t hartid = (uint32_t)(uintptr_t)arg;
+
+    magia_host_hartid = hartid;
+    exit_codes[hartid] = magia_tile_main();
+    prof_dump();
+    return NULL;
+}
+
+int main(void)
+{
+    size_t l1_len = (size_t)NUM_HARTS * L1_TILE_OFFSET;
+    pthread_t threads[NUM_HARTS];
+    pthread_attr_t attr;
+    int errors = 0;
+
+    void *l1 = mmap((void *)(uintptr_t)L1_BASE,
+                    l1_len,
+                    PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE,
+                    -1,
+                    0);
+    if (l1 != (void *)(uintptr_t)L1_BASE) {
+        printf("Could not map the L1 of %d tiles at 0x%x.\n", NUM_HARTS, L1_BASE);
+        return 1;
+    }
+
+    void *prof = mmap((void *)(uintptr_t)PROF_L2_BASE,
+                      PROF_L2_SIZE,
+                      PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE,
+                      -1,
+                      0);
+    if (prof != (void *)(uintptr_t)PROF_L2_BASE) {
+        printf("Could not map the profiler records at 0x%x.\n", PROF_L2_BASE);
+        return 1;
+    }
+
+    for (uint32_t i = 0; i < NUM_HARTS; i++) {
+        void *stack = mmap(NULL,
+                           HOST_STACK_SIZE,
+                           PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT,
+                           -1,
+                           0);
+        if (stack == MAP_FAILED) {
+            printf("Could not allocate the stack of tile %d.\n", i);
+            return 1;
+        }
+        pthread_attr_init(&attr);
+        pthread_attr_setstack(&attr, stack, HOST_STACK_SIZE);
+        if (pthread_create(&threads[i], &attr, tile_thread, (void *)(uintptr_t)i)) {
+            printf("Could not start tile %d.\n", i);
+            return 1;
+        }
+        pthread_attr_destroy(&attr);
+    }
+
+    for (uint32_t i = 0; i < NUM_HARTS; i++) {
+        pthread_join(threads[i], NULL);
+        if (exit_codes[i]) {
+            printf("Tile %d exited with code %d.\n", i, exit_codes[i]);
+            errors = 1;
+        }
+    }
+    /* Records of the tiles that exited profiling, the host equivalent of reading PROF_L2_BASE */
+    prof_report();
+
+    return errors;
+}
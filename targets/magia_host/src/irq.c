@@ -0,0 +1,44 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+//
+// Host interrupts: the lines raised by the drivers of a tile are taken right away on its thread,
+// in place of the trap entry of the magia_v2 crt0.
+
+#include <stdint.h>
+
+#include "utils/magia_tile_utils.h"
+
+__thread uint32_t magia_host_irq_mask;
+__thread uint32_t magia_host_irq_global;
+__thread void *magia_host_irq_context;
+
+static __thread uint32_t irq_host_pending;
+static __thread uint32_t irq_host_active;
+
+/* Interrupt handler of the tile, overridden by the event unit driver */
+__attribute__((weak)) void irq_dispatch(uint32_t line)
+{
+    (void)line;
+}
+
+void irq_host_raise(uint32_t index_oh)
+{
+    if (!magia_host_irq_global)
+        return;
+    irq_host_pending |= index_oh & magia_host_irq_mask;
+
+    /* Handlers run with interrupts disabled: the lines they raise are taken once they return */
+    if (irq_host_active)
+        return;
+
+    irq_host_active = 1;
+    while (irq_host_pending) {
+        uint32_t line = __builtin_ctz(irq_host_pending);
+        irq_host_pending &= ~(1u << line);
+        irq_dispatch(line);
+    }
+    irq_host_active = 0;
+}
@@ -90,6 +90,20 @@ int rowdiv(uint32_t s, uint32_t m, uint32_t h, uint32_t w){
     }
 }
 
+/**
+ * For each row i of the input h x w matrix "s", multiply the values by the i-th element of the "m" vector.
+ */
+int rowmul(uint32_t s, uint32_t m, uint32_t h, uint32_t w){
+    for(uint32_t i = 0; i < h; i++){
+        uint32_t row = s + i * w * 2;
+        _Float16 mul = *(volatile _Float16*)(m + i * 2);
+        for(uint32_t j = 0; j < w; j++){
+            (*(volatile _Float16*)(row + j * 2)) = (*(volatile _Float16*)(row + j * 2)) * mul;
+        }
+    }
+    return 0;
+}
+
 /**
  * Element wise sum of v2 into v1
  */
@@ -133,7 +133,7 @@ inline void fsync_legacy(volatile uint32_t level){
  * 
  * Good luck!
  */
-inline void fsync(volatile uint32_t id, volatile uint32_t aggregate){
+inline void fsync_issue(volatile uint32_t id, volatile uint32_t aggregate){
   #if FSYNC_MM == 0
   asm volatile("addi t1, %0, 0" ::"r"(id));
   asm volatile("addi t0, %0, 0" ::"r"(aggregate));
@@ -155,8 +155,12 @@ inline void fsync(volatile uint32_t id, volatile uint32_t aggregate){
   #endif
   *(volatile uint32_t *)(FSYNC_BASE + FSYNC_CONTROL_REG_OFFSET) = 1;
   #endif
-  #if STALLING == 1
-  // Polling mode - wait for completion
+}
+
+/**
+ * Polls the status register until the barrier of the last synch instruction opens.
+ */
+inline void fsync_poll(void){
   volatile uint32_t status;
   do {
     status = *(volatile uint32_t *)(FSYNC_BASE + FSYNC_STATUS_REG_OFFSET);
@@ -164,6 +168,17 @@ inline void fsync(volatile uint32_t id, volatile uint32_t aggregate){
   #if PROFILE_SNC == 1
   stnl_snc_f();
   #endif
+}
+
+/**
+ * Issues the synch instruction and, in polling mode, waits for the barrier to open.
+ * In interrupt mode the completion is signaled by the fsync event, see eu_fsync_wait.
+ */
+inline void fsync(volatile uint32_t id, volatile uint32_t aggregate){
+  fsync_issue(id, aggregate);
+  #if STALLING == 1
+  // Polling mode - wait for completion
+  fsync_poll();
   #endif
 }
   
@@ -27,7 +27,7 @@
 #include "magia_tile_utils.h"
 #include "performance_utils.h"
 
-#define idma_wait() __asm__ __volatile__("wfi" ::: "memory")
+#define idma_wfi() __asm__ __volatile__("wfi" ::: "memory")
 
 /* conf instruction */
 // asm volatile(
@@ -60,6 +60,33 @@ inline uint32_t irq_st(){
     return irq_status;
 }
 
+inline void irq_dis(volatile uint32_t index_oh){
+    asm volatile("csrrc zero, mie, %0"
+                 ::"r"(index_oh));
+}
+
+/* Global interrupt enable of the core, mstatus.MIE */
+inline void irq_global_en(){
+    asm volatile("csrrsi zero, mstatus, 0x8" ::);
+}
+
+inline void irq_global_dis(){
+    asm volatile("csrrci zero, mstatus, 0x8" ::);
+}
+
+/* Per-tile context of the interrupt dispatcher, kept in mscratch */
+inline void irq_set_context(void *context){
+    asm volatile("csrw mscratch, %0"
+                 ::"r"(context));
+}
+
+inline void *irq_get_context(){
+    void *context;
+    asm volatile("csrr %0, mscratch"
+                 : "=r"(context) :);
+    return context;
+}
+
 inline void wait_nop(uint32_t nops){
     for (int i = 0; i < nops; i++) asm volatile("addi x0, x0, 0" ::);
 }
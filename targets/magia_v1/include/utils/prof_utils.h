@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Authors: Alberto Dequino <alberto.dequino@unibo.it>
+ *
+ * MAGIA Profiler Hooks
+ *
+ * The region profiler is only available on magia_v2: on this legacy target the driver hooks only
+ * trigger the testbench sentinels, as selected by the PROFILE_* build flags.
+ */
+#ifndef PROF_UTILS_H
+#define PROF_UTILS_H
+
+#include "performance_utils.h"
+
+static inline void prof_cmi_s(){
+  #if PROFILE_CMI == 1
+  stnl_cmi_s();
+  #endif
+}
+
+static inline void prof_cmi_f(){
+  #if PROFILE_CMI == 1
+  stnl_cmi_f();
+  #endif
+}
+
+static inline void prof_cmo_s(){
+  #if PROFILE_CMO == 1
+  stnl_cmo_s();
+  #endif
+}
+
+static inline void prof_cmo_f(){
+  #if PROFILE_CMO == 1
+  stnl_cmo_f();
+  #endif
+}
+
+static inline void prof_cmp_s(){
+  #if PROFILE_CMP == 1
+  stnl_cmp_s();
+  #endif
+}
+
+static inline void prof_cmp_f(){
+  #if PROFILE_CMP == 1
+  stnl_cmp_f();
+  #endif
+}
+
+static inline void prof_snc_s(){
+  #if PROFILE_SNC == 1
+  stnl_snc_s();
+  #endif
+}
+
+static inline void prof_snc_f(){
+  #if PROFILE_SNC == 1
+  stnl_snc_f();
+  #endif
+}
+
+#endif /* PROF_UTILS_H */
@@ -51,6 +51,10 @@
 #define L1_TILE_OFFSET    (0x00100000)
 #define L2_BASE           (0xCC000000)
 #define TEST_END_ADDR     (0xCCFF0000)
+#define PROF_L1_SIZE      (0x00000200) // Profiler state, at the top of every tile's L1
+#define PROF_L1_OFFSET    (L1_SIZE + 1 - PROF_L1_SIZE)
+#define PROF_L2_BASE      (0xCCF80000) // Profiler records dumped at exit, one per tile
+#define PROF_L2_SIZE      (0x00010000)
 #define PRINT_ADDR        (0xFFFF0004)
 #define MHARTID_OFFSET    (0x00100000)
 #include "tile_config.h"
@@ -197,11 +197,13 @@
 #define IDMA_CONF_ENABLE_ND_SHIFT    (10)
 #define IDMA_STATUS_BUSY_MASK        (0x3FF) // bits 9:0
 
-// Enum IDMA Transfer protocols
+// Enum IDMA Transfer protocols (C only, crt0.S includes this file)
+#ifndef __ASSEMBLER__
 typedef enum {
     IDMA_PROT_AXI = 0, // AXI protocol: L2 memory
     IDMA_PROT_OBI = 1, // OBI protocol: L1 memory
 } idma_prot_t;
+#endif
 
 //=============================================================================
 // RedMule Register Addresses
@@ -19,6 +19,7 @@
 #include "utils/fsync_isa_utils.h"
 // #include "utils/attention_utils.h"
 #include "utils/performance_utils.h"
+#include "utils/prof_utils.h"
 // #include "utils/amo_utils.h"
 #include "utils/eu_isa_utils.h"
 #include "utils/magia_spatz_utils.h"
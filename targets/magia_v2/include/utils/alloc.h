@@ -16,42 +16,290 @@
  *
  * Authors: Alberto Dequino <alberto.dequino@unibo.it>
  *
- * MAGIA Attention ISA Utils
+ * MAGIA L1 Allocator
  */
 #ifndef ALLOC_H_
 #define ALLOC_H_
 
 #include "magia_utils.h"
 
-#define ALIGNMENT      (4)
-#define ALIGN_4B(addr) (((addr) + (ALIGNMENT - 1)) & ~(ALIGNMENT - 1))
+#define ALIGNMENT            (4)
+#define ALIGN_4B(addr)       (((addr) + (ALIGNMENT - 1)) & ~(ALIGNMENT - 1))
+#define ALIGN_UP(addr, algn) (((addr) + ((algn) - 1)) & ~((algn) - 1))
+/* Smallest address not below `addr` that is `ofs` bytes past a multiple of `algn` */
+#define ALIGN_OFS(addr, algn, ofs) ((addr) + (((ofs) - (addr)) & ((algn) - 1)))
 
-#define L1_TILE_BASE   (L1_BASE + (get_hartid() * L1_TILE_OFFSET))
-#define L1_TILE_END    (L1_TILE_BASE + L1_SIZE)
+/* Bytes covering every L1 bank exactly once: buffers aligned to it start on bank 0 */
+#define L1_BANK_WIDTH        (NUM_L1_BANKS * 4)
 
-#define L1_TAIL        (L1_TILE_BASE)
+/**
+ * Allocation granule: sizes and addresses are multiples of it, so that every leftover piece can
+ * hold the next pointer and size of a free block.
+ */
+#define L1_ALLOC_GRAIN       (8)
+/* Number of segregated free lists, list k holds blocks of [8 << k, 8 << (k + 1)) bytes */
+#define L1_ALLOC_CLASSES     (16)
+
+#define L1_TILE_BASE         (L1_BASE + (get_hartid() * L1_TILE_OFFSET))
+#define L1_TILE_END          (L1_TILE_BASE + PROF_L1_OFFSET) /* The profiler state sits above */
+
+/**
+ * Allocator state, kept at the base of each tile's L1 (globals live in the shared L2).
+ * The bump pointer stays the first word, so L1_TAIL still points to it.
+ */
+typedef struct {
+    uint32_t tail;                   /**< First free byte above every allocation. */
+    uint32_t hwm;                    /**< Highest value ever reached by tail. */
+    uint32_t floor;                  /**< Base of the innermost open arena. */
+    uint32_t free[L1_ALLOC_CLASSES]; /**< Heads of the segregated free lists. */
+} l1_heap_t;
+
+#define L1_HEAP ((volatile l1_heap_t *)L1_TILE_BASE)
+#define L1_TAIL (L1_TILE_BASE)
 #define L1_TAIL_START                                                                              \
-    ALIGN_4B(L1_TILE_BASE + (sizeof(uint32_t))) /* Reserves 4 Bytes for L1_TAIL                    \
-                                                 */
+    ALIGN_UP(L1_TILE_BASE + sizeof(l1_heap_t), L1_ALLOC_GRAIN) /* Reserves the l1_heap_t */
+
+/* Free blocks are linked through their first two words */
+#define L1_BLK_NEXT(blk) mmio32(blk)
+#define L1_BLK_SIZE(blk) mmio32((blk) + 4)
 
 static inline void l1_alloc_init(void)
 {
-    mmio32(L1_TAIL) = L1_TAIL_START;
+    volatile l1_heap_t *heap = L1_HEAP;
+    heap->tail               = L1_TAIL_START;
+    heap->hwm                = L1_TAIL_START;
+    heap->floor              = L1_TAIL_START;
+    for (uint32_t k = 0; k < L1_ALLOC_CLASSES; k++)
+        heap->free[k] = 0;
 }
 
-static inline void *l1_alloc(size_t size)
+static inline uint32_t l1_alloc_class(uint32_t size)
+{
+    uint32_t k = 31 - __builtin_clz(size / L1_ALLOC_GRAIN);
+    return (k < L1_ALLOC_CLASSES) ? k : (L1_ALLOC_CLASSES - 1);
+}
+
+static inline uint32_t l1_alloc_size(size_t size)
+{
+    uint32_t bytes = ALIGN_UP((uint32_t)size, L1_ALLOC_GRAIN);
+    return bytes ? bytes : L1_ALLOC_GRAIN;
+}
+
+/**
+ * Unlinks the free block adjacent to [blk, blk + size), if any, and returns it (0 otherwise).
+ */
+static inline uint32_t l1_unlink_neighbour(uint32_t blk, uint32_t size)
+{
+    volatile l1_heap_t *heap = L1_HEAP;
+    for (uint32_t k = 0; k < L1_ALLOC_CLASSES; k++) {
+        volatile uint32_t *link = &heap->free[k];
+        for (uint32_t nbr = *link; nbr; link = &L1_BLK_NEXT(nbr), nbr = *link) {
+            if (nbr + L1_BLK_SIZE(nbr) == blk || blk + size == nbr) {
+                *link = L1_BLK_NEXT(nbr);
+                return nbr;
+            }
+        }
+    }
+    return 0;
+}
+
+/**
+ * Returns [blk, blk + size) to the heap: it is merged with the adjacent free blocks, then either
+ * lowers the bump pointer (top of the heap) or goes on its free list.
+ */
+static inline void l1_free_block(uint32_t blk, uint32_t size)
 {
-    uint32_t current_offset = mmio32(L1_TAIL);
-    uint32_t next_offset    = ALIGN_4B(current_offset + size);
+    volatile l1_heap_t *heap = L1_HEAP;
+    uint32_t nbr;
+
+    if (size == 0)
+        return;
+    while ((nbr = l1_unlink_neighbour(blk, size))) {
+        size += L1_BLK_SIZE(nbr);
+        blk = (nbr < blk) ? nbr : blk;
+    }
+    if (blk + size == heap->tail && blk >= heap->floor) {
+        heap->tail = blk;
+        return;
+    }
+    uint32_t k       = l1_alloc_class(size);
+    L1_BLK_NEXT(blk) = heap->free[k];
+    L1_BLK_SIZE(blk) = size;
+    heap->free[k]    = blk;
+}
+
+/**
+ * First fit on the free lists, starting from the class of `size`. The block is split around the
+ * aligned allocation and the leftovers go back to the free lists.
+ * Blocks below the innermost open arena are skipped, so that l1_reset releases every allocation
+ * made inside it.
+ */
+static inline uint32_t l1_alloc_from_free(uint32_t size, uint32_t align, uint32_t offset)
+{
+    volatile l1_heap_t *heap = L1_HEAP;
+    for (uint32_t k = l1_alloc_class(size); k < L1_ALLOC_CLASSES; k++) {
+        volatile uint32_t *link = &heap->free[k];
+        for (uint32_t blk = *link; blk; link = &L1_BLK_NEXT(blk), blk = *link) {
+            uint32_t end  = blk + L1_BLK_SIZE(blk);
+            uint32_t addr = ALIGN_OFS(blk, align, offset);
+            if (blk < heap->floor || addr + size > end || addr < blk)
+                continue;
+            *link = L1_BLK_NEXT(blk);
+            l1_free_block(blk, addr - blk);
+            l1_free_block(addr + size, end - (addr + size));
+            return addr;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Allocates `size` bytes of the tile's L1 starting `offset` bytes past a multiple of `align`
+ * (a power of two). `offset` is rounded down to the allocation granule.
+ * Returns NULL when out of memory.
+ */
+static inline void *l1_alloc_offset(size_t size, uint32_t align, uint32_t offset)
+{
+    volatile l1_heap_t *heap = L1_HEAP;
+    uint32_t bytes           = l1_alloc_size(size);
+
+    align  = (align < L1_ALLOC_GRAIN) ? L1_ALLOC_GRAIN : align;
+    offset = (offset % align) & ~(L1_ALLOC_GRAIN - 1);
+
+    uint32_t addr = l1_alloc_from_free(bytes, align, offset);
+    if (addr)
+        return (void *)addr;
+
+    uint32_t current_offset = heap->tail;
+    addr                    = ALIGN_OFS(current_offset, align, offset);
+    uint32_t next_offset    = addr + bytes;
 
     /* check: out-of-memory || overflow (if 'size' is too big) */
-    if (next_offset > L1_TILE_END || next_offset < current_offset) {
+    if (next_offset > L1_TILE_END || next_offset < current_offset || addr < current_offset) {
         return NULL;
     }
 
-    mmio32(L1_TAIL) = next_offset;
+    heap->tail = next_offset;
+    if (next_offset > heap->hwm)
+        heap->hwm = next_offset;
+    l1_free_block(current_offset, addr - current_offset);
 
-    return (void *)(current_offset);
+    return (void *)addr;
+}
+
+/**
+ * Allocates `size` bytes of the tile's L1 aligned to `align` (a power of two).
+ * Use L1_BANK_WIDTH to make the buffer start on the first L1 bank.
+ * Returns NULL when out of memory.
+ */
+static inline void *l1_alloc_aligned(size_t size, uint32_t align)
+{
+    return l1_alloc_offset(size, align, 0);
+}
+
+static inline void *l1_alloc(size_t size)
+{
+    return l1_alloc_aligned(size, L1_ALLOC_GRAIN);
+}
+
+/**
+ * Returns a block obtained from l1_alloc or l1_alloc_aligned, `size` being the requested size.
+ */
+static inline void l1_free(void *ptr, size_t size)
+{
+    if (ptr == NULL)
+        return;
+    l1_free_block((uint32_t)ptr, l1_alloc_size(size));
+}
+
+/**
+ * Allocates `size` bytes starting on L1 bank `bank` (rounded down to an even bank).
+ */
+static inline void *l1_alloc_bank(size_t size, uint32_t bank)
+{
+    return l1_alloc_offset(size, L1_BANK_WIDTH, (bank % NUM_L1_BANKS) * 4);
+}
+
+/**
+ * Places `n` buffers accessed at the same time (e.g. the X, W and Y streams of RedMulE and the
+ * iDMA port) so that each one starts on its own group of NUM_L1_BANKS / n banks. Streams moving
+ * at the same pace then keep hitting different banks instead of colliding on the same one, as
+ * happens with buffers whose sizes are multiples of L1_BANK_WIDTH laid out back to back.
+ *
+ * @param bufs  Filled with the L1 addresses of the buffers.
+ * @param sizes Sizes in bytes of the buffers.
+ * @return 0 on success, 1 when out of memory (nothing is allocated).
+ */
+static inline int l1_alloc_streams(uint32_t *bufs, const uint32_t *sizes, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        bufs[i] = (uint32_t)l1_alloc_bank(sizes[i], (i * NUM_L1_BANKS) / n);
+        if (bufs[i] == 0) {
+            while (i--)
+                l1_free((void *)bufs[i], sizes[i]);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Arena mark, returned by l1_mark and consumed by l1_reset.
+ */
+typedef struct {
+    uint32_t tail;  /**< Bump pointer when the arena was opened. */
+    uint32_t floor; /**< Base of the enclosing arena. */
+} l1_mark_t;
+
+/**
+ * Opens an arena: everything allocated until the matching l1_reset is released at once.
+ * Arenas nest, and must be closed in reverse order.
+ */
+static inline l1_mark_t l1_mark(void)
+{
+    volatile l1_heap_t *heap = L1_HEAP;
+    l1_mark_t mark           = {.tail = heap->tail, .floor = heap->floor};
+    heap->floor              = heap->tail;
+    return mark;
+}
+
+/**
+ * Closes the arena opened by `mark`, dropping every allocation and free block above it.
+ */
+static inline void l1_reset(l1_mark_t mark)
+{
+    volatile l1_heap_t *heap = L1_HEAP;
+    for (uint32_t k = 0; k < L1_ALLOC_CLASSES; k++) {
+        volatile uint32_t *link = &heap->free[k];
+        while (*link) {
+            uint32_t blk = *link;
+            if (blk >= mark.tail) {
+                *link = L1_BLK_NEXT(blk);
+                continue;
+            }
+            if (blk + L1_BLK_SIZE(blk) > mark.tail)
+                L1_BLK_SIZE(blk) = mark.tail - blk;
+            link = &L1_BLK_NEXT(blk);
+        }
+    }
+    heap->tail  = mark.tail;
+    heap->floor = mark.floor;
+}
+
+/**
+ * Peak number of L1 bytes used by the allocator (state included) since l1_alloc_init.
+ */
+static inline uint32_t l1_high_water(void)
+{
+    return L1_HEAP->hwm - L1_TILE_BASE;
+}
+
+/**
+ * Number of L1 bytes below the bump pointer (state included), free blocks included.
+ */
+static inline uint32_t l1_used(void)
+{
+    return L1_HEAP->tail - L1_TILE_BASE;
 }
 
-#endif /* ALLOG_H_ */
\ No newline at end of file
+#endif /* ALLOC_H_ */
@@ -23,31 +23,23 @@
 #define ATTENTION_UTILS_H
 
 #include "magia_tile_utils.h"
+#include "vect_utils.h"
 
  /**
  * Element-wise comparison of the max vectors.
  * Saves in the curr buffer the bigger values.
  */
 int max_compare(uint32_t curr, uint32_t prev, uint32_t dim){
-    for(uint32_t i = 0; i < dim; i++){
-        if((*(volatile _Float16*)(prev + (i * 2))) > (*(volatile _Float16*)(curr + (i * 2))))
-            (*(volatile _Float16*)(curr + (i * 2))) = (*(volatile _Float16*)(prev + (i * 2)));
-    }
+    return vect_max_f16(curr, curr, prev, dim);
 }
 
 /**
  * Finds the max value for each row and saves it in the result in the maxes buffer.
  */
 int rowmax(uint32_t s, uint32_t maxes, uint32_t dim_h, uint32_t dim_w){
-    for(uint32_t i = 0; i < dim_h; i++){
-        uint32_t row = s + i * dim_w * 2;
-        _Float16 rowmax = 0;
-        for(uint32_t j = 0; j < dim_w; j++){
-            if((*(volatile _Float16*)(row + j * 2)) > rowmax)
-                rowmax = *(volatile _Float16*)(row + j * 2);
-        }
-        (*(volatile _Float16*)(maxes + i * 2)) = rowmax;
-    }
+    for(uint32_t i = 0; i < dim_h; i++)
+        (*(volatile _Float16*)(maxes + i * 2)) = vect_reduce_max_f16(s + i * dim_w * 2, dim_w);
+    return 0;
 }
 
 /**
@@ -67,14 +59,9 @@ int rowdiff(uint32_t s, uint32_t m, uint32_t h, uint32_t w){
  * For each row i of the input h x w matrix "s", sum the values and store it in the i-th element of the "l" vector.
  */
 int rowsum(uint32_t s, uint32_t l, uint32_t h, uint32_t w){
-    for(uint32_t i = 0; i < h; i++){
-        uint32_t row = s + i * 2 * w;
-        uint16_t sum = 0;
-        for(uint32_t j = 0; j < w; j++){
-            sum = sum + *(volatile _Float16*)(row + j * 2);
-        }
-        (*(volatile _Float16*)(l + i * 2)) = sum;
-    }
+    for(uint32_t i = 0; i < h; i++)
+        (*(volatile _Float16*)(l + i * 2)) = vect_reduce_sum_f16(s + i * 2 * w, w);
+    return 0;
 }
 
 /**
@@ -90,31 +77,34 @@ int rowdiv(uint32_t s, uint32_t m, uint32_t h, uint32_t w){
     }
 }
 
+/**
+ * For each row i of the input h x w matrix "s", multiply the values by the i-th element of the "m" vector.
+ */
+int rowmul(uint32_t s, uint32_t m, uint32_t h, uint32_t w){
+    for(uint32_t i = 0; i < h; i++)
+        vect_scale_f16(s + i * w * 2, s + i * w * 2, *(volatile _Float16*)(m + i * 2), w);
+    return 0;
+}
+
 /**
  * Element wise sum of v2 into v1
  */
 int vect_sum(uint32_t v1, uint32_t v2, uint32_t dim){
-    for(uint32_t i = 0; i < dim; i++){
-        (*(volatile _Float16*)(v1 + i * 2)) = *(volatile _Float16*)(v1 + i * 2) + *(volatile _Float16*)(v2 + i * 2);
-    }
+    return vect_add_f16(v1, v1, v2, dim);
 }
 
 /**
  * Element wise diff of v2 into v1
  */
 int vect_diff(uint32_t v1, uint32_t v2, uint32_t dim){
-    for(uint32_t i = 0; i < dim; i++){
-        (*(volatile _Float16*)(v1 + i * 2)) = *(volatile _Float16*)(v1 + i * 2) - *(volatile _Float16*)(v2 + i * 2);
-    }
+    return vect_sub_f16(v1, v1, v2, dim);
 }
 
 /**
  * Element wise product of v2 into v1
  */
 int vect_prod(uint32_t v1, uint32_t v2, uint32_t dim){
-    for(uint32_t i = 0; i < dim; i++){
-        (*(volatile _Float16*)(v1 + i * 2)) = (*(volatile _Float16*)(v1 + i * 2)) * (*(volatile _Float16*)(v2 + i * 2));
-    }
+    return vect_mul_f16(v1, v1, v2, dim);
 }
 
 #define GIST_A  12102203.17133801f
@@ -122,14 +112,21 @@ int vect_prod(uint32_t v1, uint32_t v2, uint32_t dim){
 #define GIST_C  8388608
 #define GIST_D  2139095040
 
+/**
+ * exp(x) approximated on the bits of a single-precision float (Schraudolph 1999). The argument
+ * is scaled in single precision, as it does not fit a _Float16.
+ */
 _Float16 fastexp_gist(_Float16 x) {
-    x = GIST_A * x + GIST_B;
+    float y = GIST_A * (float)x + GIST_B;
 
-    if (x < GIST_C || x > GIST_D)
-        x = (x < GIST_C) ? 0.0f : GIST_D;
+    if (y < GIST_C || y > GIST_D)
+        y = (y < GIST_C) ? 0.0f : GIST_D;
 
-    uint32_t n = (uint32_t)(x);
-    return *(_Float16 *) &n;
+    union {
+        uint32_t n;
+        float f;
+    } bits = {.n = (uint32_t)y};
+    return (_Float16)bits.f;
 }
 
 int exponential(uint32_t matrix, uint32_t rows, uint32_t columns){
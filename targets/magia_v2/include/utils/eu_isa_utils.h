@@ -199,6 +199,62 @@ static inline uint32_t eu_wait_events(uint32_t event_mask, int mode, uint32_t ti
     }
 }
 
+/**
+ * @brief Wait until at least one of the events is present, without consuming the others
+ * @param event_mask Bitmask of events to wait for
+ * @param mode Wait mode (polling, WFE, etc.)
+ * @param timeout_cycles Timeout in cycles (polling mode only, 0 = infinite)
+ * @return Bitmask of the events detected, which are cleared; 0 if timeout
+ */
+static inline uint32_t eu_wait_any_events(uint32_t event_mask, int mode, uint32_t timeout_cycles)
+{
+    uint32_t cycles = 0;
+    uint32_t detected_events;
+
+    if (mode != 0 && mode != 1) {
+        printf("ERROR: Unrecognized wait mode.\n");
+        return 0;
+    }
+
+    while ((detected_events = eu_check_events(event_mask)) == 0) {
+        if (mode == 1) {
+            evt_read32(EU_CORE_EVENT_WAIT);
+            continue;
+        }
+
+        wait_nop(10);
+        cycles += 10;
+        if (timeout_cycles != 0 && cycles >= timeout_cycles) {
+            printf("ERROR: TIMEOUT ON POLLING EVENT!\n");
+            return 0;
+        }
+    }
+
+    eu_clear_events(detected_events);
+    return detected_events;
+}
+
+/**
+ * @brief Wait until all the events have been present, consuming each one as it arrives
+ * @param event_mask Bitmask of events to wait for
+ * @param mode Wait mode (polling, WFE, etc.)
+ * @param timeout_cycles Timeout in cycles for each event (polling mode only, 0 = infinite)
+ * @return event_mask, 0 if timeout
+ */
+static inline uint32_t eu_wait_all_events(uint32_t event_mask, int mode, uint32_t timeout_cycles)
+{
+    uint32_t pending_events = event_mask;
+
+    while (pending_events) {
+        uint32_t detected_events = eu_wait_any_events(pending_events, mode, timeout_cycles);
+        if (detected_events == 0)
+            return 0;
+        pending_events &= ~detected_events;
+    }
+
+    return event_mask;
+}
+
 //=============================================================================
 // Clock Status Function
 //=============================================================================
@@ -26,7 +26,7 @@
 #include "printf.h"
 #include "addr_map/tile_addr_map.h"
 #include "regs/tile_ctrl.h"
-#include "performance_utils.h"
+#include "prof_utils.h"
 
 #define _FS_GLOBAL_AGGR (0xFFFFFFFF >> (1 + __builtin_clz(NUM_HARTS)))
 #define _FS_GLOBAL_ID   (-1)
@@ -141,14 +141,13 @@ inline void fsync_legacy(volatile uint32_t level)
  *
  * Good luck!
  */
-inline void fsync(volatile uint32_t id, volatile uint32_t aggregate)
+static inline void fsync_issue(volatile uint32_t id, volatile uint32_t aggregate)
 {
 #if FSYNC_MM == 0
+    /* Before loading the operands: the profiler hook may use t0 and t1 */
+    prof_snc_s();
     asm volatile("addi t1, %0, 0" ::"r"(id));
     asm volatile("addi t0, %0, 0" ::"r"(aggregate));
-#if PROFILE_SNC == 1
-    stnl_snc_s();
-#endif
     asm volatile(".word (0x0       << 25) | \
               (0b00110   << 20) | \
               (0b00101   << 15) | \
@@ -158,20 +157,33 @@ inline void fsync(volatile uint32_t id, volatile uint32_t aggregate)
 #else
     *(volatile uint32_t *)(FSYNC_BASE + FSYNC_AGGR_REG_OFFSET) = aggregate;
     *(volatile uint32_t *)(FSYNC_BASE + FSYNC_ID_REG_OFFSET)   = id;
-#if PROFILE_SNC == 1
-    stnl_snc_s();
-#endif
+    prof_snc_s();
     *(volatile uint32_t *)(FSYNC_BASE + FSYNC_CONTROL_REG_OFFSET) = 1;
 #endif
-#if STALLING == 1
-    // Polling mode - wait for completion
+}
+
+/**
+ * Polls the status register until the barrier of the last synch instruction opens.
+ */
+static inline void fsync_poll(void)
+{
     volatile uint32_t status;
     do {
         status = *(volatile uint32_t *)(FSYNC_BASE + FSYNC_STATUS_REG_OFFSET);
     } while (status & FSYNC_STATUS_BUSY_MASK);
-#if PROFILE_SNC == 1
-    stnl_snc_f();
-#endif
+    prof_snc_f();
+}
+
+/**
+ * Issues the synch instruction and, in polling mode, waits for the barrier to open.
+ * In interrupt mode the completion is signaled by the fsync event, see eu_fsync_wait.
+ */
+static inline void fsync(volatile uint32_t id, volatile uint32_t aggregate)
+{
+    fsync_issue(id, aggregate);
+#if STALLING == 1
+    // Polling mode - wait for completion
+    fsync_poll();
 #endif
 }
 
@@ -14,13 +14,19 @@
  * limitations under the License.
  * SPDX-License-Identifier: Apache-2.0
  *
- * MAGIA GEMM Utils — fp16 conversion helpers
+ * MAGIA GEMM Utils — fp16 conversion helpers, double-buffered tiled GEMM and SUMMA mesh GEMM
  */
 
 #ifndef GEMM_UTILS_H
 #define GEMM_UTILS_H
 
 #include <stdint.h>
+#include "printf.h"
+#include "idma.h"
+#include "redmule.h"
+#include "eventunit.h"
+#include "fsync.h"
+#include "collectives.h"
 
 /* Decode an fp16 bit pattern to a signed integer in millis (value × 1000).
  * Works directly on the bit string: sign(1)|exp(5)|mant(10).
@@ -64,4 +70,447 @@ static inline double fp16_to_f64(uint16_t h)
     return u.d;
 }
 
+//=============================================================================
+// Double-buffered tiled GEMM
+//=============================================================================
+
+#define GEMM_TILED_ELEM_SIZE (2) /* fp16 */
+#define GEMM_TILED_ALIGN(x)  (((x) + 3) & ~3)
+
+/* Inner-dimension slices are not shrunk below this size before the output tile is */
+#ifndef GEMM_TILED_MIN_SLICE
+#define GEMM_TILED_MIN_SLICE (16)
+#endif
+
+#ifndef GEMM_TILED_WAIT_MODE
+#define GEMM_TILED_WAIT_MODE WFE
+#endif
+
+/**
+ * Tiled GEMM problem: Y = X * W + Y, with X [m x n], W [n x k] and Y [m x k] in L2.
+ * Leading dimensions are row strides in elements, so sub-matrices of larger L2 matrices can be
+ * passed directly.
+ */
+typedef struct {
+    uint32_t x;       /**< L2 address of X. */
+    uint32_t w;       /**< L2 address of W. */
+    uint32_t y;       /**< L2 address of Y, accumulated in place. */
+    uint32_t m;       /**< Rows of X and Y. */
+    uint32_t n;       /**< Columns of X, rows of W. */
+    uint32_t k;       /**< Columns of W and Y. */
+    uint32_t ldx;     /**< Row stride of X in elements. */
+    uint32_t ldw;     /**< Row stride of W in elements. */
+    uint32_t ldy;     /**< Row stride of Y in elements. */
+    uint32_t l1_base; /**< Start of the L1 scratch area. */
+    uint32_t l1_size; /**< Size in bytes of the L1 scratch area. */
+} gemm_tiled_t;
+
+/**
+ * L1 bytes needed by an output tile [tm x tk] and two slices of X [tm x tn] and W [tn x tk].
+ */
+static inline uint32_t gemm_tiled_footprint(uint32_t tm, uint32_t tn, uint32_t tk)
+{
+    return GEMM_TILED_ALIGN(tm * tk * GEMM_TILED_ELEM_SIZE) +
+           2 * GEMM_TILED_ALIGN(tm * tn * GEMM_TILED_ELEM_SIZE) +
+           2 * GEMM_TILED_ALIGN(tn * tk * GEMM_TILED_ELEM_SIZE) + 4;
+}
+
+/**
+ * Choose the tile sizes for a (m, n, k) problem in `budget` bytes of L1.
+ * The inner-dimension slice is shrunk first, as it only adds RedMulE jobs, then the larger of the
+ * two output tile sides, which instead adds L2 traffic.
+ *
+ * @return 0 on success, 1 if not even a 1x1x1 tiling fits.
+ */
+static inline int gemm_tiled_choose(
+    uint32_t m, uint32_t n, uint32_t k, uint32_t budget, uint32_t *tm, uint32_t *tn, uint32_t *tk)
+{
+    /* RedMulE takes 16-bit dimensions */
+    *tm = (m > 0xFFFF) ? 0xFFFF : m;
+    *tn = (n > 0xFFFF) ? 0xFFFF : n;
+    *tk = (k > 0xFFFF) ? 0xFFFF : k;
+
+    while (gemm_tiled_footprint(*tm, *tn, *tk) > budget) {
+        if (*tn > GEMM_TILED_MIN_SLICE) {
+            *tn = (*tn + 1) / 2;
+        } else if (*tm > 1 && *tm >= *tk) {
+            *tm = (*tm + 1) / 2;
+        } else if (*tk > 1) {
+            *tk = (*tk + 1) / 2;
+        } else if (*tn > 1) {
+            *tn = (*tn + 1) / 2;
+        } else {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Issue the loads of the X [cm x cn] and W [cn x ck] slices starting at inner index n0.
+ *
+ * @return Handle of the last issued load.
+ */
+static inline idma_handle_t gemm_tiled_load_slice(idma_controller_t *idma,
+                                                  const gemm_tiled_t *g,
+                                                  uint32_t i0,
+                                                  uint32_t j0,
+                                                  uint32_t n0,
+                                                  uint32_t cm,
+                                                  uint32_t cn,
+                                                  uint32_t ck,
+                                                  uint32_t l1_x,
+                                                  uint32_t l1_w)
+{
+    idma_memcpy_2d_async(idma,
+                         0,
+                         g->x + ((i0 * g->ldx) + n0) * GEMM_TILED_ELEM_SIZE,
+                         l1_x,
+                         cn * GEMM_TILED_ELEM_SIZE,
+                         g->ldx * GEMM_TILED_ELEM_SIZE,
+                         cm);
+    return idma_memcpy_2d_async(idma,
+                                0,
+                                g->w + ((n0 * g->ldw) + j0) * GEMM_TILED_ELEM_SIZE,
+                                l1_w,
+                                ck * GEMM_TILED_ELEM_SIZE,
+                                g->ldw * GEMM_TILED_ELEM_SIZE,
+                                cn);
+}
+
+/**
+ * Output-stationary tiled GEMM on a single mesh-tile.
+ * Tile sizes are chosen from the L1 budget, edges that are not a multiple of the tile sizes are
+ * handled with smaller tiles. For every output tile the X and W slices of the inner dimension are
+ * double buffered: the DMA of slice s+1 runs while RedMulE computes on slice s, and the store of
+ * an output tile overlaps with the first loads of the next one.
+ *
+ * The iDMA and RedMulE events must be enabled in the event unit when STALLING == 0.
+ *
+ * @param idma    IDMA controller handle.
+ * @param redmule RedMulE controller handle.
+ * @param eu      Event unit controller handle (unused when STALLING == 1).
+ * @param g       GEMM problem.
+ *
+ * @return 0 on success, 1 if the L1 budget is too small.
+ */
+static inline int gemm_tiled(idma_controller_t *idma,
+                             redmule_controller_t *redmule,
+                             eu_controller_t *eu,
+                             const gemm_tiled_t *g)
+{
+    uint32_t tm, tn, tk;
+    uint32_t l1_y, l1_x[2], l1_w[2];
+    idma_handle_t y_store = IDMA_HANDLE_NONE;
+
+    if (gemm_tiled_choose(g->m, g->n, g->k, g->l1_size, &tm, &tn, &tk)) {
+        printf("GEMM_TILED: L1 budget of %d bytes is too small.\n", g->l1_size);
+        return 1;
+    }
+
+    l1_y    = GEMM_TILED_ALIGN(g->l1_base);
+    l1_x[0] = GEMM_TILED_ALIGN(l1_y + tm * tk * GEMM_TILED_ELEM_SIZE);
+    l1_x[1] = GEMM_TILED_ALIGN(l1_x[0] + tm * tn * GEMM_TILED_ELEM_SIZE);
+    l1_w[0] = GEMM_TILED_ALIGN(l1_x[1] + tm * tn * GEMM_TILED_ELEM_SIZE);
+    l1_w[1] = GEMM_TILED_ALIGN(l1_w[0] + tn * tk * GEMM_TILED_ELEM_SIZE);
+
+    for (uint32_t i0 = 0; i0 < g->m; i0 += tm) {
+        uint32_t cm = (g->m - i0 < tm) ? (g->m - i0) : tm;
+
+        for (uint32_t j0 = 0; j0 < g->k; j0 += tk) {
+            uint32_t ck    = (g->k - j0 < tk) ? (g->k - j0) : tk;
+            uint32_t cn    = (g->n < tn) ? g->n : tn;
+            uint32_t axi_y = g->y + ((i0 * g->ldy) + j0) * GEMM_TILED_ELEM_SIZE;
+            idma_handle_t loaded;
+
+            /* First slice, overlapped with the store of the previous output tile */
+            gemm_tiled_load_slice(idma, g, i0, j0, 0, cm, cn, ck, l1_x[0], l1_w[0]);
+            if (y_store)
+                idma_wait(idma, y_store);
+            loaded = idma_memcpy_2d_async(idma,
+                                          0,
+                                          axi_y,
+                                          l1_y,
+                                          ck * GEMM_TILED_ELEM_SIZE,
+                                          g->ldy * GEMM_TILED_ELEM_SIZE,
+                                          cm);
+            idma_wait(idma, loaded);
+
+            for (uint32_t n0 = 0, s = 0; n0 < g->n; n0 += tn, s++) {
+                uint32_t buf     = s & 1;
+                uint32_t n0_next = n0 + tn;
+
+                cn = (g->n - n0 < tn) ? (g->n - n0) : tn;
+
+                /* Prefetch the next slice in the buffer freed by the previous job */
+                if (n0_next < g->n) {
+                    uint32_t cn_next = (g->n - n0_next < tn) ? (g->n - n0_next) : tn;
+                    loaded           = gemm_tiled_load_slice(
+                        idma, g, i0, j0, n0_next, cm, cn_next, ck, l1_x[buf ^ 1], l1_w[buf ^ 1]);
+                }
+
+                redmule_gemm(redmule,
+                             l1_x[buf],
+                             l1_w[buf],
+                             l1_y,
+                             (uint16_t)cm,
+                             (uint16_t)cn,
+                             (uint16_t)ck);
+#if STALLING == 0
+                eu_redmule_wait(eu, GEMM_TILED_WAIT_MODE);
+#endif
+
+                if (n0_next < g->n)
+                    idma_wait(idma, loaded);
+            }
+
+            y_store = idma_memcpy_2d_async(idma,
+                                           1,
+                                           axi_y,
+                                           l1_y,
+                                           ck * GEMM_TILED_ELEM_SIZE,
+                                           g->ldy * GEMM_TILED_ELEM_SIZE,
+                                           cm);
+        }
+    }
+
+    if (y_store)
+        idma_wait(idma, y_store);
+
+    return 0;
+}
+
+//=============================================================================
+// SUMMA GEMM over the whole mesh
+//=============================================================================
+
+/**
+ * Owner loads of panel p: the X panel [cm x cn] is fetched from L2 by the tile of column
+ * p % MESH_X_TILES of every mesh row, the W panel [cn x ck] by the tile of row p % MESH_Y_TILES of
+ * every mesh column.
+ *
+ * @return Handle of the last issued load, IDMA_HANDLE_NONE if the tile owns neither panel.
+ */
+static inline idma_handle_t gemm_summa_load_panel(idma_controller_t *idma,
+                                                  const gemm_tiled_t *g,
+                                                  uint32_t p,
+                                                  uint32_t i0,
+                                                  uint32_t j0,
+                                                  uint32_t n0,
+                                                  uint32_t cm,
+                                                  uint32_t cn,
+                                                  uint32_t ck,
+                                                  uint32_t l1_x,
+                                                  uint32_t l1_w)
+{
+    uint32_t hartid      = get_hartid();
+    idma_handle_t loaded = IDMA_HANDLE_NONE;
+
+    if (cm && GET_X_ID(hartid) == p % MESH_X_TILES)
+        loaded = idma_memcpy_2d_async(idma,
+                                      0,
+                                      g->x + ((i0 * g->ldx) + n0) * GEMM_TILED_ELEM_SIZE,
+                                      l1_x,
+                                      cn * GEMM_TILED_ELEM_SIZE,
+                                      g->ldx * GEMM_TILED_ELEM_SIZE,
+                                      cm);
+    if (ck && GET_Y_ID(hartid) == p % MESH_Y_TILES)
+        loaded = idma_memcpy_2d_async(idma,
+                                      0,
+                                      g->w + ((n0 * g->ldw) + j0) * GEMM_TILED_ELEM_SIZE,
+                                      l1_w,
+                                      ck * GEMM_TILED_ELEM_SIZE,
+                                      g->ldw * GEMM_TILED_ELEM_SIZE,
+                                      cn);
+    return loaded;
+}
+
+/**
+ * Broadcasts panel p from its owners: the X panel along the mesh row, the W panel along the mesh
+ * column. The panel sizes are uniform over the row (cm) and the column (ck), so all the tiles of
+ * a group take the same branch.
+ * Past the first panel, the buffers are overwritten only once their users are done with them:
+ * `freed` is the row barrier arrived on after the previous job, and the column barrier is taken
+ * after the X broadcast, since a tile has a single barrier in flight.
+ */
+static inline void gemm_summa_bcast_panel(coll_ctx_t *coll,
+                                          uint32_t p,
+                                          uint32_t cm,
+                                          uint32_t cn,
+                                          uint32_t ck,
+                                          uint32_t l1_x,
+                                          uint32_t l1_w,
+                                          fsync_token_t freed)
+{
+    if (p > 0)
+        fsync_wait(coll->fsync, freed);
+    if (cm)
+        coll_broadcast(coll, COLL_ROW, p % MESH_X_TILES, l1_x, cm * cn * GEMM_TILED_ELEM_SIZE);
+    if (p > 0)
+        fsync_wait(coll->fsync, fsync_arrive_col(coll->fsync));
+    if (ck)
+        coll_broadcast(coll, COLL_COL, p % MESH_Y_TILES, l1_w, cn * ck * GEMM_TILED_ELEM_SIZE);
+}
+
+/**
+ * SUMMA GEMM on the whole mesh: Y = X * W + Y, with the same problem description as gemm_tiled,
+ * in L2 and of any size. Every mesh-tile must call it with the same problem, its L1 scratch area
+ * being at the same offset of the L1 of every tile.
+ *
+ * Y is split in blocks of [bm x bk] elements, mapped on the mesh as a MESH_Y_TILES x MESH_X_TILES
+ * grid of blocks; larger outputs are computed one grid at a time. The inner dimension is cut into
+ * panels of tn elements. For panel p, a single tile per mesh row fetches the X panel of the row
+ * from L2 and broadcasts it to the row, and a single tile per mesh column does the same with the
+ * W panel: each element of X and W is read from L2 once per grid, instead of once per tile.
+ * The panels are double buffered: panel p+1 is fetched and broadcast while RedMulE computes on
+ * panel p. Only the mesh row of an X panel and the mesh column of a W panel use it: a split-phase
+ * row barrier, arrived on once a tile is done with a panel buffer, and a column barrier keep the
+ * broadcasts from overwriting a buffer still in use on the receivers, without stalling the mesh.
+ *
+ * The iDMA, RedMulE and fsync events must be enabled in the event unit when STALLING == 0.
+ * Y is complete once all the tiles have returned, e.g. after a global barrier.
+ *
+ * @param idma    IDMA controller handle.
+ * @param redmule RedMulE controller handle.
+ * @param fsync   FractalSync controller handle.
+ * @param eu      Event unit controller handle (unused when STALLING == 1).
+ * @param g       GEMM problem.
+ *
+ * @return 0 on success, 1 if the L1 budget is too small.
+ */
+static inline int gemm_summa(idma_controller_t *idma,
+                             redmule_controller_t *redmule,
+                             fsync_controller_t *fsync,
+                             eu_controller_t *eu,
+                             const gemm_tiled_t *g)
+{
+    uint32_t hartid = get_hartid();
+    uint32_t bm, tn, bk;
+    uint32_t l1_y, l1_x[2], l1_w[2];
+    idma_handle_t y_store = IDMA_HANDLE_NONE;
+    coll_ctx_t coll       = {
+        .idma    = idma,
+        .fsync   = fsync,
+        .eu      = eu,
+        .algo    = COLL_TREE,
+        .scratch = 0,
+    };
+
+    if (gemm_tiled_choose((g->m + MESH_Y_TILES - 1) / MESH_Y_TILES,
+                          g->n,
+                          (g->k + MESH_X_TILES - 1) / MESH_X_TILES,
+                          g->l1_size,
+                          &bm,
+                          &tn,
+                          &bk)) {
+        printf("GEMM_SUMMA: L1 budget of %d bytes is too small.\n", g->l1_size);
+        return 1;
+    }
+
+    l1_y    = GEMM_TILED_ALIGN(g->l1_base);
+    l1_x[0] = GEMM_TILED_ALIGN(l1_y + bm * bk * GEMM_TILED_ELEM_SIZE);
+    l1_x[1] = GEMM_TILED_ALIGN(l1_x[0] + bm * tn * GEMM_TILED_ELEM_SIZE);
+    l1_w[0] = GEMM_TILED_ALIGN(l1_x[1] + bm * tn * GEMM_TILED_ELEM_SIZE);
+    l1_w[1] = GEMM_TILED_ALIGN(l1_w[0] + tn * bk * GEMM_TILED_ELEM_SIZE);
+
+    /* The scratch areas of the other tiles may still be in use by the caller */
+    fsync_sync_global(fsync);
+#if STALLING == 0
+    eu_fsync_wait(eu, GEMM_TILED_WAIT_MODE);
+#endif
+
+    for (uint32_t gi = 0; gi < g->m; gi += bm * MESH_Y_TILES) {
+        for (uint32_t gj = 0; gj < g->k; gj += bk * MESH_X_TILES) {
+            uint32_t i0         = gi + GET_Y_ID(hartid) * bm;
+            uint32_t j0         = gj + GET_X_ID(hartid) * bk;
+            uint32_t cm         = (i0 >= g->m) ? 0 : ((g->m - i0 < bm) ? (g->m - i0) : bm);
+            uint32_t ck         = (j0 >= g->k) ? 0 : ((g->k - j0 < bk) ? (g->k - j0) : bk);
+            uint32_t cn         = (g->n < tn) ? g->n : tn;
+            uint32_t axi_y      = g->y + ((i0 * g->ldy) + j0) * GEMM_TILED_ELEM_SIZE;
+            fsync_token_t freed = FSYNC_TOKEN_NONE;
+            idma_handle_t loaded;
+
+            /* First panel, overlapped with the store of the previous output block */
+            loaded = gemm_summa_load_panel(idma, g, 0, i0, j0, 0, cm, cn, ck, l1_x[0], l1_w[0]);
+            if (y_store != IDMA_HANDLE_NONE) {
+                idma_wait(idma, y_store);
+                y_store = IDMA_HANDLE_NONE;
+            }
+            if (cm && ck)
+                loaded = idma_memcpy_2d_async(idma,
+                                              0,
+                                              axi_y,
+                                              l1_y,
+                                              ck * GEMM_TILED_ELEM_SIZE,
+                                              g->ldy * GEMM_TILED_ELEM_SIZE,
+                                              cm);
+            if (loaded != IDMA_HANDLE_NONE)
+                idma_wait(idma, loaded);
+            gemm_summa_bcast_panel(&coll, 0, cm, cn, ck, l1_x[0], l1_w[0], FSYNC_TOKEN_NONE);
+
+            for (uint32_t n0 = 0, p = 0; n0 < g->n; n0 += tn, p++) {
+                uint32_t buf     = p & 1;
+                uint32_t n0_next = n0 + tn;
+
+                cn = (g->n - n0 < tn) ? (g->n - n0) : tn;
+
+                if (cm && ck)
+                    redmule_gemm(redmule,
+                                 l1_x[buf],
+                                 l1_w[buf],
+                                 l1_y,
+                                 (uint16_t)cm,
+                                 (uint16_t)cn,
+                                 (uint16_t)ck);
+
+                /*
+                 * Fetch the next panel in the local buffer freed by the previous job, then wait
+                 * for the row and the column to be done with that buffer before broadcasting it.
+                 */
+                if (n0_next < g->n) {
+                    uint32_t cn_next = (g->n - n0_next < tn) ? (g->n - n0_next) : tn;
+                    loaded           = gemm_summa_load_panel(idma,
+                                                   g,
+                                                   p + 1,
+                                                   i0,
+                                                   j0,
+                                                   n0_next,
+                                                   cm,
+                                                   cn_next,
+                                                   ck,
+                                                   l1_x[buf ^ 1],
+                                                   l1_w[buf ^ 1]);
+                    if (loaded != IDMA_HANDLE_NONE)
+                        idma_wait(idma, loaded);
+                    gemm_summa_bcast_panel(
+                        &coll, p + 1, cm, cn_next, ck, l1_x[buf ^ 1], l1_w[buf ^ 1], freed);
+                }
+
+#if STALLING == 0
+                if (cm && ck)
+                    eu_redmule_wait(eu, GEMM_TILED_WAIT_MODE);
+#endif
+                freed = fsync_arrive_row(fsync);
+            }
+            /* The first panel of the next block goes in buffers used by the last jobs */
+            fsync_wait(fsync, freed);
+            fsync_wait(fsync, fsync_arrive_col(fsync));
+
+            if (cm && ck)
+                y_store = idma_memcpy_2d_async(idma,
+                                               1,
+                                               axi_y,
+                                               l1_y,
+                                               ck * GEMM_TILED_ELEM_SIZE,
+                                               g->ldy * GEMM_TILED_ELEM_SIZE,
+                                               cm);
+        }
+    }
+
+    if (y_store != IDMA_HANDLE_NONE)
+        idma_wait(idma, y_store);
+
+    return 0;
+}
+
 #endif /* GEMM_UTILS_H */
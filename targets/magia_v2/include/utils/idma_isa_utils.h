@@ -25,9 +25,9 @@
 #include "addr_map/tile_addr_map.h"
 #include "regs/tile_ctrl.h"
 #include "magia_tile_utils.h"
-#include "performance_utils.h"
+#include "prof_utils.h"
 
-#define idma_wait() __asm__ __volatile__("wfi" ::: "memory")
+#define idma_wfi() __asm__ __volatile__("wfi" ::: "memory")
 
 /* conf instruction */
 // asm volatile(
@@ -242,11 +242,9 @@ inline void idma_set_std3_rep3_out(volatile uint32_t dst_std_3,
 //             to L2) */ (0x0       << 15) | \     /* Reserved - 0x0 */ (0b111     << 12) | \     /*
 //             FUNC3 - START */ (0x0       <<  7) | \     /* Reserved - 0x0 */ (0b1111011 <<  0)
 //             \n"); /* OPCODE */
-inline void idma_start_in()
+static inline void idma_start_in()
 {
-#if PROFILE_CMI == 1
-    stnl_cmi_s();
-#endif
+    prof_cmi_s();
     asm volatile(".word (0x0       << 26) | \
               (0b0       << 25) | \
               (0x0       << 15) | \
@@ -259,9 +257,7 @@ inline void idma_start_in()
     do {
         status = *(volatile uint32_t *)(IDMA_BASE_AXI2OBI + IDMA_STATUS_OFFSET);
     } while (status & IDMA_STATUS_BUSY_MASK);
-#if PROFILE_CMI == 1
-    stnl_cmi_f();
-#endif
+    prof_cmi_f();
 #endif
 }
 
@@ -272,11 +268,9 @@ inline void idma_start_in()
 //             to L2) */ (0x0       << 15) | \     /* Reserved - 0x0 */ (0b111     << 12) | \     /*
 //             FUNC3 - START */ (0x0       <<  7) | \     /* Reserved - 0x0 */ (0b1111011 <<  0)
 //             \n"); /* OPCODE */
-inline void idma_start_out()
+static inline void idma_start_out()
 {
-#if PROFILE_CMO == 1
-    stnl_cmo_s();
-#endif
+    prof_cmo_s();
     asm volatile(".word (0x0       << 26) | \
               (0b1       << 25) | \
               (0x0       << 15) | \
@@ -289,9 +283,7 @@ inline void idma_start_out()
     do {
         status = *(volatile uint32_t *)(IDMA_BASE_OBI2AXI + IDMA_STATUS_OFFSET);
     } while (status & IDMA_STATUS_BUSY_MASK);
-#if PROFILE_CMO == 1
-    stnl_cmo_f();
-#endif
+    prof_cmo_f();
 #endif
 }
 
@@ -358,16 +350,12 @@ idma_mm_set_std3_rep3(uint32_t dir, uint32_t dst_stride_3, uint32_t src_stride_3
     mmio32(IDMA_REPS_3_LOW_ADDR(dir))       = reps_3;
 }
 
-inline uint32_t idma_mm_start(uint32_t dir)
+static inline uint32_t idma_mm_start(uint32_t dir)
 {
-#if PROFILE_CMI == 1
     if (dir == 0)
-        stnl_cmi_s();
-#endif
-#if PROFILE_CMO == 1
+        prof_cmi_s();
     if (dir == 1)
-        stnl_cmo_s();
-#endif
+        prof_cmo_s();
     uint32_t transfer_id = mmio32(IDMA_NEXT_ID_ADDR(dir, 0));
 #if STALLING == 1
     // Polling mode - wait for completion
@@ -376,16 +364,12 @@ inline uint32_t idma_mm_start(uint32_t dir)
         do {
             status = *(volatile uint32_t *)(IDMA_BASE_OBI2AXI + IDMA_STATUS_OFFSET);
         } while (status & IDMA_STATUS_BUSY_MASK);
-#if PROFILE_CMO == 1
-        stnl_cmo_f();
-#endif
+        prof_cmo_f();
     } else {
         do {
             status = *(volatile uint32_t *)(IDMA_BASE_AXI2OBI + IDMA_STATUS_OFFSET);
         } while (status & IDMA_STATUS_BUSY_MASK);
-#if PROFILE_CMI == 1
-        stnl_cmi_f();
-#endif
+        prof_cmi_f();
     }
 #endif
     return transfer_id;
@@ -33,6 +33,11 @@
 #define SPATZ_RETURN  (SPATZ_CTRL_BASE + 0x14)
 #define SPATZ_DONE    (SPATZ_CTRL_BASE + 0x18)
 
+/* 1: Spatz is booted once by crt0.S and kept clock-gated between tasks */
+#ifndef SPATZ_PERSISTENT
+#define SPATZ_PERSISTENT (0)
+#endif
+
 static inline void spatz_clk_en(void)
 {
     mmio32(SPATZ_CLK_EN) = 1;
@@ -87,13 +92,109 @@ static inline void spatz_run_task_with_params(uint32_t spatz_task_addr, uint32_t
     spatz_run_task(spatz_task_addr);
 }
 
-static inline void spatz_init(uint32_t spatz_start_addr)
+/* Command queue, drained by spatz_queue_task of spatz_crt0.S (layout shared with it) */
+#define SPATZ_QUEUE_DEPTH (8)
+
+typedef struct {
+    uint32_t task;   /* Task entry point                    */
+    uint32_t params; /* Params pointer, read from SPATZ_DATA */
+} spatz_cmd_t;
+
+typedef struct {
+    volatile uint32_t head; /* Next entry to fill, written by CV32 only */
+    volatile uint32_t tail; /* Next entry to run, written by Spatz only */
+    spatz_cmd_t cmd[SPATZ_QUEUE_DEPTH];
+} spatz_queue_t;
+
+/**
+ * Initializes an empty command queue. The queue must be in the tile's L1, where both cores see
+ * it.
+ */
+static inline void spatz_queue_init(spatz_queue_t *queue)
+{
+    queue->head = 0;
+    queue->tail = 0;
+}
+
+/**
+ * Number of queued tasks not run yet.
+ */
+static inline uint32_t spatz_queue_pending(spatz_queue_t *queue)
+{
+    return queue->head - queue->tail;
+}
+
+/**
+ * Appends a task to the queue, it is run once the queue is started.
+ * Returns 0 on success, 1 if the queue is full.
+ */
+static inline int spatz_queue_push(spatz_queue_t *queue, uint32_t task_addr, uint32_t params_ptr)
+{
+    uint32_t head = queue->head;
+
+    if (head - queue->tail >= SPATZ_QUEUE_DEPTH)
+        return 1;
+
+    volatile spatz_cmd_t *cmd = &queue->cmd[head % SPATZ_QUEUE_DEPTH];
+    cmd->task                 = task_addr;
+    cmd->params               = params_ptr;
+    queue->head               = head + 1;
+    return 0;
+}
+
+/**
+ * Starts Spatz on the queued tasks: `drain_task_addr` (SPATZ_QUEUE_TASK of the task header)
+ * runs them back-to-back without going through the CV32, which only waits for the single Spatz
+ * event raised at the end of the chain (eu_spatz_wait). The exit code is 0 if all the tasks
+ * succeeded, otherwise the one of the failed task, which is left at the tail of the queue.
+ * Tasks pushed while the chain runs are executed only if Spatz has not found the queue empty
+ * yet: check spatz_queue_pending after the wait and start the queue again if needed.
+ */
+static inline void spatz_queue_start(spatz_queue_t *queue, uint32_t drain_task_addr)
+{
+    spatz_run_task_with_params(drain_task_addr, (uint32_t)queue);
+}
+
+/**
+ * Un-gates the clock of a booted Spatz, which resumes in its dispatcher loop with its state
+ * (registers, BSS, vector configuration) untouched.
+ */
+static inline void spatz_resume(void)
+{
+    spatz_clk_en();
+}
+
+/**
+ * Clock-gates Spatz between tasks, keeping its state. Call after the task completed.
+ */
+static inline void spatz_suspend(void)
+{
+    spatz_clk_dis();
+}
+
+/**
+ * Boots Spatz from its binary and waits until it reaches the dispatcher loop.
+ */
+static inline void spatz_boot(uint32_t spatz_start_addr)
 {
     spatz_set_func(spatz_start_addr);
     spatz_clk_en();
-    while (mmio32(SPATZ_READY) == 0) {
-        printf("[CV32] Waiting for Spatz to be ready...\n");
-    };
+    while (mmio32(SPATZ_READY) == 0)
+        ;
+}
+
+/**
+ * Makes Spatz ready to run tasks. With SPATZ_PERSISTENT == 1 Spatz was already booted by crt0.S
+ * and this only un-gates its clock, otherwise it is booted from `spatz_start_addr`.
+ * Either way spatz_clk_dis (or spatz_suspend) gates it again once done.
+ */
+static inline void spatz_init(uint32_t spatz_start_addr)
+{
+#if SPATZ_PERSISTENT == 1
+    spatz_resume();
+#else
+    spatz_boot(spatz_start_addr);
+#endif
 }
 
 #endif
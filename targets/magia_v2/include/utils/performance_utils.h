@@ -23,10 +23,19 @@
 #ifndef PERFORMANCE_UTILS_H
 #define PERFORMANCE_UTILS_H
 
+/**
+ * @brief Starts the cycle counter (mcycle).
+ * The CV32E40P leaves mcycle inhibited out of reset (mcountinhibit.CY), which is why
+ * perf_get_cycles used to read a stuck value on RTL. GVSoC counts either way.
+ */
+static inline void perf_enable_cycles()
+{
+    asm volatile("csrci 0x320, 0x1" ::);
+}
+
 /**
  * @brief Returns the cycles of the performance counter
- * !! WARNING !! AT THE MOMENT OF WRITING (06/05/2026) THIS PROFILING UTILITY ONLY WORKS ON GVSOC.
- * PLEASE USE THE TESTBENCH UTILITIES WHEN PROFILING ON RTL.
+ * Call perf_enable_cycles first (prof_init does) to get a running counter on RTL as well.
  */
 static inline unsigned int perf_get_cycles()
 {
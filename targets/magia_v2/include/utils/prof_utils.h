@@ -0,0 +1,327 @@
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Authors: Alberto Dequino <alberto.dequino@unibo.it>
+ *
+ * MAGIA Region Profiler
+ *
+ * Cycle accounting that works the same on GVSoC, RTL and the host target. It is built in by
+ * default and enabled at run time by prof_init: until then every hook returns after checking the
+ * magic word, so a breakdown needs no rebuild. With PROF=0 (make prof=0) every call compiles to
+ * nothing:
+ * - the drivers accumulate, per category, the cycles between the start of an operation and the
+ *   end of the wait for it (input/output communication, computation, synchronization: the
+ *   classes of the testbench sentinels). Overlapping operations of the same category are counted
+ *   once: the category is busy from the start of the first one to the end of the last one;
+ * - the kernel marks nested regions with prof_begin/prof_end, each accumulating its inclusive
+ *   cycles.
+ * The state lives at the top of the tile's L1 (PROF_L1_OFFSET). prof_dump, also run by the crt0
+ * when main returns, stores the results at PROF_L2_BASE, where prof_report or
+ * scripts/prof_table.py read them.
+ */
+#ifndef PROF_UTILS_H
+#define PROF_UTILS_H
+
+#include <stdint.h>
+#include "utils/magia_utils.h"
+#include "utils/performance_utils.h"
+#include "utils/printf.h"
+
+#ifndef PROF
+#define PROF (1)
+#endif
+
+#define PROF_MAGIC       (0x50524F46) /* "PROF" */
+#define PROF_MAX_REGIONS (16)
+#define PROF_MAX_DEPTH   (8)
+
+typedef enum {
+    PROF_CMI = 0, // Input communication, L2 to L1 transfers
+    PROF_CMO,     // Output communication, L1 to L2 transfers
+    PROF_CMP,     // Computation, RedMulE jobs
+    PROF_SNC,     // Synchronization, FractalSync barriers
+    PROF_N_CAT,
+} prof_cat_t;
+
+/**
+ * Results of one tile, as stored at PROF_L2_BASE + hartid * sizeof(prof_record_t).
+ * Keep in sync with scripts/prof_table.py.
+ */
+typedef struct {
+    uint32_t magic;                           /**< PROF_MAGIC once dumped. */
+    uint32_t hartid;                          /**< Tile that produced the record. */
+    uint32_t total;                           /**< Cycles from prof_init to prof_dump. */
+    uint32_t errors;                          /**< Unmatched, too deep or invalid regions. */
+    uint32_t cat_cycles[PROF_N_CAT];          /**< Busy cycles of each category. */
+    uint32_t cat_count[PROF_N_CAT];           /**< Operations of each category. */
+    uint32_t region_cycles[PROF_MAX_REGIONS]; /**< Inclusive cycles of each region. */
+    uint32_t region_count[PROF_MAX_REGIONS];  /**< Times each region was entered. */
+} prof_record_t;
+
+/* Profiler state of the tile, at PROF_L1_OFFSET of its L1 */
+typedef struct {
+    prof_record_t rec;
+    uint32_t start;
+    uint32_t cat_depth[PROF_N_CAT]; /* Operations of each category in flight */
+    uint32_t cat_start[PROF_N_CAT];
+    uint32_t depth;
+    uint32_t stack_id[PROF_MAX_DEPTH];
+    uint32_t stack_start[PROF_MAX_DEPTH];
+} prof_state_t;
+
+#define PROF_STATE     ((prof_state_t *)(get_l1_base(get_hartid()) + PROF_L1_OFFSET))
+#define PROF_RECORD(h) ((volatile prof_record_t *)(PROF_L2_BASE + (h) * sizeof(prof_record_t)))
+
+#if PROF == 1
+
+static inline int prof_active(void)
+{
+    return PROF_STATE->rec.magic == PROF_MAGIC;
+}
+
+/**
+ * Clears the accumulators of the tile and starts profiling.
+ */
+static inline void prof_init(void)
+{
+    prof_state_t *st = PROF_STATE;
+    uint32_t *words  = (uint32_t *)st;
+
+    for (uint32_t i = 0; i < sizeof(prof_state_t) / 4; i++)
+        words[i] = 0;
+    perf_enable_cycles();
+    st->rec.hartid = get_hartid();
+    st->start      = perf_get_cycles();
+    st->rec.magic  = PROF_MAGIC;
+}
+
+/**
+ * Opens region `id`, inside the innermost open one.
+ */
+static inline void prof_begin(uint32_t id)
+{
+    prof_state_t *st = PROF_STATE;
+
+    if (st->rec.magic != PROF_MAGIC)
+        return;
+    if (st->depth < PROF_MAX_DEPTH) {
+        st->stack_id[st->depth]    = id;
+        st->stack_start[st->depth] = perf_get_cycles();
+    } else {
+        st->rec.errors++;
+    }
+    st->depth++;
+}
+
+/**
+ * Closes region `id`, which must be the innermost open one.
+ */
+static inline void prof_end(uint32_t id)
+{
+    uint32_t now     = perf_get_cycles();
+    prof_state_t *st = PROF_STATE;
+
+    if (st->rec.magic != PROF_MAGIC)
+        return;
+    if (st->depth == 0) {
+        st->rec.errors++;
+        return;
+    }
+    st->depth--;
+    if (st->depth >= PROF_MAX_DEPTH)
+        return;
+    if (st->stack_id[st->depth] != id || id >= PROF_MAX_REGIONS) {
+        st->rec.errors++;
+        return;
+    }
+    st->rec.region_cycles[id] += now - st->stack_start[st->depth];
+    st->rec.region_count[id]++;
+}
+
+/**
+ * An operation of category `cat` starts: the category is busy from now on.
+ */
+static inline void prof_cat_begin(prof_cat_t cat)
+{
+    prof_state_t *st = PROF_STATE;
+
+    if (st->rec.magic != PROF_MAGIC)
+        return;
+    if (st->cat_depth[cat]++ == 0)
+        st->cat_start[cat] = perf_get_cycles();
+    st->rec.cat_count[cat]++;
+}
+
+/**
+ * The wait for an operation of category `cat` is over: the category is idle from now on if it
+ * was the last one in flight. Extra ends, e.g. a wait on an operation already retired, are
+ * ignored.
+ */
+static inline void prof_cat_end(prof_cat_t cat)
+{
+    uint32_t now     = perf_get_cycles();
+    prof_state_t *st = PROF_STATE;
+
+    if (st->rec.magic != PROF_MAGIC || st->cat_depth[cat] == 0)
+        return;
+    if (--st->cat_depth[cat] == 0)
+        st->rec.cat_cycles[cat] += now - st->cat_start[cat];
+}
+
+/**
+ * Stops profiling and stores the record of the tile in L2. Does nothing if the tile is not
+ * profiling, so it is safe to call it again at exit.
+ */
+static inline void prof_dump(void)
+{
+    prof_state_t *st = PROF_STATE;
+    uint32_t *words  = (uint32_t *)&st->rec;
+
+    if (st->rec.magic != PROF_MAGIC)
+        return;
+    for (uint32_t cat = 0; cat < PROF_N_CAT; cat++) {
+        if (st->cat_depth[cat]) {
+            st->cat_depth[cat] = 1;
+            prof_cat_end(cat);
+        }
+    }
+    st->rec.errors += st->depth;
+    st->rec.total = perf_get_cycles() - st->start;
+
+    volatile uint32_t *dst = (volatile uint32_t *)PROF_RECORD(get_hartid());
+    for (uint32_t i = 0; i < sizeof(prof_record_t) / 4; i++)
+        dst[i] = words[i];
+    st->rec.magic = 0;
+}
+
+/**
+ * Prints the records dumped by the tiles, one line per tile and one per non-empty region, in
+ * the format parsed by scripts/prof_table.py. To be called by a single tile, once the others
+ * have dumped. Printed records are consumed, so that a later report only shows new ones.
+ */
+static inline void prof_report(void)
+{
+    for (uint32_t h = 0; h < NUM_HARTS; h++) {
+        volatile prof_record_t *rec = PROF_RECORD(h);
+        if (rec->magic != PROF_MAGIC || rec->hartid != h)
+            continue;
+        printf("[prof] tile %d total %u cmi %u cmo %u cmp %u snc %u errors %u\n",
+               h,
+               rec->total,
+               rec->cat_cycles[PROF_CMI],
+               rec->cat_cycles[PROF_CMO],
+               rec->cat_cycles[PROF_CMP],
+               rec->cat_cycles[PROF_SNC],
+               rec->errors);
+        for (uint32_t id = 0; id < PROF_MAX_REGIONS; id++)
+            if (rec->region_count[id])
+                printf("[prof] tile %d region %d cycles %u count %u\n",
+                       h,
+                       id,
+                       rec->region_cycles[id],
+                       rec->region_count[id]);
+        rec->magic = 0;
+    }
+}
+
+#else /* PROF == 0: the profiler is compiled out */
+
+static inline int prof_active(void)
+{
+    return 0;
+}
+
+static inline void prof_init(void) {}
+static inline void prof_begin(uint32_t id) {}
+static inline void prof_end(uint32_t id) {}
+static inline void prof_cat_begin(prof_cat_t cat) {}
+static inline void prof_cat_end(prof_cat_t cat) {}
+static inline void prof_dump(void) {}
+static inline void prof_report(void) {}
+
+#endif /* PROF */
+
+//////////////// DRIVER HOOKS ////////////////
+/*
+ * Start (_s) and finish (_f) of the operations, called by the ISA utils and the drivers. They
+ * also trigger the testbench sentinels of the same class when built with PROFILE_* == 1.
+ */
+
+static inline void prof_cmi_s()
+{
+#if PROFILE_CMI == 1
+    stnl_cmi_s();
+#endif
+    prof_cat_begin(PROF_CMI);
+}
+
+static inline void prof_cmi_f()
+{
+#if PROFILE_CMI == 1
+    stnl_cmi_f();
+#endif
+    prof_cat_end(PROF_CMI);
+}
+
+static inline void prof_cmo_s()
+{
+#if PROFILE_CMO == 1
+    stnl_cmo_s();
+#endif
+    prof_cat_begin(PROF_CMO);
+}
+
+static inline void prof_cmo_f()
+{
+#if PROFILE_CMO == 1
+    stnl_cmo_f();
+#endif
+    prof_cat_end(PROF_CMO);
+}
+
+static inline void prof_cmp_s()
+{
+#if PROFILE_CMP == 1
+    stnl_cmp_s();
+#endif
+    prof_cat_begin(PROF_CMP);
+}
+
+static inline void prof_cmp_f()
+{
+#if PROFILE_CMP == 1
+    stnl_cmp_f();
+#endif
+    prof_cat_end(PROF_CMP);
+}
+
+static inline void prof_snc_s()
+{
+#if PROFILE_SNC == 1
+    stnl_snc_s();
+#endif
+    prof_cat_begin(PROF_SNC);
+}
+
+static inline void prof_snc_f()
+{
+#if PROFILE_SNC == 1
+    stnl_snc_f();
+#endif
+    prof_cat_end(PROF_SNC);
+}
+
+#endif /* PROF_UTILS_H */
@@ -24,7 +24,7 @@
 
 #include "addr_map/tile_addr_map.h"
 #include "regs/tile_ctrl.h"
-#include "performance_utils.h"
+#include "prof_utils.h"
 
 #define HWPE_WRITE(value, offset) *(volatile uint32_t*)(REDMULE_BASE + offset) = value
 #define HWPE_READ(offset) *(volatile uint32_t*)(REDMULE_BASE + offset)
@@ -62,13 +62,12 @@ inline void redmule_mcnfig(volatile uint16_t k_size, volatile uint16_t m_size, v
   //            (0b001     << 10) | \     /* Operation selection */
   //            (0b001     <<  7) | \     /* Data format */
   //            (0b0101011 <<  0)   \n"); /* OpCode */
-inline void redmule_marith(volatile uint32_t y_base, volatile uint32_t w_base, volatile uint32_t x_base){
+static inline void redmule_marith(volatile uint32_t y_base, volatile uint32_t w_base, volatile uint32_t x_base){
+  /* Before loading the operands: the profiler hook may use t0-t2 */
+  prof_cmp_s();
   asm volatile("addi t2, %0, 0" ::"r"(y_base));
   asm volatile("addi t1, %0, 0" ::"r"(w_base));
   asm volatile("addi t0, %0, 0" ::"r"(x_base));
-  #if PROFILE_CMP == 1
-  stnl_cmp_s();
-  #endif
   asm volatile(
        ".word (0b00111   << 27) | \
               (0b00      << 25) | \
@@ -84,9 +83,7 @@ inline void redmule_marith(volatile uint32_t y_base, volatile uint32_t w_base, v
   do {
     status = *(volatile uint32_t *)(REDMULE_BASE + REDMULE_STATUS);
   } while (status & REDMULE_STATUS_BUSY_MASK);
-  #if PROFILE_CMP == 1
-  stnl_cmp_f();
-  #endif
+  prof_cmp_f();
   #endif
 }
 
@@ -100,24 +97,20 @@ inline int redmule_mm_mcnfig(volatile uint16_t k_size, volatile uint16_t m_size,
   return 0;
 }
 
-inline int redmule_mm_marith(volatile uint32_t y_base, volatile uint32_t w_base, volatile uint32_t x_base){
+static inline int redmule_mm_marith(volatile uint32_t y_base, volatile uint32_t w_base, volatile uint32_t x_base){
   volatile uint32_t arith_reg = (0b001 << 10) | (0b001 << 7);
   HWPE_WRITE(x_base, REDMULE_REG_OFFS + REDMULE_REG_X_PTR);
   HWPE_WRITE(w_base, REDMULE_REG_OFFS + REDMULE_REG_W_PTR);
   HWPE_WRITE(y_base, REDMULE_REG_OFFS + REDMULE_REG_Z_PTR);
   HWPE_WRITE(arith_reg, REDMULE_REG_OFFS + REDMULE_ARITH_PTR);
-  #if PROFILE_CMP == 1
-  stnl_cmp_s();
-  #endif
+  prof_cmp_s();
   HWPE_WRITE(0, REDMULE_TRIGGER); 
   #if STALLING == 1
   volatile uint32_t status;
   do {
     status = *(volatile uint32_t *)(REDMULE_BASE + REDMULE_STATUS);
   } while (status & REDMULE_STATUS_BUSY_MASK);
-  #if PROFILE_CMP == 1
-  stnl_cmp_f();
-  #endif
+  prof_cmp_f();
   #endif
   return 0;
 }
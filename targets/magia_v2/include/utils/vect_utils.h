@@ -0,0 +1,284 @@
+/*
+ * Copyright (C) 2025 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * MAGIA Vector Utils — element-wise fp16 kernels on L1 vectors
+ */
+
+#ifndef VECT_UTILS_H
+#define VECT_UTILS_H
+
+#include <stdint.h>
+
+/* Two fp16 elements packed in a 32-bit L1 word, element 0 in the low half */
+typedef union {
+    uint32_t w;
+    _Float16 h[2];
+} vect_f16x2_t;
+
+/**
+ * The same word as a 2-lane vector: fp16 lanes for the arithmetic, int16 lanes for the bitwise
+ * kernels (compare, select, fill).
+ * The core has no FPU, so the fp16 lanes are still computed one at a time in soft-float: for
+ * add, sub, mul, scale and reduce_sum the packing only halves the L1 loads and stores. The int16
+ * lanes of max, reduce_max and fill are plain integer operations, which the compiler may map to
+ * the packed-SIMD instructions of xgap9 (pv.*). The vect_f16 test prints the cycles of each kernel
+ * next to the scalar loop it replaces.
+ */
+typedef _Float16 vect_v2f16_t __attribute__((vector_size(4), may_alias));
+typedef int16_t vect_v2i16_t __attribute__((vector_size(4), may_alias));
+
+/**
+ * The kernels below access L1 through plain pointers, so that the compiler is free to pack and
+ * unroll the loops (the volatile accesses of attention_utils.h forbid it). This barrier keeps the
+ * compiler from moving those accesses across the completion wait of the engine that produced the
+ * data.
+ */
+#define VECT_BARRIER() asm volatile("" ::: "memory")
+
+/**
+ * Number of elements to process one by one before the packed loop: 1 when the vectors start in
+ * the middle of a word, `dim` when they can not be word-aligned together.
+ * Pass `dst` as `src1` for the kernels with a single source.
+ */
+static inline uint32_t vect_f16_head(uint32_t dst, uint32_t src0, uint32_t src1, uint32_t dim)
+{
+    if (((dst ^ src0) | (dst ^ src1)) & 0x3)
+        return dim;
+    return ((dst & 0x2) && dim) ? 1 : 0;
+}
+
+/* Order-preserving int16 key of packed fp16 values, and its inverse (same operation) */
+static inline vect_v2i16_t vect_f16_key(vect_v2i16_t x)
+{
+    return x ^ ((x >> 15) & 0x7fff);
+}
+
+static inline int16_t vect_f16_key1(int16_t x)
+{
+    return x ^ ((x >> 15) & 0x7fff);
+}
+
+/**
+ * Element-wise dst[i] = a[i] + b[i] on fp16 vectors in L1, `dim` elements.
+ * Any of the vectors may alias another.
+ */
+static inline int vect_add_f16(uint32_t dst, uint32_t a, uint32_t b, uint32_t dim)
+{
+    _Float16 *d       = (_Float16 *)dst;
+    const _Float16 *x = (const _Float16 *)a;
+    const _Float16 *y = (const _Float16 *)b;
+    uint32_t head     = vect_f16_head(dst, a, b, dim);
+    uint32_t i;
+
+    VECT_BARRIER();
+    for (i = 0; i < head; i++)
+        d[i] = x[i] + y[i];
+    for (; i + 2 <= dim; i += 2)
+        *(vect_v2f16_t *)&d[i] = *(const vect_v2f16_t *)&x[i] + *(const vect_v2f16_t *)&y[i];
+    for (; i < dim; i++)
+        d[i] = x[i] + y[i];
+    VECT_BARRIER();
+    return 0;
+}
+
+/**
+ * Element-wise dst[i] = a[i] - b[i] on fp16 vectors in L1, `dim` elements.
+ */
+static inline int vect_sub_f16(uint32_t dst, uint32_t a, uint32_t b, uint32_t dim)
+{
+    _Float16 *d       = (_Float16 *)dst;
+    const _Float16 *x = (const _Float16 *)a;
+    const _Float16 *y = (const _Float16 *)b;
+    uint32_t head     = vect_f16_head(dst, a, b, dim);
+    uint32_t i;
+
+    VECT_BARRIER();
+    for (i = 0; i < head; i++)
+        d[i] = x[i] - y[i];
+    for (; i + 2 <= dim; i += 2)
+        *(vect_v2f16_t *)&d[i] = *(const vect_v2f16_t *)&x[i] - *(const vect_v2f16_t *)&y[i];
+    for (; i < dim; i++)
+        d[i] = x[i] - y[i];
+    VECT_BARRIER();
+    return 0;
+}
+
+/**
+ * Element-wise dst[i] = a[i] * b[i] on fp16 vectors in L1, `dim` elements.
+ */
+static inline int vect_mul_f16(uint32_t dst, uint32_t a, uint32_t b, uint32_t dim)
+{
+    _Float16 *d       = (_Float16 *)dst;
+    const _Float16 *x = (const _Float16 *)a;
+    const _Float16 *y = (const _Float16 *)b;
+    uint32_t head     = vect_f16_head(dst, a, b, dim);
+    uint32_t i;
+
+    VECT_BARRIER();
+    for (i = 0; i < head; i++)
+        d[i] = x[i] * y[i];
+    for (; i + 2 <= dim; i += 2)
+        *(vect_v2f16_t *)&d[i] = *(const vect_v2f16_t *)&x[i] * *(const vect_v2f16_t *)&y[i];
+    for (; i < dim; i++)
+        d[i] = x[i] * y[i];
+    VECT_BARRIER();
+    return 0;
+}
+
+/**
+ * Element-wise dst[i] = max(a[i], b[i]) on fp16 vectors in L1, `dim` elements.
+ * Compares the order-preserving integer keys of the values, so it needs no floating-point
+ * operation (-0 is smaller than +0, NaNs are not handled).
+ */
+static inline int vect_max_f16(uint32_t dst, uint32_t a, uint32_t b, uint32_t dim)
+{
+    int16_t *d       = (int16_t *)dst;
+    const int16_t *x = (const int16_t *)a;
+    const int16_t *y = (const int16_t *)b;
+    uint32_t head    = vect_f16_head(dst, a, b, dim);
+    uint32_t i;
+
+    VECT_BARRIER();
+    for (i = 0; i < head; i++)
+        d[i] = (vect_f16_key1(x[i]) > vect_f16_key1(y[i])) ? x[i] : y[i];
+    for (; i + 2 <= dim; i += 2) {
+        vect_v2i16_t vx = *(const vect_v2i16_t *)&x[i];
+        vect_v2i16_t vy = *(const vect_v2i16_t *)&y[i];
+        vect_v2i16_t m  = vect_f16_key(vx) > vect_f16_key(vy);
+
+        *(vect_v2i16_t *)&d[i] = (vx & m) | (vy & ~m);
+    }
+    for (; i < dim; i++)
+        d[i] = (vect_f16_key1(x[i]) > vect_f16_key1(y[i])) ? x[i] : y[i];
+    VECT_BARRIER();
+    return 0;
+}
+
+/**
+ * Element-wise dst[i] = src[i] * scale on fp16 vectors in L1, `dim` elements.
+ */
+static inline int vect_scale_f16(uint32_t dst, uint32_t src, _Float16 scale, uint32_t dim)
+{
+    _Float16 *d       = (_Float16 *)dst;
+    const _Float16 *x = (const _Float16 *)src;
+    vect_v2f16_t vs   = {scale, scale};
+    uint32_t head     = vect_f16_head(dst, src, dst, dim);
+    uint32_t i;
+
+    VECT_BARRIER();
+    for (i = 0; i < head; i++)
+        d[i] = x[i] * scale;
+    for (; i + 2 <= dim; i += 2)
+        *(vect_v2f16_t *)&d[i] = *(const vect_v2f16_t *)&x[i] * vs;
+    for (; i < dim; i++)
+        d[i] = x[i] * scale;
+    VECT_BARRIER();
+    return 0;
+}
+
+/**
+ * Sets the `dim` fp16 elements of dst in L1 to `value`, one word at a time.
+ */
+static inline int vect_fill_f16(uint32_t dst, _Float16 value, uint32_t dim)
+{
+    _Float16 *d     = (_Float16 *)dst;
+    vect_v2f16_t vv = {value, value};
+    uint32_t head   = vect_f16_head(dst, dst, dst, dim);
+    uint32_t i;
+
+    VECT_BARRIER();
+    for (i = 0; i < head; i++)
+        d[i] = value;
+    for (; i + 2 <= dim; i += 2)
+        *(vect_v2f16_t *)&d[i] = vv;
+    for (; i < dim; i++)
+        d[i] = value;
+    VECT_BARRIER();
+    return 0;
+}
+
+/**
+ * Sum of the `dim` fp16 elements of src in L1, accumulated in two packed lanes.
+ */
+static inline _Float16 vect_reduce_sum_f16(uint32_t src, uint32_t dim)
+{
+    const _Float16 *x = (const _Float16 *)src;
+    vect_v2f16_t acc  = {0, 0};
+    _Float16 sum      = 0;
+    uint32_t head     = vect_f16_head(src, src, src, dim);
+    uint32_t i;
+
+    VECT_BARRIER();
+    for (i = 0; i < head; i++)
+        sum += x[i];
+    for (; i + 2 <= dim; i += 2)
+        acc += *(const vect_v2f16_t *)&x[i];
+    for (; i < dim; i++)
+        sum += x[i];
+    VECT_BARRIER();
+    return sum + acc[0] + acc[1];
+}
+
+/**
+ * Maximum of the `dim` fp16 elements of src in L1, compared as in vect_max_f16.
+ * -inf, the identity of the maximum, if dim is 0.
+ */
+static inline _Float16 vect_reduce_max_f16(uint32_t src, uint32_t dim)
+{
+    const int16_t *x = (const int16_t *)src;
+    uint32_t head    = vect_f16_head(src, src, src, dim);
+    uint32_t i;
+    int16_t max;
+    vect_v2i16_t acc;
+    vect_f16x2_t res;
+
+    if (dim == 0) {
+        res.w = 0xfc00;
+        return res.h[0];
+    }
+
+    VECT_BARRIER();
+    max = vect_f16_key1(x[0]);
+    acc = (vect_v2i16_t){max, max};
+    for (i = 0; i < head; i++)
+        max = (vect_f16_key1(x[i]) > max) ? vect_f16_key1(x[i]) : max;
+    for (; i + 2 <= dim; i += 2) {
+        vect_v2i16_t k = vect_f16_key(*(const vect_v2i16_t *)&x[i]);
+        vect_v2i16_t m = k > acc;
+
+        acc = (k & m) | (acc & ~m);
+    }
+    for (; i < dim; i++)
+        max = (vect_f16_key1(x[i]) > max) ? vect_f16_key1(x[i]) : max;
+    max   = (acc[0] > max) ? acc[0] : max;
+    max   = (acc[1] > max) ? acc[1] : max;
+    res.w = (uint16_t)vect_f16_key1(max);
+    VECT_BARRIER();
+    return res.h[0];
+}
+
+/**
+ * Element-wise accumulate of fp16 vectors in L1: dst[i] += src[i] for `dim` elements.
+ * Replaces a GEMM against the identity matrix when summing partial results: O(dim) work and no
+ * dim x dim L1 buffer.
+ * Same signature as vect_sum, so it can be used as a collectives reduction operator.
+ */
+static inline int vect_acc_f16(uint32_t dst, uint32_t src, uint32_t dim)
+{
+    return vect_add_f16(dst, dst, src, dim);
+}
+
+#endif /* VECT_UTILS_H */
@@ -25,11 +25,60 @@
 #include <stddef.h>
 #include "addr_map/tile_addr_map.h"
 
-void *memset(void *m, int c, size_t n)
+/*
+ * IO_IDMA > 0 routes the memcpy calls of at least IO_IDMA bytes between the L1 of the tile and
+ * any other memory (L2, other tiles) to the iDMA. Only for the CV32 runtime: the Spatz tasks,
+ * which also link this file, are built without it.
+ */
+#ifndef IO_IDMA
+#define IO_IDMA 0
+#endif
+
+#if IO_IDMA > 0
+#include "regs/tile_ctrl.h"
+#include "utils/magia_utils.h"
+#include "utils/idma_isa_utils.h"
+#include "utils/eu_isa_utils.h"
+#endif
+
+/* Word copies per iteration of the unrolled loops */
+#define IO_UNROLL 4
+
+/* Keeps GCC from turning the copy loops back into calls to these very functions */
+#if defined(__GNUC__) && !defined(__clang__)
+#define IO_NO_BUILTIN __attribute__((optimize("no-tree-loop-distribute-patterns")))
+#else
+#define IO_NO_BUILTIN
+#endif
+
+IO_NO_BUILTIN void *memset(void *m, int c, size_t n)
 {
-    char *s = (char *)m;
+    uint8_t *s = (uint8_t *) m;
+    uint32_t w = (uint8_t) c * 0x01010101u;
+
+    /* Head bytes up to a word boundary */
+    while (n && ((size_t) s & 3))
+    {
+        *s++ = (uint8_t) c;
+        n--;
+    }
+
+    uint32_t *ws = (uint32_t *) s;
+    for (; n >= IO_UNROLL * 4; n -= IO_UNROLL * 4)
+    {
+        ws[0] = w;
+        ws[1] = w;
+        ws[2] = w;
+        ws[3] = w;
+        ws += IO_UNROLL;
+    }
+    for (; n >= 4; n -= 4)
+        *ws++ = w;
+
+    /* Tail bytes */
+    s = (uint8_t *) ws;
     while (n--)
-        *s++ = (char) c;
+        *s++ = (uint8_t) c;
 
     return m;
 }
@@ -44,71 +93,186 @@ char *strchr(const char *s, int c)
     return (*s == tmp) ? (char *) s : NULL;
 }
 
-void *memcpy(void *dst0, const void *src0, size_t len0)
+#if IO_IDMA > 0
+/*
+ * Copies `len` bytes with the iDMA when exactly one of the two buffers is in the L1 of the tile.
+ * Polls the backend until it is idle, then drops the completion event only if it is its own: when
+ * the caller had a transfer in flight on that direction, or its event still pending, the event
+ * is left in the buffer for the caller to consume.
+ *
+ * Returns 0 if the copy was done, 1 if it is left to the core.
+ */
+static int io_idma_copy(void *dst, const void *src, size_t len)
 {
-    void *save = dst0;
+    uint32_t l1_base = get_l1_base(get_hartid());
+    uint32_t d       = (uint32_t) dst;
+    uint32_t s       = (uint32_t) src;
+    int dst_l1       = (d - l1_base) <= L1_SIZE && (d - l1_base) + len - 1 <= L1_SIZE;
+    int src_l1       = (s - l1_base) <= L1_SIZE && (s - l1_base) + len - 1 <= L1_SIZE;
+    uint32_t dir, done, keep;
 
-    char src_aligned = (((size_t) src0) & 3) == 0;
-    char dst_aligned = (((size_t) dst0) & 3) == 0;
-    char copy_full_words = (len0 & 3) == 0;
+    if (dst_l1 == src_l1)
+        return 1;
 
-    if (src_aligned && dst_aligned && copy_full_words)
-    {
-        // all accesses are aligned => can copy full words
-        uint32_t *dst = (uint32_t *) dst0;
-        uint32_t *src = (uint32_t *) src0;
+    /* 0 = AXI to OBI (to the L1), 1 = OBI to AXI (from the L1) */
+    dir  = src_l1 ? 1 : 0;
+    done = dir ? EU_IDMA_O2A_DONE_MASK : EU_IDMA_A2O_DONE_MASK;
+    keep = (eu_get_events() & done) || (mmio32(IDMA_STATUS_ADDR(dir, 0)) & IDMA_STATUS_BUSY_MASK);
 
-        while (len0)
-        {
-            *dst++ = *src++;
-            len0 -= 4;
-        }
+#if IDMA_MM == 0
+    if (dir)
+    {
+        idma_conf_out();
+        idma_set_addr_len_out(d, s, len);
+        idma_set_std2_rep2_out(0, 0, 1);
+        idma_set_std3_rep3_out(0, 0, 1);
+        idma_start_out();
     }
     else
     {
-        // copy bytewise
-        char *dst = (char *) dst0;
-        char *src = (char *) src0;
+        idma_conf_in();
+        idma_set_addr_len_in(d, s, len);
+        idma_set_std2_rep2_in(0, 0, 1);
+        idma_set_std3_rep3_in(0, 0, 1);
+        idma_start_in();
+    }
+#else
+    idma_mm_conf(dir, 0, 0, 0, 0, 0, 0, 3);
+    idma_mm_set_addr_len(dir, d, s, len);
+    idma_mm_set_std2_rep2(dir, 0, 0, 1);
+    idma_mm_set_std3_rep3(dir, 0, 0, 1);
+    idma_mm_start(dir);
+#endif
 
-        while (len0)
-        {
-            *dst++ = *src++;
-            len0--;
-        }
+    while (mmio32(IDMA_STATUS_ADDR(dir, 0)) & IDMA_STATUS_BUSY_MASK)
+        ;
+    if (!keep)
+        eu_clear_events(done);
+#if STALLING == 0
+    if (dir)
+        prof_cmo_f();
+    else
+        prof_cmi_f();
+#endif
+
+    return 0;
+}
+#endif
+
+/*
+ * Forward copy of `n` bytes to a word-aligned `dst`, from a `src` that is not word-aligned:
+ * every destination word is merged from the two aligned source words it straddles, so that all
+ * the accesses are word accesses. Returns the number of bytes left (less than a word).
+ */
+IO_NO_BUILTIN static size_t io_copy_shifted(uint32_t **dst, const uint8_t **src, size_t n)
+{
+    uint32_t off         = (size_t) *src & 3;
+    uint32_t lo          = off * 8;
+    uint32_t hi          = 32 - lo;
+    const uint32_t *ws   = (const uint32_t *) (*src - off);
+    uint32_t *wd         = *dst;
+    uint32_t w0          = *ws++;
+
+    for (; n >= 4; n -= 4)
+    {
+        uint32_t w1 = *ws++;
+        *wd++       = (w0 >> lo) | (w1 << hi);
+        w0          = w1;
     }
 
-    return save;
+    *src += ((uint8_t *) wd - (uint8_t *) *dst);
+    *dst = wd;
+    return n;
 }
 
-void *memmove(void *d, const void *s, size_t n)
+IO_NO_BUILTIN void *memcpy(void *dst0, const void *src0, size_t len0)
 {
-    char *dest = d;
-    const char *src  = s;
+    uint8_t *d       = (uint8_t *) dst0;
+    const uint8_t *s = (const uint8_t *) src0;
+
+#if IO_IDMA > 0
+    if (len0 >= IO_IDMA && io_idma_copy(dst0, src0, len0) == 0)
+        return dst0;
+#endif
+
+    /* Head bytes up to a word boundary of the destination */
+    while (len0 && ((size_t) d & 3))
+    {
+        *d++ = *s++;
+        len0--;
+    }
 
-    if ((size_t) (dest - src) < n)
+    uint32_t *wd = (uint32_t *) d;
+    if (((size_t) s & 3) == 0)
     {
-        /*
-         * The <src> buffer overlaps with the start of the <dest> buffer.
-         * Copy backwards to prevent the premature corruption of <src>.
-         */
+        // both aligned => can copy full words
+        const uint32_t *ws = (const uint32_t *) s;
 
-        while (n > 0)
+        for (; len0 >= IO_UNROLL * 4; len0 -= IO_UNROLL * 4)
         {
-            n--;
-            dest[n] = src[n];
+            uint32_t w0 = ws[0];
+            uint32_t w1 = ws[1];
+            uint32_t w2 = ws[2];
+            uint32_t w3 = ws[3];
+            wd[0]       = w0;
+            wd[1]       = w1;
+            wd[2]       = w2;
+            wd[3]       = w3;
+            wd += IO_UNROLL;
+            ws += IO_UNROLL;
         }
+        for (; len0 >= 4; len0 -= 4)
+            *wd++ = *ws++;
+        s = (const uint8_t *) ws;
     }
-    else
+    else if (len0 >= 4)
+    {
+        len0 = io_copy_shifted(&wd, &s, len0);
+    }
+
+    /* Tail bytes */
+    d = (uint8_t *) wd;
+    while (len0--)
+        *d++ = *s++;
+
+    return dst0;
+}
+
+IO_NO_BUILTIN void *memmove(void *d, const void *s, size_t n)
+{
+    uint8_t *dest      = d;
+    const uint8_t *src = s;
+
+    if ((size_t) (dest - src) >= n)
     {
         /* It is safe to perform a forward-copy */
-        while (n > 0)
+        return memcpy(d, s, n);
+    }
+
+    /*
+     * The <src> buffer overlaps with the start of the <dest> buffer.
+     * Copy backwards to prevent the premature corruption of <src>.
+     */
+    if ((((size_t) dest ^ (size_t) src) & 3) == 0)
+    {
+        /* Tail bytes down to a word boundary, then whole words */
+        while (n && ((size_t) (dest + n) & 3))
         {
-            *dest = *src;
-            dest++;
-            src++;
             n--;
+            dest[n] = src[n];
+        }
+        while (n >= 4)
+        {
+            n -= 4;
+            *(uint32_t *) (dest + n) = *(const uint32_t *) (src + n);
         }
     }
 
+    while (n > 0)
+    {
+        n--;
+        dest[n] = src[n];
+    }
+
     return d;
-}
\ No newline at end of file
+}
@@ -0,0 +1,30 @@
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Authors:
+ * Alberto Dequino <alberto.dequino@unibo.it>
+ *
+ * Profiler exit hook
+ */
+
+#include <stdint.h>
+#include "utils/prof_utils.h"
+
+/* Called by the crt0 when main returns: stores the record of a tile still profiling */
+void prof_exit(void)
+{
+    prof_dump();
+}
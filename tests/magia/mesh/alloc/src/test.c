@@ -19,6 +19,7 @@
  * This test allocates two buffers of a certain dimension,
  * adds a block of data to both of them,
  * then checks the values are the same.
+ * It then checks the aligned allocation, the free list and the arenas of the allocator.
  */
 int main(void)
 {
@@ -75,6 +76,23 @@ int main(void)
         }
     }
 
+    /**
+     * Scoped arena: bank-aligned buffer, reuse of a freed block, then release everything.
+     */
+    l1_mark_t mark   = l1_mark();
+    uint32_t small   = (uint32_t)l1_alloc(100);
+    uint32_t aligned = (uint32_t)l1_alloc_aligned(BUF_SIZE, L1_BANK_WIDTH);
+    if (aligned % L1_BANK_WIDTH)
+        n_errors++;
+    l1_free((void *)small, 100);
+    if ((uint32_t)l1_alloc(64) != small)
+        n_errors++;
+    if (l1_high_water() < (aligned + BUF_SIZE - L1_TILE_BASE))
+        n_errors++;
+    l1_reset(mark);
+    if (l1_used() != (mark.tail - L1_TILE_BASE) || (uint32_t)l1_alloc(100) != small)
+        n_errors++;
+
     printf("[HARTID %d] N. Errors: %d\n", hartid, n_errors);
     return n_errors;
 }
\ No newline at end of file
@@ -119,10 +119,8 @@ int main(void)
         (uint32_t)y_inp + (y_id * K_SIZE * tile_h_max * 2) + (tile_w_max * x_id * 2);
 
     // printf("Doing initial output L2 idma memcpy\n");
-    idma_memcpy_2d(&idma_ctrl, 0, axi_addr_y, obi_addr_y, len_y, std_y, reps_y);
-#if STALLING == 0
-    eu_idma_wait_a2o(&eu_ctrl, WAIT_MODE);
-#endif
+    idma_handle_t y_handle =
+        idma_memcpy_2d_async(&idma_ctrl, 0, axi_addr_y, obi_addr_y, len_y, std_y, reps_y);
 
     /**
      * 2a. Initalize and run IDMA transfer variables for initial L2 input data-tile transfers.
@@ -141,10 +139,8 @@ int main(void)
     uint32_t reps_x     = (uint32_t)tile_h;
     uint32_t axi_addr_x = (uint32_t)x_inp + (y_id * N_SIZE * tile_h_max * 2) + (index * t_size * 2);
     // printf("Doing initial input L2 idma memcpy\n");
-    idma_memcpy_2d(&idma_ctrl, 0, axi_addr_x, obi_addr_x_0, len_x, std_x, reps_x);
-#if STALLING == 0
-    eu_idma_wait_a2o(&eu_ctrl, WAIT_MODE);
-#endif
+    idma_handle_t x_handle =
+        idma_memcpy_2d_async(&idma_ctrl, 0, axi_addr_x, obi_addr_x_0, len_x, std_x, reps_x);
 
     /**
      * 2b. Initalize and run IDMA transfer variables for initial L2 weight data-tile transfers.
@@ -157,10 +153,15 @@ int main(void)
     uint32_t reps_w     = (uint32_t)t_size;
     uint32_t axi_addr_w = (uint32_t)w_inp + (x_id * tile_w_max * 2) + (index * t_size * K_SIZE * 2);
     // printf("Doing initial weight L2 idma memcpy\n");
-    idma_memcpy_2d(&idma_ctrl, 0, axi_addr_w, obi_addr_w_0, len_w, std_w, reps_w);
-#if STALLING == 0
-    eu_idma_wait_a2o(&eu_ctrl, WAIT_MODE);
-#endif
+    idma_handle_t w_handle =
+        idma_memcpy_2d_async(&idma_ctrl, 0, axi_addr_w, obi_addr_w_0, len_w, std_w, reps_w);
+
+    /**
+     * 2c. The three initial transfers are in flight back-to-back, wait for all of them.
+     */
+    idma_wait(&idma_ctrl, y_handle);
+    idma_wait(&idma_ctrl, x_handle);
+    idma_wait(&idma_ctrl, w_handle);
 
     volatile uint32_t input_pt;
     volatile uint32_t weight_pt;
@@ -179,7 +180,8 @@ int main(void)
      * For each timeslot, the mesh-tile will:
      * a - Load the weight and input data-tile for the current timeslot
      * b - Multiply and add
-     * Synchronization is not required.
+     * Each timeslot starts with a global synchronization, so that the data-tiles pushed by the
+     * neighbours during the previous one have landed.
      */
     for (int i = 0; i < timeslots; i++) {
         /**
@@ -198,17 +200,18 @@ int main(void)
         }
 
         /**
-         * 3b. IDMA to load the input and weight data-tile for next timeslot (if there is one)
+         * 3b. Wait for the data-tiles of the current timeslot pushed by the neighbours, then
+         * IDMA to load the input and weight data-tile for next timeslot (if there is one)
          */
-        if (i != (timeslots - 1)) {
-            // printf("Syncing\n");
-            //  if(hartid == 0)
-            //      printf("TIMESLOT NUMBER %d\n", i);
-            fsync_sync_global(&fsync_ctrl);
+        // printf("Syncing\n");
+        //  if(hartid == 0)
+        //      printf("TIMESLOT NUMBER %d\n", i);
+        fsync_sync_global(&fsync_ctrl);
 #if STALLING == 0
-            eu_fsync_wait(&eu_ctrl, WAIT_MODE);
+        eu_fsync_wait(&eu_ctrl, WAIT_MODE);
 #endif
 
+        if (i != (timeslots - 1)) {
             idma_memcpy_1d(&idma_ctrl,
                            0,
                            get_l1_base(left_id) + (tile_h * tile_w * 2) +
@@ -230,9 +233,9 @@ int main(void)
                          (uint16_t)tile_w);
 
 #if STALLING == 0
-            eu_idma_wait_a2o(&eu_ctrl, WAIT_MODE);
-            eu_idma_wait_o2a(&eu_ctrl, WAIT_MODE);
-            eu_redmule_wait(&eu_ctrl, WAIT_MODE);
+            eu_wait_all(&eu_ctrl,
+                        EU_IDMA_A2O_DONE_MASK | EU_IDMA_O2A_DONE_MASK | EU_REDMULE_DONE_MASK,
+                        WAIT_MODE);
 #endif
         } else {
             redmule_gemm(&redmule_ctrl,
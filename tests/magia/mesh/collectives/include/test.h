@@ -0,0 +1,18 @@
+// Copyright 2025-2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+
+#ifndef _TEST_COLLECTIVES_INCLUDE_GUARD_
+#define _TEST_COLLECTIVES_INCLUDE_GUARD_
+
+/* Elements per vector, not a multiple of the group sizes so that ring chunks are ragged */
+#define DIM            (24)
+#define SCRATCH_OFFSET (0x8000)
+
+int sum_u16(uint32_t dst, uint32_t src, uint32_t dim);
+
+uint16_t value(uint32_t hartid, uint32_t i);
+
+#endif //_TEST_COLLECTIVES_INCLUDE_GUARD_
@@ -0,0 +1,201 @@
+// Copyright 2025-2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+
+#include <stdint.h>
+
+#include "test.h"
+#include "tile.h"
+#include "idma.h"
+#include "fsync.h"
+#include "eventunit.h"
+#include "collectives.h"
+
+#define WAIT_MODE WFE
+
+/* Sources of the multicasts: the whole mesh, then the even and the odd tiles */
+static uint16_t l2_src[3][DIM];
+
+/**
+ * Integer sum, so that the expected results are exact whatever the reduction order.
+ */
+int sum_u16(uint32_t dst, uint32_t src, uint32_t dim)
+{
+    for (uint32_t i = 0; i < dim; i++)
+        *(volatile uint16_t *)(dst + i * 2) += *(volatile uint16_t *)(src + i * 2);
+    return 0;
+}
+
+/**
+ * Element `i` of the vector provided by tile `hartid`.
+ */
+uint16_t value(uint32_t hartid, uint32_t i)
+{
+    return (uint16_t)((hartid * 0x101) + i);
+}
+
+/**
+ * This test verifies the mesh collectives: broadcast, reduce, all-reduce and all-gather are run
+ * over the rows, the columns and the entire mesh with every algorithm, each tile checking its
+ * own result. The L2 multicast is run over the whole mesh and over two interleaved subsets.
+ */
+int main(void)
+{
+    /**
+     * 0. Get the tile's hartid and define its L1 base, also initialize the controllers for the
+     * idma, fsync and event unit.
+     */
+    uint32_t hartid = get_hartid();
+
+    idma_config_t idma_cfg      = {.hartid = hartid};
+    idma_controller_t idma_ctrl = {
+        .base = NULL,
+        .cfg  = &idma_cfg,
+        .api  = &idma_api,
+    };
+    idma_init(&idma_ctrl);
+
+    fsync_config_t fsync_cfg      = {.hartid = hartid};
+    fsync_controller_t fsync_ctrl = {
+        .base = NULL,
+        .cfg  = &fsync_cfg,
+        .api  = &fsync_api,
+    };
+    fsync_init(&fsync_ctrl);
+
+    eu_config_t eu_cfg      = {.hartid = hartid};
+    eu_controller_t eu_ctrl = {
+        .base = NULL,
+        .cfg  = &eu_cfg,
+        .api  = &eu_api,
+    };
+#if STALLING == 0
+    eu_init(&eu_ctrl);
+    eu_clear_events(0xFFFFFFFF);
+    eu_fsync_init(&eu_ctrl, 0);
+    eu_idma_init(&eu_ctrl, 0);
+#endif
+
+    uint32_t l1_tile_base = get_l1_base(hartid);
+    uint32_t buf          = l1_tile_base;
+
+    coll_ctx_t coll = {
+        .idma    = &idma_ctrl,
+        .fsync   = &fsync_ctrl,
+        .eu      = &eu_ctrl,
+        .algo    = COLL_RING,
+        .scratch = l1_tile_base + SCRATCH_OFFSET,
+    };
+
+    uint32_t errors = 0;
+    for (uint32_t algo = COLL_RING; algo <= COLL_TREE; algo++) {
+        for (uint32_t scope = COLL_ROW; scope <= COLL_GLOBAL; scope++) {
+            uint32_t n    = coll_size(scope);
+            uint32_t rank = coll_rank(scope);
+            uint32_t root = n - 1;
+            coll.algo     = algo;
+
+            /**
+             * 1. Broadcast from the last tile of the group.
+             */
+            for (uint32_t i = 0; i < DIM; i++)
+                *(volatile uint16_t *)(buf + i * 2) = (rank == root) ? value(hartid, i) : 0;
+            fsync_sync_global(&fsync_ctrl);
+#if STALLING == 0
+            eu_fsync_wait(&eu_ctrl, WAIT_MODE);
+#endif
+            coll_broadcast(&coll, scope, root, buf, DIM * 2);
+            for (uint32_t i = 0; i < DIM; i++)
+                if (*(volatile uint16_t *)(buf + i * 2) != value(coll_member(scope, root), i))
+                    errors++;
+
+            /**
+             * 2. Reduce on the last tile of the group, then all-reduce.
+             */
+            for (uint32_t k = 0; k < 2; k++) {
+                for (uint32_t i = 0; i < DIM; i++)
+                    *(volatile uint16_t *)(buf + i * 2) = value(hartid, i);
+                fsync_sync_global(&fsync_ctrl);
+#if STALLING == 0
+                eu_fsync_wait(&eu_ctrl, WAIT_MODE);
+#endif
+                if (k == 0)
+                    coll_reduce(&coll, scope, root, buf, DIM * 2, sum_u16);
+                else
+                    coll_allreduce(&coll, scope, buf, DIM * 2, sum_u16);
+                if (k == 0 && rank != root)
+                    continue;
+                for (uint32_t i = 0; i < DIM; i++) {
+                    uint16_t expected = 0;
+                    for (uint32_t r = 0; r < n; r++)
+                        expected += value(coll_member(scope, r), i);
+                    if (*(volatile uint16_t *)(buf + i * 2) != expected)
+                        errors++;
+                }
+            }
+
+            /**
+             * 3. All-gather one block per tile.
+             */
+            for (uint32_t i = 0; i < DIM; i++)
+                *(volatile uint16_t *)(buf + (rank * DIM + i) * 2) = value(hartid, i);
+            fsync_sync_global(&fsync_ctrl);
+#if STALLING == 0
+            eu_fsync_wait(&eu_ctrl, WAIT_MODE);
+#endif
+            coll_allgather(&coll, scope, buf, DIM * 2);
+            for (uint32_t r = 0; r < n; r++)
+                for (uint32_t i = 0; i < DIM; i++)
+                    if (*(volatile uint16_t *)(buf + (r * DIM + i) * 2) !=
+                        value(coll_member(scope, r), i))
+                        errors++;
+
+#if EVAL == 1
+            printf("Algorithm %d, scope %d: %d errors so far\n", algo, scope, errors);
+#endif
+            fsync_sync_global(&fsync_ctrl);
+#if STALLING == 0
+            eu_fsync_wait(&eu_ctrl, WAIT_MODE);
+#endif
+        }
+    }
+
+    /**
+     * 4. Multicast from L2 over the whole mesh led by the last tile, then over the even and the
+     * odd tiles at the same time.
+     */
+    if (hartid == 0)
+        for (uint32_t g = 0; g < 3; g++)
+            for (uint32_t i = 0; i < DIM; i++)
+                l2_src[g][i] = value(NUM_HARTS + g, i);
+
+    uint32_t group[NUM_HARTS];
+    for (uint32_t k = 0; k < 2; k++) {
+        uint32_t n_tiles = 0;
+        uint32_t src     = (k == 0) ? 0 : 1 + (hartid % 2);
+        uint8_t bid      = (k == 0) ? 0 : hartid % 2;
+        for (uint32_t t = 0; t < NUM_HARTS; t++)
+            if (k == 0 || (t % 2) == (hartid % 2))
+                group[n_tiles++] = (k == 0) ? NUM_HARTS - 1 - t : t;
+
+        for (uint32_t i = 0; i < DIM; i++)
+            *(volatile uint16_t *)(buf + i * 2) = 0;
+        fsync_sync_global(&fsync_ctrl);
+#if STALLING == 0
+        eu_fsync_wait(&eu_ctrl, WAIT_MODE);
+#endif
+        idma_multicast(&coll, group, n_tiles, bid, (uint32_t)l2_src[src], buf, DIM * 2);
+        for (uint32_t i = 0; i < DIM; i++)
+            if (*(volatile uint16_t *)(buf + i * 2) != value(NUM_HARTS + src, i))
+                errors++;
+    }
+#if EVAL == 1
+    printf("Multicast: %d errors so far\n", errors);
+#endif
+
+    printf("Number of errors: %d\n", errors);
+
+    return errors;
+}
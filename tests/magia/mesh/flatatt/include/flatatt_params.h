@@ -0,0 +1,31 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef FLATATT_PARAMS_H_
+#define FLATATT_PARAMS_H_
+
+#include <stdint.h>
+
+/**
+ * Parameters of the flatatt Spatz tasks, shared by the CV32 and the Spatz side.
+ * All the buffers are FP16 and live in the tile's L1, matrices are row-major.
+ */
+typedef struct {
+    uintptr_t addr_s;      /* Score tile S_j (rows x cols), overwritten with P_j         */
+    uintptr_t addr_m_loc;  /* Row maxes of S_j                                            */
+    uintptr_t addr_m;      /* Running row maxes m_j, once exchanged across the mesh row   */
+    uintptr_t addr_m_prev; /* Running row maxes m_j-1, overwritten with alpha             */
+    uintptr_t addr_beta;   /* exp(m_loc - m_j)                                            */
+    uintptr_t addr_l;      /* Row sums of P_j, then running row sums                      */
+    uintptr_t addr_l_prev; /* Running row sums up to block j-1                            */
+    uintptr_t addr_o;      /* P_j * V_j (rows x d), updated into the running output       */
+    uintptr_t addr_o_prev; /* Running output up to block j-1                              */
+    uint32_t rows;
+    uint32_t cols;
+    uint32_t d;
+    uint32_t first; /* Block j == 0: there is no previous block to rescale */
+    uint32_t last;  /* Block j == T-1: normalize the output by the row sums */
+} flatatt_params_t;
+
+#endif /* FLATATT_PARAMS_H_ */
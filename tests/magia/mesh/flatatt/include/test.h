@@ -0,0 +1,464 @@
+// Copyright 2025-2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+
+#ifndef _TEST_FLATATT_INCLUDE_GUARD_
+#define _TEST_FLATATT_INCLUDE_GUARD_
+
+#define S_SIZE (64) // Sequence length
+#define D_SIZE (16) // Head dimension
+#define B_SIZE (16) // Block size: 4 x 4 blocks, so that the online rescale and the overlap run
+
+// Largest difference from the golden output: the exponentials are approximated
+#define O_TOL (0.03f)
+
+uint16_t q_inp[S_SIZE * D_SIZE] = {
+    0xba18, 0x1d27, 0x260e, 0x39c3, 0xba5c, 0xb86d, 0x3277, 0x2f3d, 0x3889, 0x2e1f, 0x3761, 0x384a,
+    0x3804, 0x318a, 0xb829, 0x334f, 0xba3a, 0x3911, 0xae72, 0x3909, 0x35ed, 0x35be, 0xb8a3, 0xb7f4,
+    0x3bae, 0x3ade, 0x38e2, 0x3bff, 0x26f5, 0xbac7, 0xb51b, 0x2f5b, 0xb6a7, 0xad72, 0x3a06, 0x3687,
+    0x30f5, 0xbb9b, 0x36bf, 0xb45e, 0xb0fa, 0xb27a, 0x317c, 0x9a54, 0xba23, 0x2283, 0x3801, 0x3269,
+    0xa498, 0x3aab, 0xb7b9, 0xb11f, 0x3ad2, 0xa954, 0x289b, 0xbb98, 0xb868, 0xb9f0, 0xbb38, 0x368d,
+    0x3a30, 0xba5c, 0x33d4, 0xabab, 0xa894, 0xb856, 0x3a2d, 0x340e, 0xad88, 0xabd5, 0x3adf, 0x3bcc,
+    0x2dd7, 0x2fa7, 0x356f, 0xb628, 0x38cc, 0x1bc8, 0xa967, 0x3a27, 0xb049, 0xb694, 0xb764, 0xbb78,
+    0x34fb, 0x323a, 0xad59, 0x29dc, 0xa55e, 0x3abf, 0xb7ad, 0xa763, 0x25c5, 0x3938, 0x38ed, 0x2f67,
+    0x3a84, 0x394d, 0xb5de, 0x3aab, 0xba6d, 0x360f, 0x3890, 0x27c5, 0xae07, 0x3b72, 0x3b7a, 0x397b,
+    0xa957, 0xbaf9, 0xb779, 0x9a78, 0xba74, 0x37ec, 0xb1ad, 0xae7a, 0xbbc7, 0xbbff, 0x3129, 0x3aea,
+    0xbaac, 0x38b3, 0xb809, 0x33c0, 0x3808, 0x3b4d, 0x3564, 0x3455, 0xb986, 0xb5f8, 0x3151, 0x3850,
+    0x3b33, 0xa41a, 0x370e, 0xb9d8, 0xb86f, 0x31a1, 0x3b55, 0x3a04, 0x20d6, 0xbaa6, 0x3565, 0x3af6,
+    0x3889, 0x3aa4, 0xb635, 0xb1a1, 0x38ee, 0x2921, 0xb8da, 0xbbc6, 0xba4d, 0x3a34, 0xbb2e, 0xb4e5,
+    0xb4b1, 0x3850, 0xbb96, 0x2552, 0xb583, 0xb648, 0xb591, 0xba0f, 0x3b2e, 0x3095, 0x38e1, 0xb98a,
+    0x2905, 0xb040, 0xb53c, 0x3249, 0x35b6, 0xbae3, 0xb274, 0xb8df, 0x3abe, 0xbb47, 0x2dbb, 0x396c,
+    0xae2b, 0x3813, 0xb8fc, 0x36c0, 0x3a0c, 0xb9ef, 0x2baa, 0x3891, 0x2850, 0x3b4e, 0xb96f, 0x3983,
+    0xb30b, 0xb0c7, 0xb180, 0xbabe, 0xb63e, 0xb4fd, 0xb792, 0x9ce9, 0x387c, 0xb165, 0xac22, 0xb593,
+    0xa898, 0xba14, 0x38bf, 0x38bf, 0x390f, 0x3991, 0xb84c, 0x3b42, 0x3a0f, 0x34a9, 0xb1e3, 0x3888,
+    0x3998, 0x3574, 0x3b61, 0xb4bd, 0xb97e, 0x2ff0, 0x30a1, 0x2cea, 0xba3f, 0x36ea, 0x2f24, 0x305b,
+    0xb892, 0xb692, 0xb76c, 0x2f22, 0xba60, 0xb790, 0x3b47, 0xb942, 0x35e8, 0x3825, 0x371e, 0xb908,
+    0x342a, 0x22c9, 0xb725, 0x3966, 0xb6b0, 0xb5ef, 0xb7a7, 0xbafe, 0xb1a8, 0x3a5e, 0x386e, 0xb178,
+    0xbbc1, 0xba75, 0xbba2, 0xba08, 0x35f2, 0x30e5, 0x3afa, 0xb4ca, 0x387a, 0x32dd, 0x34f3, 0x335f,
+    0x3acc, 0xb5e3, 0xb88d, 0xacc7, 0x3baa, 0x3a0e, 0x35f8, 0x39c8, 0x35ce, 0x3ac8, 0xb31a, 0x3b27,
+    0xb499, 0x3788, 0xb00c, 0xbb9f, 0x3640, 0xb6bc, 0x3b55, 0x38cc, 0xba0b, 0x3849, 0xb5cc, 0x3a73,
+    0x2d65, 0xb50a, 0x2fca, 0x3718, 0xba33, 0x339d, 0xba1c, 0xb9fd, 0xb4ac, 0x34bc, 0x34fc, 0xbb8a,
+    0x3100, 0xb49c, 0xb36b, 0xb82c, 0xb10f, 0xb87d, 0xb9ff, 0x2d7f, 0x352c, 0x3af4, 0x35e1, 0xb29a,
+    0xb7d7, 0xb9a3, 0xbba0, 0xb724, 0xa96b, 0xb78f, 0xb5ee, 0x3b1c, 0x31fe, 0x396f, 0x2ec8, 0x34cf,
+    0x3b62, 0x2731, 0xb783, 0x3442, 0x3813, 0xb5d7, 0x350d, 0xbbd1, 0x3ba6, 0xab8a, 0x3b86, 0x35bc,
+    0x39cb, 0x3ad6, 0x3a7f, 0xb276, 0x3b9e, 0x3b37, 0xb848, 0x3944, 0xb501, 0xb8c9, 0xb482, 0x3462,
+    0x2e3f, 0xaaa4, 0x389e, 0x3128, 0xb8fe, 0x3419, 0xb98a, 0x3a4d, 0x3b35, 0x3905, 0x395c, 0x367a,
+    0x38ba, 0x3474, 0xbaa7, 0xb412, 0x3764, 0xb9cb, 0x37aa, 0x3bfb, 0xbbb5, 0xb887, 0x3994, 0x3146,
+    0x30a6, 0x3b4a, 0xb3a5, 0x3b69, 0x2840, 0x349c, 0xb979, 0x247c, 0xbaa2, 0x3771, 0xb553, 0xb7a2,
+    0xbb56, 0x31ef, 0x3899, 0xb968, 0xb6a0, 0x2d45, 0xb492, 0x3b90, 0xb8fb, 0x37e7, 0xbbd9, 0x32c8,
+    0xa91e, 0xb0f3, 0x38fe, 0x3a6f, 0x3baa, 0x3bf3, 0xb944, 0x2825, 0xb920, 0x2d01, 0xb961, 0x3a32,
+    0x27ad, 0x3a1e, 0x3497, 0xbbf8, 0xb404, 0xb439, 0xb88a, 0xb988, 0x330b, 0xb9fa, 0x3bc3, 0xa7e7,
+    0x39fc, 0x3741, 0xb39a, 0x337c, 0x34b9, 0xb4df, 0x3a8d, 0xba11, 0x28da, 0x3942, 0x35e0, 0xada4,
+    0x3176, 0xbaae, 0x3877, 0xba98, 0xa150, 0xb604, 0x380d, 0xb862, 0xb59a, 0x226c, 0xb563, 0x3a84,
+    0x372a, 0x39b7, 0xb234, 0xb92c, 0x38e7, 0xb87a, 0x360e, 0xb4d9, 0x3898, 0xb1c7, 0x38da, 0xb393,
+    0xb988, 0x37c7, 0x3505, 0xb9f5, 0xb770, 0x395f, 0xb5c2, 0x3975, 0xaf1c, 0xb9ad, 0x340f, 0xb840,
+    0x3b8e, 0x2fd9, 0xba07, 0xb69c, 0xad5e, 0xb252, 0xbba7, 0x36ed, 0x3592, 0xb539, 0x35bc, 0x3ac4,
+    0x3a89, 0x398f, 0x3b3e, 0x355d, 0x2df1, 0xb8a4, 0xb4bb, 0xb56d, 0x3ac4, 0x372f, 0xbbd5, 0x2f8b,
+    0xb7ee, 0xb550, 0x349f, 0xb177, 0x3874, 0xaa29, 0x3a3a, 0xb529, 0xbb66, 0xb87b, 0xba11, 0x39a1,
+    0xb767, 0xbbb7, 0xb8a7, 0xad7d, 0xb724, 0x342a, 0xbabc, 0x3628, 0x2cfd, 0xbbd1, 0xba78, 0xb571,
+    0xb87d, 0xacad, 0x32ca, 0xb944, 0xb619, 0x3054, 0x36c7, 0x35cc, 0x2f92, 0xba45, 0xb755, 0xb126,
+    0xb909, 0x377f, 0x3bd1, 0x3bd0, 0x3a91, 0x350d, 0xb514, 0xb4e2, 0x32d3, 0xb7d4, 0x3a22, 0x396c,
+    0xbb6a, 0xa51e, 0xbba7, 0x38f1, 0xb7e0, 0x3814, 0xb8d2, 0xb73e, 0x397a, 0xb268, 0xb882, 0xbb22,
+    0xb1b4, 0xbaf8, 0x371b, 0x3528, 0x35d3, 0x3841, 0xb672, 0xa875, 0xba8c, 0x24ef, 0x29bf, 0xb599,
+    0xb5d3, 0xb522, 0xb91a, 0x3bd2, 0x39d1, 0xb936, 0xb7c3, 0x3b29, 0x39f2, 0x2942, 0xb380, 0xba4c,
+    0x3300, 0xb890, 0xaca2, 0xb8a5, 0x241d, 0x2ace, 0x2701, 0x38ab, 0xb757, 0x39fb, 0xa5d8, 0x2f8a,
+    0x3973, 0xb593, 0x3bf4, 0xb2e9, 0x3360, 0x2d01, 0xb991, 0x2e91, 0x3bad, 0x3752, 0xb9e6, 0x390e,
+    0x3506, 0xbb06, 0x3555, 0xbb73, 0x38a2, 0x3b0e, 0xb923, 0xb770, 0x2d29, 0xb496, 0xad77, 0xb904,
+    0xbb24, 0xb908, 0xb98a, 0x3485, 0xa540, 0x2de6, 0xbb89, 0xb877, 0xb459, 0x2d79, 0xac66, 0x37e9,
+    0xb985, 0xb59e, 0x36e0, 0xbb5b, 0xbbe1, 0xba7c, 0x3181, 0x368c, 0x3904, 0xb7c5, 0x381c, 0xb961,
+    0xb8f0, 0x3910, 0xb0f0, 0xb048, 0x3954, 0xb945, 0xb868, 0x3b7d, 0xb899, 0xb977, 0x3bdf, 0xb0fe,
+    0xb0eb, 0x39b3, 0x3690, 0x3b7f, 0x3424, 0xaf9e, 0x3b2b, 0x32d3, 0xba88, 0x3a5a, 0x37a6, 0xba25,
+    0xbabd, 0x36e0, 0x33d2, 0xb979, 0xb93f, 0x3484, 0xb8f9, 0x3b2b, 0x3bbb, 0xbb83, 0x3b89, 0x34be,
+    0x3a9e, 0x38a2, 0xb6d0, 0xb450, 0xbbd9, 0x2961, 0x3a30, 0x3973, 0xa60e, 0xb9cb, 0x38b1, 0x2fa3,
+    0x3b84, 0xada1, 0x32f2, 0x31f4, 0x3ae4, 0x3571, 0xb58f, 0xb7d8, 0x35d3, 0xacfe, 0xb4ee, 0x3937,
+    0x2a80, 0x2bc2, 0xba6d, 0xb72a, 0xbb68, 0x31c6, 0xbae0, 0x3ac3, 0x301f, 0xb348, 0x34a8, 0x30cc,
+    0xad82, 0xa978, 0xbba6, 0x3a5f, 0xb9da, 0xba51, 0xba88, 0x2c73, 0xb7d7, 0x3b8d, 0x37f7, 0xbadd,
+    0x3286, 0xba16, 0x3b6c, 0x3a7b, 0x36f4, 0xb62d, 0xab7b, 0xb5b0, 0x3a59, 0x3618, 0xb266, 0x2736,
+    0x3993, 0xb131, 0xa5a8, 0x3220, 0xafde, 0x384d, 0x31a8, 0x31cc, 0xa865, 0xbbbd, 0x3b21, 0xb361,
+    0xbb75, 0xac6d, 0xb9c1, 0xb825, 0x2977, 0xb772, 0xb05f, 0x3787, 0xbb94, 0x328b, 0x291f, 0x3b40,
+    0xba0c, 0xb435, 0xb888, 0xbac9, 0xb947, 0xb20e, 0xba39, 0xba4f, 0x3bd7, 0xb257, 0xbbe8, 0xb8db,
+    0xb798, 0x38ce, 0x2a54, 0x3a98, 0xbaa6, 0xb951, 0x3a96, 0xb881, 0x3979, 0x38d9, 0x2ffb, 0x3a64,
+    0x2e5d, 0xbb6e, 0x3b5c, 0x3ba9, 0x3634, 0x3974, 0x27ee, 0x3af2, 0x3b50, 0x3a6f, 0x3b7b, 0x34d0,
+    0x3b89, 0xbb3f, 0xba8b, 0x34dc, 0xb711, 0xbbe2, 0x3389, 0xbb4d, 0x3acc, 0xbadc, 0x366c, 0x2df5,
+    0x2e13, 0x2846, 0x2d26, 0xa0d9, 0xbb26, 0xb4bc, 0x2cb5, 0xac9b, 0xb820, 0xbbc2, 0xb34e, 0xba92,
+    0x3599, 0xb925, 0xb836, 0x2f93, 0x20f7, 0xb537, 0xb713, 0x34ad, 0xb94c, 0xba85, 0xb4fb, 0x37ee,
+    0xb9ea, 0x3b0b, 0x39ce, 0x3877, 0x392a, 0xaa90, 0x3631, 0x35fa, 0xb5af, 0xa125, 0xba27, 0xbbfa,
+    0xb3b6, 0x3b74, 0x9c0f, 0xb135, 0x3046, 0x264e, 0xb49c, 0x37c3, 0x31d7, 0x34cf, 0xb831, 0xb3db,
+    0xb815, 0xb648, 0x359d, 0x35c4, 0x3040, 0xb62e, 0x2c00, 0x3b8f, 0xb50a, 0x378f, 0x36dd, 0x31c1,
+    0xb81e, 0xab4e, 0x3b12, 0x32de, 0x1d59, 0x3530, 0xba31, 0xb9f7, 0x333b, 0xb60c, 0xb1e8, 0xb7ef,
+    0xaf21, 0xb68b, 0xb997, 0x3446, 0xbbeb, 0x3196, 0xba76, 0x3950, 0xaf30, 0xbae8, 0xb359, 0xb73e,
+    0x384f, 0x374b, 0x394b, 0xb7f9, 0x37ab, 0xb1bb, 0xb684, 0xb5fb, 0xb94f, 0x3332, 0xbb83, 0xb896,
+    0x365f, 0x36cd, 0x3829, 0xb22f, 0x39e2, 0x3545, 0xb959, 0xba60, 0xb35a, 0x3280, 0x34a0, 0xb2bf,
+    0x3373, 0xb64f, 0x2d7f, 0x3b88, 0x3632, 0xb4e0, 0x3ac1, 0xb81e, 0x2470, 0xbb67, 0x33c2, 0xb8e0,
+    0xb948, 0xb073, 0x3126, 0xaf10, 0xb3fd, 0x9e5b, 0xbb0e, 0xb62c, 0xbb6c, 0x322f, 0xb534, 0xb677,
+    0xb181, 0x3bbf, 0x3424, 0x2c77, 0x3945, 0x3b25, 0xb6dd, 0x3546, 0x3b4f, 0x222c, 0x394f, 0xb4c7,
+    0xb312, 0xb879, 0xb10a, 0xb087, 0x33dc, 0x3a8e, 0x39ab, 0x38ce, 0x2f94, 0xb3d0, 0x39d1, 0x39d7,
+    0xbb89, 0xb839, 0xb934, 0x338a, 0xaaf1, 0x3906, 0xb022, 0xb8f8, 0xbb81, 0xbaa6, 0xba60, 0xb886,
+    0xba08, 0x327f, 0x3459, 0x3be6, 0x340a, 0xb15a, 0xb5b9, 0x3a5c, 0xba74, 0xbaf0, 0xb510, 0xb997,
+    0x3413, 0xba68, 0xba50, 0x3918, 0x39fd, 0x2ef8, 0xa751, 0x320b, 0xba02, 0xb4ea, 0xb99c, 0xac52,
+    0x39ad, 0xba68, 0x3bf8, 0x38bb, 0xb0e4, 0x3b28, 0xba8b, 0x35f2, 0xb0ed, 0x3bdd, 0xaf73, 0xbb05,
+    0xaa41, 0x37e9, 0x3bf7, 0xb1e9, 0xb099, 0xbae7, 0x36d0, 0x2a23, 0xb0d3, 0xb4cc, 0xb94c, 0x39b4,
+    0x328f, 0x38a9, 0xb7bd, 0x38d3,
+};
+
+// K transposed, D_SIZE x S_SIZE
+uint16_t k_inp[D_SIZE * S_SIZE] = {
+    0x3893, 0x363c, 0xb453, 0x380a, 0xb1bb, 0x3448, 0x30fc, 0x338a, 0xb5c9, 0x39ba, 0x39de, 0xb60e,
+    0x37bc, 0x32b6, 0xb919, 0xb12e, 0xbb75, 0x3304, 0x2b00, 0xb6b7, 0x37a1, 0x39e8, 0xb8ac, 0x3aeb,
+    0x374a, 0xaf74, 0xb48d, 0x2868, 0x3b3e, 0xb60a, 0x39f5, 0xb80d, 0x3aae, 0x3275, 0xb532, 0xb5d1,
+    0x3abd, 0x3469, 0x3527, 0xb204, 0xb0d8, 0xace5, 0xb3ea, 0xba4c, 0xb413, 0x392e, 0xb071, 0x35c1,
+    0x3166, 0x3071, 0xb489, 0x382c, 0xb346, 0xb4c7, 0xb7f7, 0xa92c, 0xb479, 0xac5b, 0x329b, 0x39d2,
+    0xb698, 0x3b9c, 0x38b1, 0xba24, 0xb56a, 0xb7a1, 0xb666, 0x39d6, 0x36b5, 0xbbf7, 0xb882, 0xbac1,
+    0xb92d, 0x36ae, 0x3af6, 0x3b60, 0x2d15, 0xba5a, 0x3334, 0x2823, 0x3384, 0xb6c0, 0xba45, 0xb139,
+    0xba23, 0x3bf8, 0x3a86, 0x38b5, 0xbada, 0x31b7, 0x3786, 0xb329, 0xb9cf, 0x3b86, 0x2feb, 0xbb9e,
+    0x3854, 0xb6d0, 0x3ac2, 0x2f43, 0x395b, 0xaf87, 0x3ae5, 0xb176, 0xb99b, 0x3477, 0x3bc3, 0xb95c,
+    0xb294, 0xbb38, 0xadf7, 0x30bf, 0x3924, 0xaf8a, 0x345a, 0x388d, 0xb6cd, 0x387f, 0x38bd, 0xb07f,
+    0xb75e, 0x37b1, 0x2a1c, 0xb997, 0xb5b7, 0x3835, 0x3612, 0xbb81, 0xba5a, 0xac50, 0xbac4, 0xb2fb,
+    0xbace, 0x3be9, 0xb441, 0x3571, 0xb727, 0xb880, 0xb51d, 0xba84, 0x2d00, 0xba38, 0x2d92, 0x3612,
+    0xac9c, 0xb4df, 0x388b, 0xb9cc, 0xb99b, 0x2eb2, 0x35dc, 0xb305, 0x31a2, 0xab73, 0xb8f1, 0x3829,
+    0x3b02, 0xaabb, 0x3a8d, 0x3218, 0x33e3, 0xb6d1, 0x3bb4, 0x2c65, 0x3bd3, 0xb4f5, 0x3af8, 0x3700,
+    0xaab9, 0x3ac0, 0x3aad, 0xb992, 0xadda, 0x3a3b, 0x3b2e, 0x36d7, 0xb8ad, 0xba06, 0x3b7b, 0x3927,
+    0xbada, 0xb5e2, 0xb672, 0x3b8b, 0x3677, 0x3955, 0x3ad1, 0xb6af, 0xb029, 0x3a05, 0x34ef, 0x3aff,
+    0xbbd2, 0x3bc0, 0xb8c4, 0x3409, 0xb5d0, 0xb7e7, 0x3ba9, 0x396a, 0x35db, 0x2d33, 0x3365, 0xbb51,
+    0x3979, 0x30da, 0xa3e1, 0x35ed, 0x3614, 0xbb01, 0x34d6, 0x39fb, 0xb8c5, 0x3b01, 0x2f05, 0x2a59,
+    0x38c3, 0x2cc6, 0x3836, 0x345e, 0x3a31, 0x3898, 0xb043, 0x3aef, 0xbb2a, 0x324c, 0xab10, 0x39e2,
+    0xaae4, 0xba13, 0x3aa5, 0x39cb, 0x3b52, 0xb78c, 0xb81d, 0xb864, 0xb8ae, 0x3bc8, 0xad19, 0x35eb,
+    0xba0f, 0x37ae, 0x2b0c, 0xb4c4, 0xb2cd, 0x38d7, 0x3491, 0x3908, 0x3670, 0xb65a, 0xb627, 0xb06e,
+    0xb0f4, 0xb017, 0xb052, 0xba92, 0xb3f1, 0xb439, 0xb88f, 0x2d95, 0x3232, 0x3849, 0x3b52, 0xb79f,
+    0xb5d8, 0x36db, 0x3769, 0x38eb, 0x39a6, 0xb56b, 0xba94, 0xb8e3, 0xb76d, 0xbabc, 0xb930, 0x3719,
+    0xb864, 0xb61f, 0xb200, 0x3978, 0xbb50, 0xb73a, 0x3b61, 0x3a2b, 0xb6b7, 0xba88, 0xbb43, 0x3956,
+    0x3872, 0xb53e, 0x38f3, 0x382c, 0x3a38, 0x25ae, 0x37d5, 0xb130, 0xba16, 0x35f3, 0xba18, 0xbb1e,
+    0x39da, 0xb80c, 0xb594, 0x30f0, 0xb5d6, 0xb863, 0x334e, 0xb75b, 0x35bf, 0x3a91, 0x3035, 0xb73d,
+    0xa8d9, 0xad25, 0x288e, 0x36f9, 0x37bc, 0x3845, 0xb9f0, 0x38dd, 0xb28d, 0xb921, 0x3b69, 0x338f,
+    0xb227, 0x2f80, 0xbbe1, 0x2f92, 0xbae3, 0x3a24, 0x3baf, 0xbb50, 0xb5f8, 0xb9e7, 0xbbaa, 0xbb2e,
+    0xbbb8, 0x3b1a, 0xaf35, 0xbb30, 0x3809, 0x320a, 0xa36c, 0x3b87, 0xbb61, 0xae05, 0xb8cf, 0xb606,
+    0x3bc4, 0xa9c6, 0x3634, 0x3639, 0xba75, 0xb116, 0x36bd, 0x39a8, 0x3a5f, 0xb638, 0xb830, 0xbaa9,
+    0xbbeb, 0xbb8c, 0x25ff, 0x3b29, 0xbb34, 0xb63a, 0x3428, 0xbbf2, 0xbbe3, 0xb955, 0xb8da, 0xaf48,
+    0xba9e, 0xb06d, 0xba6c, 0x3a89, 0xb926, 0x31dc, 0x3aa0, 0xbab1, 0x3bf9, 0xb134, 0xbb53, 0x368b,
+    0x3885, 0x386b, 0x39cc, 0xae7f, 0xbbad, 0xb525, 0x9894, 0x371d, 0x316a, 0x339e, 0xb8bd, 0x3992,
+    0xbaeb, 0x3a0a, 0xb8f5, 0xa477, 0x3970, 0x3bd7, 0x35e6, 0xba63, 0xb127, 0xb43b, 0x39fe, 0xb9d6,
+    0x315f, 0x3a08, 0x3257, 0x3aa4, 0x3bc3, 0x3acd, 0x3549, 0xab7a, 0xb518, 0xb7b0, 0x3a77, 0xbb18,
+    0xb2b4, 0x3b78, 0x390d, 0xba75, 0x9acb, 0x3895, 0x28a9, 0x3bcd, 0x3904, 0x313c, 0xb8dd, 0x2e40,
+    0xba8b, 0xb77b, 0xadbc, 0x3bc2, 0x35e0, 0x35ce, 0xb96c, 0xb780, 0x3908, 0x37fb, 0xb1f9, 0x38ed,
+    0x2855, 0xb948, 0xbb9a, 0x3518, 0x3327, 0x3bb3, 0xbbc3, 0x3762, 0x36e2, 0xb9db, 0x3712, 0xb988,
+    0xb986, 0x37e8, 0xb9d3, 0xb964, 0xb86c, 0xac37, 0x3ba6, 0x388c, 0x35d9, 0x3203, 0x3660, 0xbb4b,
+    0xbb09, 0x3bfc, 0xba14, 0x3bc6, 0x31a1, 0x2f05, 0xbbd3, 0xba0c, 0xba13, 0x3a8f, 0xbb21, 0xba51,
+    0xb84e, 0x3402, 0xb507, 0xb927, 0x31db, 0x3a38, 0xb007, 0x3b22, 0x3bcc, 0xab86, 0x3b0e, 0x38de,
+    0x3aa5, 0xb2a9, 0xbb79, 0x25d1, 0xba79, 0x39b0, 0xb238, 0xba41, 0xba80, 0x2b53, 0xb4f2, 0xbb07,
+    0xbb55, 0xb956, 0xb896, 0xb21b, 0x3831, 0x311e, 0x327e, 0xb54d, 0xb7ad, 0xb9fa, 0xb68a, 0xb2b1,
+    0xb5cf, 0xb5be, 0xbaf3, 0x39e8, 0x37e1, 0xba18, 0x3761, 0x3bb2, 0xbb28, 0xb8e7, 0x3a1a, 0xa7ee,
+    0xbadd, 0x36f7, 0x3a04, 0xaa85, 0x3b59, 0xba04, 0x3833, 0x39c0, 0xb861, 0x3428, 0xbad6, 0xb529,
+    0xb440, 0x320d, 0x2f31, 0xb1fd, 0x2dcf, 0x385b, 0xb59b, 0xb884, 0xb33d, 0xbb55, 0x3ab1, 0x3aed,
+    0xb9af, 0xb4c6, 0xb97f, 0xb4a8, 0xb977, 0xb43a, 0x36fa, 0xbaa7, 0x2c11, 0xb9ce, 0x34db, 0x3923,
+    0x38ec, 0x3bc6, 0xb6c1, 0x3050, 0x39c7, 0xb9de, 0xb893, 0x24a9, 0x3799, 0xbaf2, 0xb85e, 0x38cb,
+    0x376d, 0x3a78, 0xb9e8, 0xb933, 0xb88b, 0x38f5, 0x29aa, 0x3545, 0xb3d7, 0xa5ac, 0x3a64, 0x38a3,
+    0xac9a, 0xb2ae, 0xb6c0, 0xbbcf, 0xb63e, 0xb942, 0x397d, 0x2905, 0xb599, 0x35bd, 0xb7cf, 0x381a,
+    0xb073, 0x395a, 0xbadf, 0x3692, 0x334e, 0x3a5e, 0x3419, 0xa501, 0xb7d6, 0x343f, 0xb226, 0xbb5e,
+    0x3948, 0x3aba, 0xac38, 0xb86b, 0xb85c, 0x372e, 0x352d, 0xb51a, 0xb6e4, 0xb2c7, 0x3b2d, 0xbbd4,
+    0xb190, 0xb531, 0xb786, 0xb87b, 0xb8bf, 0xac67, 0x389b, 0x358a, 0xb955, 0x2d9b, 0xa80f, 0xba40,
+    0x33ed, 0x3ac1, 0xb251, 0xb7da, 0xb26e, 0x3243, 0x38e8, 0xbb48, 0xb818, 0xb925, 0xb5f9, 0x2d0b,
+    0x391c, 0x3ab1, 0x3939, 0xb31b, 0x35b2, 0xbbef, 0xb527, 0x1fd3, 0x3b18, 0xb4ad, 0xb1d2, 0xb656,
+    0xbb12, 0x2ff7, 0xb933, 0x352a, 0x3a3c, 0x30a6, 0xb944, 0xb91c, 0x312b, 0x2c31, 0xaf7c, 0x30b7,
+    0xb807, 0x3a97, 0x36fa, 0x9c87, 0xba34, 0xbb96, 0x3066, 0x324e, 0x8f33, 0x3569, 0xbb87, 0x381d,
+    0x38ff, 0xb953, 0xbbcd, 0xa2ec, 0x3b14, 0x341c, 0x38da, 0x3b59, 0xb9af, 0x3389, 0xb7a5, 0xb905,
+    0x9b1d, 0xb9b4, 0x3676, 0x377f, 0x38fa, 0xb727, 0xb779, 0xbaff, 0xac39, 0xafce, 0xb0cd, 0x38db,
+    0xb751, 0xb95a, 0xb8ad, 0xb05c, 0xaa84, 0xafc0, 0x3228, 0xbaa5, 0xba88, 0xb416, 0x3b46, 0x39be,
+    0x3827, 0xb6b9, 0xaf6a, 0x38a4, 0x3ba7, 0xb2c7, 0xb9de, 0xb4c5, 0xb93e, 0x2c11, 0x31dd, 0xbb6f,
+    0xb8a4, 0xb94f, 0xb9f7, 0xb058, 0xb2a6, 0xb155, 0x31c6, 0x3ba2, 0xb957, 0x395d, 0xb87b, 0xb8fc,
+    0x3851, 0xb940, 0x302f, 0x37ca, 0xa5b7, 0xb41d, 0xbb8f, 0x3b66, 0xb9f8, 0x37f9, 0x33ac, 0xb99c,
+    0xb91b, 0xa4a5, 0xb943, 0xb358, 0xb5b9, 0x306b, 0xb8f8, 0xba71, 0x3651, 0xb887, 0xb58f, 0xb07d,
+    0x38c0, 0x36a7, 0x3a4f, 0xb7b9, 0xbbf0, 0x39ba, 0xbac2, 0xb402, 0x3b36, 0xb6d1, 0xbb7a, 0x3a78,
+    0xb079, 0xb474, 0x3449, 0xb6e7, 0x37a9, 0x3aae, 0xbb8d, 0x3435, 0x36cb, 0xb5a6, 0x3a7b, 0x2d8c,
+    0x3b8d, 0xba37, 0x38d6, 0xbafa, 0x3883, 0xb094, 0xb7c0, 0x35d8, 0x2ef1, 0x3954, 0x3a57, 0x25e8,
+    0x3a75, 0x32fc, 0x3943, 0x3874, 0x3adf, 0xb10f, 0x3ab4, 0xbbc1, 0xbb01, 0x30d6, 0x3b59, 0x394f,
+    0x36ca, 0x3b21, 0x3b05, 0xb620, 0xbaf7, 0xba5e, 0xb4a5, 0xa61d, 0x37c2, 0xb80b, 0x343a, 0xb9db,
+    0xbae5, 0x3565, 0xb4c4, 0x3094, 0x37df, 0x39a8, 0x330f, 0x3964, 0x3b29, 0x3978, 0x2e69, 0x2023,
+    0x3936, 0x379b, 0xb6ee, 0x32a4, 0xb802, 0xbaca, 0xb670, 0xb877, 0x340a, 0xb88d, 0xb386, 0x303e,
+    0xaf15, 0xb5cc, 0x3be9, 0xb146, 0xb58e, 0x3b23, 0xb9be, 0xacee, 0xb781, 0x3700, 0xbbd1, 0x3143,
+    0x3bc0, 0x19f0, 0x3772, 0xb42f, 0x299d, 0xb4ae, 0xb003, 0x38ed, 0xb9cc, 0xb581, 0x2c41, 0xb5a9,
+    0x385c, 0xbac9, 0x2953, 0x3b9b, 0x3691, 0xb7a0, 0x34a4, 0xb278, 0xb889, 0xa14e, 0xb46d, 0xb1bf,
+    0x366d, 0xb97a, 0x34c1, 0x34a5, 0x2d38, 0xba12, 0xb62d, 0xb8a8, 0xbacf, 0x332c, 0x3a94, 0x3ac4,
+    0xb874, 0xbb8c, 0xb73d, 0xae42, 0xb34e, 0x358e, 0x3885, 0x28eb, 0xb222, 0x304a, 0x2cd0, 0xb622,
+    0x38bb, 0x3647, 0xbacd, 0xb06a, 0xbaeb, 0x393c, 0x34d7, 0x34d7, 0xbb44, 0x3a98, 0xb0bc, 0x344f,
+    0xb0ea, 0xb85b, 0x3b9a, 0xb8fc, 0x3156, 0x39b1, 0xb471, 0xb72c, 0xb233, 0x3828, 0x25b7, 0x3758,
+    0x3ace, 0xb4ce, 0xafe7, 0xba31, 0xa023, 0x3b62, 0xb710, 0xb32d, 0xb687, 0xb946, 0xb9a7, 0x3baf,
+    0x3af9, 0xb908, 0x395e, 0x2e22, 0xb9f2, 0x3bc0, 0x3926, 0xbba5, 0xb97c, 0xb440, 0x3402, 0x3836,
+    0x38dd, 0xaf2b, 0xbafc, 0xa701, 0x2852, 0xa282, 0xb7e2, 0x30cb, 0x3b64, 0x385f, 0xba14, 0x3202,
+    0x2d40, 0x3a6c, 0xb4f6, 0xa4fc, 0xb1ad, 0xbbd1, 0xb418, 0x3b70, 0xb6ac, 0x2b7c, 0x3a97, 0x373e,
+    0x3544, 0x35b6, 0x368e, 0x3667, 0xb1b3, 0xbb0f, 0x2dea, 0xa237, 0xb528, 0xbae3, 0x3a48, 0xb7a3,
+    0xb645, 0x28c7, 0xbaeb, 0xae0c, 0x2950, 0x3ae6, 0xb1f1, 0xb717, 0x3922, 0xb9c7, 0xbadb, 0xba9f,
+    0xb944, 0xb9cc, 0xbb20, 0x3845, 0xad98, 0xbb80, 0x2bf1, 0xaa57, 0xa447, 0x22d7, 0x3bf1, 0xb531,
+    0xb656, 0xaa65, 0xba9a, 0xba39,
+};
+
+uint16_t v_inp[S_SIZE * D_SIZE] = {
+    0x3b0a, 0xb35a, 0x3a4c, 0xb922, 0x331f, 0x37ab, 0x3bfc, 0xb8f2, 0xaeec, 0x3b45, 0x39f5, 0xb706,
+    0x3848, 0x3bc4, 0xb734, 0xb5c6, 0xba17, 0xb59f, 0xb8ab, 0x3451, 0xae04, 0xb222, 0xa8fa, 0x38d3,
+    0x364d, 0xb635, 0xbaca, 0x3b8e, 0xb8e0, 0xb86a, 0xb95b, 0x3818, 0xb426, 0x3bc5, 0x3b11, 0x3a5a,
+    0x3a3d, 0xa628, 0xba29, 0xb939, 0xaeb3, 0xb7f1, 0x39d5, 0xbbc8, 0xb86f, 0xbb5e, 0x3878, 0xb714,
+    0x291a, 0xb61c, 0x3ae6, 0x393d, 0x3948, 0x3b4e, 0x3946, 0xb8da, 0x30e4, 0x3a19, 0x260d, 0x3837,
+    0x3ab4, 0xba61, 0xb6b9, 0x3376, 0xb550, 0xaa82, 0x39f4, 0x3a86, 0xbad4, 0x3885, 0x3b15, 0xb389,
+    0xb94a, 0x34d1, 0xbace, 0xb9d2, 0x362d, 0xb99b, 0x38e7, 0x36b4, 0x3453, 0xb2b1, 0x3a3b, 0xbac0,
+    0x35b4, 0x389d, 0x36d6, 0xb91f, 0x3a7a, 0x33f2, 0x3bfd, 0x2d45, 0xb487, 0x3ae4, 0x332e, 0xbb0d,
+    0xab11, 0xbacf, 0x3bf0, 0xb474, 0x2d02, 0x3866, 0xb4ac, 0x3125, 0xb083, 0xb5a6, 0xba82, 0x3917,
+    0x259e, 0xbb2f, 0x3ba8, 0x3418, 0xae00, 0xb603, 0xb35d, 0x39e5, 0x3b69, 0xae77, 0xb925, 0xb94a,
+    0x398f, 0x2987, 0x29c8, 0xb84e, 0x3af7, 0xb948, 0xb267, 0xb506, 0x333f, 0xbb78, 0x31a8, 0xb943,
+    0xb83a, 0x38d9, 0xb8a8, 0x38b0, 0xb51b, 0x38f7, 0x36f8, 0xbbf4, 0xb0d2, 0x3a8f, 0xb9f7, 0x38f6,
+    0xb42c, 0xb844, 0xb575, 0x2f99, 0xb830, 0xb792, 0x9b78, 0xb624, 0xb4cd, 0x3278, 0x3a6b, 0xb5c6,
+    0x3af9, 0x3758, 0xb476, 0x3450, 0x378c, 0x39ac, 0x3230, 0x3b23, 0x2d21, 0xac9d, 0x3822, 0xb8e6,
+    0xb1f6, 0x343b, 0x3618, 0xaf46, 0xbbd2, 0xb80f, 0xb457, 0x39c6, 0xb190, 0xbbe3, 0xa211, 0x3831,
+    0xbb2a, 0x377d, 0xba2f, 0x35d7, 0x34a9, 0xb884, 0x37f8, 0x352b, 0xb204, 0xb9ad, 0xb82f, 0x38e8,
+    0x38f2, 0x36be, 0x38c2, 0xaae2, 0x361e, 0xaddf, 0x3746, 0xab7d, 0xbb93, 0xbbdf, 0xbb3c, 0xb36b,
+    0xb97e, 0xac36, 0xb9e5, 0xb73d, 0xb71d, 0xb975, 0xb691, 0xb860, 0x3453, 0x3862, 0xb777, 0xba17,
+    0xb6b9, 0x3626, 0xa53a, 0xb210, 0xb72f, 0x35c1, 0xb94f, 0x3b36, 0xba5c, 0xb5b8, 0x3a51, 0xb2a6,
+    0x34ae, 0xa809, 0xaec5, 0x38b2, 0x3527, 0x38e3, 0x3b55, 0xbbaa, 0x2ff3, 0x3aa8, 0xba98, 0x3af6,
+    0x37b3, 0x2d0e, 0x30e1, 0xb8e4, 0xb87e, 0xb97a, 0x3227, 0xbb88, 0x3b1d, 0xaa3b, 0x3295, 0xb86b,
+    0xbaa0, 0xb509, 0xbb8b, 0x3bb7, 0xb31e, 0xba18, 0x321e, 0x3a1a, 0x3b89, 0xb642, 0xb76b, 0xae86,
+    0xae02, 0x25c0, 0x962b, 0x205d, 0x354e, 0x3ac7, 0xac53, 0xaddb, 0xb05a, 0xbb00, 0x3a88, 0x3a1d,
+    0xb8f1, 0xb5f4, 0x3697, 0xb139, 0x367e, 0xbb4f, 0xb01b, 0x2e26, 0x3b00, 0xb54e, 0x37da, 0xb71c,
+    0xb576, 0xb6f9, 0xaa1c, 0xb8ff, 0x3440, 0xad4d, 0x3835, 0x381f, 0xb0fd, 0x3568, 0x35f3, 0xb8f9,
+    0x3b63, 0x3881, 0xb7c7, 0xba7c, 0x3adb, 0xba12, 0x224f, 0x3939, 0xb89f, 0xaa0b, 0xb90f, 0xbb2a,
+    0xb60f, 0x3559, 0x3a73, 0xb615, 0xba35, 0xb888, 0xba59, 0x3559, 0xa8cb, 0xac38, 0x36a4, 0xb6ce,
+    0x3639, 0x3531, 0x3bc7, 0x34a9, 0xbaa7, 0xb84e, 0x381a, 0xb4c3, 0x38ca, 0x3a2d, 0x3b2f, 0x35ee,
+    0xb409, 0x3420, 0x373b, 0x35c0, 0xb595, 0xafb8, 0x380b, 0xb9f1, 0xb16c, 0xbb5b, 0x3b1f, 0xb9c5,
+    0x3503, 0xb930, 0xb310, 0xb908, 0x3234, 0xb8ab, 0xaed1, 0xb0af, 0x3a6b, 0x3319, 0xbad7, 0xb3d3,
+    0x3503, 0x3838, 0xbae0, 0xb749, 0x3053, 0xba69, 0x2632, 0xb713, 0x3adc, 0x3392, 0x3237, 0x38f7,
+    0x3af2, 0xab7b, 0x3619, 0x3aab, 0xac14, 0x3319, 0x3a20, 0xb9d2, 0xb48a, 0x348a, 0xbbd5, 0xb7e2,
+    0xba2d, 0x387d, 0xb60e, 0x3990, 0x3aea, 0xbb85, 0x38f3, 0xb96e, 0x38a8, 0x32c0, 0x3b14, 0x3b84,
+    0xb648, 0x323e, 0x3a3c, 0x3bd3, 0x39da, 0xb67d, 0x3b4d, 0xb4cd, 0xba68, 0xb0e1, 0xa9a1, 0x3b02,
+    0x2c79, 0xb0ef, 0xb88d, 0xba3a, 0x320a, 0xbb42, 0xab63, 0x2b34, 0x3a46, 0x3b95, 0x3927, 0x3730,
+    0xa8eb, 0xbb4b, 0x3b56, 0x3243, 0x30cd, 0x362f, 0x31d2, 0xb297, 0x3b49, 0xb9d9, 0xb313, 0xb91d,
+    0x3048, 0xba2a, 0xaed1, 0x34a6, 0xae26, 0x3a3f, 0x374f, 0xb67b, 0x37b3, 0x30ac, 0x397e, 0x2e00,
+    0x37d2, 0x38e1, 0x3a95, 0xb79d, 0xb5af, 0xb9df, 0x3bb7, 0xb50a, 0xbb98, 0xb7c7, 0xb84a, 0xb586,
+    0x3a9b, 0x30ea, 0xb0f3, 0xbb4d, 0xb8dc, 0xb8ad, 0xba94, 0xaf4c, 0x38b5, 0xb20e, 0x2db2, 0x325f,
+    0x3894, 0xb358, 0x3ada, 0xba64, 0x369d, 0xb021, 0xb92a, 0x3a9a, 0xb7a1, 0xba32, 0xb83a, 0xb598,
+    0xb908, 0xa982, 0xae5e, 0xb8c4, 0xbb79, 0xbb4c, 0x39e1, 0x3319, 0x3933, 0x3bb4, 0x3762, 0x3abf,
+    0xb419, 0xb62b, 0x2c2b, 0x2d75, 0xbb6c, 0xbad2, 0x20d6, 0xbb4b, 0x3b97, 0xb9dd, 0x3327, 0x372b,
+    0xbb0b, 0xb402, 0xb76f, 0x3adb, 0x39ff, 0x957f, 0xb9fa, 0xb839, 0x387e, 0xb971, 0x395c, 0x2c4c,
+    0xa59e, 0x34b1, 0x3895, 0xbb6b, 0xb771, 0x39b3, 0xb806, 0x3b00, 0xbaec, 0xba29, 0x2ed2, 0xb797,
+    0x3836, 0x39f4, 0xb8fa, 0xb282, 0x39af, 0xbb7d, 0xba8b, 0xb96b, 0xb912, 0x340d, 0x363e, 0xb374,
+    0xb098, 0xb9a4, 0xbbd6, 0xb592, 0xb546, 0x3022, 0x385d, 0xb841, 0xb992, 0xb9e4, 0x3bc2, 0xbba9,
+    0x3584, 0x3893, 0xba91, 0xb1d0, 0xaeeb, 0xbafa, 0x3b59, 0xb0c5, 0x3660, 0xb7fd, 0xba92, 0x354b,
+    0x2eb5, 0xba0c, 0x36fd, 0x3689, 0x3515, 0x3998, 0xb93b, 0xb8b0, 0x38a2, 0xb533, 0x3499, 0x22ea,
+    0x2d1f, 0x34a3, 0xaa69, 0xb400, 0x38a7, 0x3935, 0xb8be, 0x310f, 0x2cbc, 0xba42, 0x3b72, 0xb949,
+    0xb696, 0x3305, 0x3bf8, 0xb65d, 0x3bdb, 0x3a06, 0xb80d, 0x38aa, 0xb5d9, 0xab08, 0xab29, 0xba57,
+    0x3b17, 0x2e53, 0x391a, 0x3a54, 0x3897, 0xae58, 0x3810, 0x381d, 0x31de, 0x39cd, 0xba0e, 0x3322,
+    0x366e, 0xb8e7, 0x324d, 0xb520, 0xb9b5, 0xba1c, 0x34f0, 0x3855, 0x3876, 0xb1b7, 0xa6fe, 0xb9c2,
+    0x3448, 0xb792, 0xba4a, 0xb5bd, 0xb1cc, 0xb911, 0x39fa, 0x39bd, 0xba3c, 0x399f, 0x35b4, 0x3b4d,
+    0x373a, 0x3a42, 0x3a08, 0x2e73, 0xb6ec, 0xb4db, 0x3405, 0x3642, 0xb7d5, 0xbae8, 0xb56e, 0xbb24,
+    0x386d, 0xb738, 0xbb89, 0x2c8f, 0x37eb, 0x31e0, 0x3b6d, 0xb657, 0x3468, 0x31c2, 0x3af6, 0xbaf9,
+    0x343c, 0xba5e, 0xbbf2, 0xbb9b, 0x3920, 0xa96e, 0xb79e, 0x38c8, 0x34f9, 0xbb75, 0x39e2, 0x3993,
+    0x3844, 0xb6ea, 0x36fc, 0xbaff, 0x2a13, 0xb4fc, 0x3a1a, 0xb52d, 0x37ed, 0xbaf6, 0xba56, 0x3174,
+    0xb31e, 0xb9b3, 0xbb54, 0x348d, 0xb26b, 0xb73b, 0xbbf7, 0xb8c6, 0xbb7a, 0xad1a, 0xb6db, 0xb45c,
+    0xb66d, 0xaaab, 0xade2, 0xb545, 0xb84e, 0xb575, 0xb9aa, 0x35c2, 0x36aa, 0xbb0b, 0x3beb, 0xbbb0,
+    0x39b2, 0xb5a6, 0xb864, 0x9977, 0xbbcf, 0x3612, 0xbbce, 0x3bb7, 0xba2f, 0x3610, 0x9de4, 0x39d6,
+    0x3a2e, 0xbbcb, 0xae17, 0x3a5f, 0xba05, 0xac10, 0xb9e5, 0x3785, 0x3943, 0x38f5, 0xb6ee, 0x39f9,
+    0xbb1a, 0xb407, 0x3061, 0xb814, 0xba97, 0xb8fb, 0xb8dd, 0x3b81, 0xbbeb, 0x34a1, 0xb985, 0xb76e,
+    0xb76c, 0x3433, 0xba26, 0xb0e3, 0xb571, 0xb8b3, 0xbb6b, 0xb3a7, 0xb2db, 0x3b67, 0xb894, 0x3946,
+    0x3296, 0x3b12, 0xb3b4, 0xb495, 0x3647, 0xb158, 0x3581, 0xa6a2, 0x314c, 0x3405, 0xad3b, 0xb737,
+    0xb691, 0x3ac2, 0xba3a, 0xbb5b, 0x3917, 0x3b7f, 0xb9f3, 0x3952, 0x391f, 0xb5a4, 0xb44f, 0x35d6,
+    0x3256, 0xbb7c, 0x381e, 0xb809, 0x3aeb, 0xb6bb, 0xb742, 0xb87f, 0xb996, 0x3a57, 0xaec2, 0xb503,
+    0xa4ab, 0xaf05, 0x3b29, 0xb755, 0x38c0, 0xb47a, 0xb678, 0xb88f, 0xba5a, 0x30fe, 0xb74d, 0x366e,
+    0xbacc, 0xb8fe, 0xb748, 0x374c, 0xab78, 0xba66, 0xb98f, 0x3a1a, 0x34bc, 0x2b3f, 0xb51e, 0x39c2,
+    0x341f, 0x33d0, 0xbb06, 0x39c1, 0x39c9, 0xb6cf, 0xb440, 0xb06d, 0xb998, 0xb1a1, 0x3b47, 0xb538,
+    0x3b70, 0x36e8, 0xb9f4, 0xb8a9, 0xb40b, 0xb098, 0x3a8d, 0x3827, 0xb1f3, 0xb3c9, 0xb526, 0xb533,
+    0xb9b0, 0xb571, 0xba93, 0xafb2, 0xb86f, 0x34cb, 0xb0b8, 0x353c, 0x34ec, 0xb495, 0x28c8, 0xb60a,
+    0xb9d8, 0xaa7c, 0xb0d7, 0xb56b, 0x2dab, 0x39fa, 0xb6de, 0xb9de, 0x9e92, 0x38ad, 0xb463, 0xbb54,
+    0x35f6, 0x385c, 0xb7e3, 0xb164, 0x39ec, 0xbb69, 0x3b04, 0xb89d, 0x3a14, 0x375d, 0x3661, 0xb36d,
+    0x35bd, 0xb83b, 0xa85a, 0xb5fa, 0xa73c, 0x3a5f, 0x3a25, 0xb94f, 0x33dd, 0x2dff, 0xb76d, 0x2b72,
+    0xb535, 0xb944, 0x3855, 0x38c9, 0x3594, 0xb9cf, 0x2be9, 0x3ac4, 0x32b5, 0x315a, 0x26b5, 0x3387,
+    0x3ac7, 0xb91f, 0x3a07, 0x33e5, 0xb891, 0xbb29, 0xb51a, 0x352f, 0xaf34, 0x3ba1, 0xbbd2, 0xb9c8,
+    0xa74b, 0xb4d3, 0x39e1, 0xbaac, 0xb1ae, 0xb96b, 0xb75b, 0xb798, 0xb11d, 0xb840, 0x394b, 0xb881,
+    0x38d8, 0x3967, 0x3907, 0x3356, 0x312f, 0x3595, 0x33e0, 0x369c, 0xb38c, 0x3ba2, 0x3858, 0xb12b,
+    0x3ac5, 0xbb7e, 0xb59e, 0xb703, 0x31d4, 0x39b5, 0x1c80, 0xb775, 0xb9b2, 0xb87c, 0x377e, 0xb327,
+    0xb19a, 0x38fc, 0xb566, 0x30a3, 0x372f, 0x3aaa, 0x3751, 0x36f6, 0x384a, 0x3ae1, 0x3a90, 0x3842,
+    0xb8b9, 0xb825, 0x3bcd, 0x3001, 0xb808, 0x38c1, 0xb21a, 0xb25b, 0x37ac, 0x36a2, 0x2da5, 0xbb3a,
+    0xb0d4, 0xba1d, 0xb82b, 0x3b0f, 0x303c, 0xb60b, 0xb483, 0xb305, 0x36ae, 0xba0e, 0x23e1, 0x3759,
+    0xb9cd, 0x3af6, 0x352b, 0xbacd, 0xa994, 0x386b, 0xba54, 0xbbcc, 0x3625, 0x3a70, 0xb752, 0xbb91,
+    0xac0b, 0x3842, 0xb7a2, 0x3a6c, 0x3272, 0xbb8b, 0x3038, 0x3a4b, 0xba95, 0x2ff6, 0xb616, 0xb59b,
+    0x3816, 0xb68d, 0x3aec, 0x3ba2, 0xb343, 0xa754, 0x3a59, 0x3b9c, 0xb344, 0xb28e, 0x3910, 0x24ec,
+    0xb862, 0x29af, 0xb723, 0xb80c,
+};
+
+uint16_t o_out[S_SIZE * D_SIZE] = {
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,    0x0,
+    0x0,    0x0,    0x0,    0x0,
+};
+
+// softmax(Q * Kt) * V
+uint16_t o_golden[S_SIZE * D_SIZE] = {
+    0xa9e5, 0xb418, 0x2750, 0xa50a, 0x29e8, 0xb15b, 0xa9fa, 0xab66, 0x2900, 0x2c39, 0x2ee5, 0xae49,
+    0x2934, 0x308b, 0xb425, 0x3035, 0x31ca, 0x1d2d, 0x2ded, 0x3334, 0xa808, 0xb07d, 0x2f10, 0xb21a,
+    0xa9c0, 0x31ff, 0x30a7, 0xb423, 0xb166, 0xb2f8, 0xb4a7, 0x309d, 0x2d9b, 0xb3be, 0x31ba, 0xa2b0,
+    0x2bec, 0xb0cf, 0xacb1, 0xb15b, 0x23c5, 0x23df, 0xa6da, 0x2cec, 0x2b4e, 0x2237, 0x333,  0x9ac6,
+    0x3804, 0x3749, 0x369e, 0x34be, 0xa653, 0xb86c, 0x3823, 0x27a0, 0x2cda, 0x32fa, 0x3019, 0xb190,
+    0x382c, 0xb7a7, 0xb055, 0xb60d, 0xacf8, 0xb1a9, 0x2dd9, 0xa224, 0x2afb, 0xb486, 0x289e, 0xb2a3,
+    0x31a5, 0x22d7, 0xa727, 0x303c, 0x9d1e, 0xaaaf, 0xa0b6, 0x2cc0, 0x32cd, 0xb0c7, 0x3369, 0x2c21,
+    0xabfb, 0x2cd0, 0x2c19, 0xb210, 0x2d86, 0x28e6, 0x3191, 0xa6be, 0x28f8, 0xae86, 0xac23, 0x1796,
+    0x2a21, 0xa890, 0x2d6c, 0x2eee, 0xad6c, 0xb248, 0x30a2, 0xb4fb, 0x2d9b, 0xa61a, 0x32e1, 0xb0ef,
+    0xadef, 0xb442, 0xb47b, 0xa614, 0x2f7d, 0xb394, 0x2e99, 0x9c11, 0x2e2b, 0xb171, 0x2d80, 0xb2ce,
+    0x3412, 0xb09d, 0xb1a7, 0x30c4, 0x2923, 0xaf7c, 0xb330, 0x2f12, 0x2ee2, 0xb12b, 0x3305, 0x2428,
+    0x2537, 0xb527, 0x2c2b, 0xb269, 0xa22b, 0x2d59, 0xa7f1, 0xad3e, 0x3077, 0xb065, 0xae65, 0xabe8,
+    0x3077, 0xaf16, 0x3278, 0xa584, 0x295c, 0x2f07, 0x3080, 0xb1ba, 0xacdd, 0x2ec4, 0x2e67, 0xb0bb,
+    0xac92, 0xae53, 0xa701, 0xb3ef, 0x2f3a, 0xb179, 0x363d, 0x3451, 0xadc6, 0xad7c, 0x31bb, 0x2bcc,
+    0xac6d, 0xb035, 0x3284, 0xad2d, 0x14d1, 0xacec, 0xac33, 0xb090, 0x211c, 0xb376, 0x2e9d, 0xab02,
+    0x2dba, 0xa39e, 0x31d6, 0x230c, 0xae33, 0x2eed, 0x31be, 0xaf39, 0x3168, 0x3061, 0xacaa, 0x2bb4,
+    0x22f6, 0xb093, 0x3103, 0x2881, 0xa858, 0xb009, 0xa5c4, 0xacc2, 0xa075, 0x152d, 0x2fa6, 0xaa32,
+    0xa175, 0xa5c3, 0xb0fe, 0x2924, 0x34ad, 0x2d53, 0x304c, 0x34e2, 0x2eda, 0xadf8, 0x32e3, 0xac9c,
+    0xae9e, 0x303b, 0x34ae, 0xb4f0, 0xb092, 0xad28, 0xb5ec, 0xac55, 0xaabb, 0x9efb, 0xac57, 0x2c0b,
+    0x33db, 0xad40, 0xb0ae, 0xabcb, 0x2aed, 0xaed6, 0x9ee2, 0x2d14, 0x2cf8, 0xaacb, 0x97ad, 0xaf99,
+    0x2c79, 0x2096, 0x2c56, 0xa47f, 0x291a, 0xa5c6, 0x2cb0, 0xb006, 0xa526, 0x280f, 0x2505, 0xa9fd,
+    0xaf6e, 0xb1e1, 0xb0e5, 0xa863, 0x2fa5, 0xb2a3, 0x2fb1, 0xa6e1, 0x30ac, 0x262a, 0xa4c1, 0xb134,
+    0x2d00, 0x2c3f, 0xadd6, 0xad65, 0x2250, 0xb2b3, 0x274c, 0xb37e, 0x3091, 0xac35, 0x2917, 0x3191,
+    0x1fd1, 0xafe6, 0x2cf9, 0xb236, 0xabc5, 0x3019, 0x2f6e, 0xb3cd, 0x2c1f, 0xb0d9, 0xb2dd, 0x2848,
+    0xafb1, 0xaa4e, 0x1968, 0x2760, 0xabdd, 0xad51, 0xaee0, 0xafbf, 0x28c6, 0xa52f, 0x16d8, 0x2892,
+    0xb01e, 0xb394, 0xb2cb, 0xaf93, 0x25fa, 0xb2d9, 0x31f1, 0xa9b1, 0x2460, 0xa29b, 0x2cec, 0xb37a,
+    0xadf6, 0x2ed9, 0x2a8c, 0xb093, 0x2cb9, 0xa760, 0xb12e, 0x2c6d, 0x329c, 0xa41c, 0xac8b, 0x2ede,
+    0x311e, 0xb07d, 0x2d32, 0x2a3a, 0xb025, 0xa5a0, 0x3232, 0xa982, 0x2b38, 0xa96b, 0xaf8e, 0xb328,
+    0x3203, 0x1fe4, 0x31cf, 0x2f29, 0x32b0, 0x2c39, 0x3138, 0xab15, 0x1d61, 0xaa60, 0x34b9, 0xb46a,
+    0x2139, 0xac43, 0xac47, 0xb2cd, 0x317c, 0xb17d, 0x3120, 0x3059, 0x2532, 0xad76, 0x21df, 0xaf81,
+    0x28f8, 0x2bfa, 0x2ebc, 0xb048, 0x2c7f, 0xb1fc, 0xb207, 0xac49, 0xac36, 0xb4fb, 0x341f, 0xab30,
+    0xb066, 0x2c57, 0x2f71, 0xa1e2, 0x253d, 0x2bf3, 0x2827, 0xb28d, 0x2035, 0xb24f, 0xb41d, 0x2806,
+    0x349a, 0xb001, 0x331c, 0xb320, 0xa81a, 0xb1a3, 0x32cc, 0xb4bd, 0x34d1, 0xb329, 0xac2e, 0x2b30,
+    0x2c8e, 0xb28b, 0xb2d5, 0x30f6, 0x31bb, 0x2eb1, 0x221b, 0x267c, 0x307f, 0xa041, 0x324b, 0xaf8b,
+    0x234c, 0xafa6, 0x30ac, 0xab25, 0xb00e, 0xb474, 0xb45a, 0xb40a, 0x2962, 0xb05d, 0x305b, 0x8f25,
+    0x2aa9, 0xaa2a, 0x2db7, 0xa83f, 0x203e, 0xa4ea, 0x2eff, 0x1ff6, 0x2795, 0x2cfa, 0xac79, 0xb15a,
+    0x2bbb, 0xa995, 0x324f, 0x2851, 0x2add, 0x309a, 0x2f6b, 0xb1bd, 0x2e70, 0xa9a8, 0x32d6, 0x28bb,
+    0x2229, 0x2f8f, 0x9a56, 0xb1c2, 0x2b09, 0xb4e2, 0x3588, 0xb331, 0x2d21, 0x2d79, 0x24d4, 0xb401,
+    0x30b5, 0x3038, 0x2e09, 0x2f1a, 0x2b69, 0x30b8, 0x3079, 0xa7fe, 0x33ce, 0xb1ec, 0x34e2, 0x2e6e,
+    0xa10b, 0xa843, 0x31b4, 0xae66, 0xa624, 0x2a11, 0x3338, 0xad9e, 0xa957, 0xa1bf, 0xafd7, 0xb0bc,
+    0x2d5f, 0xaab8, 0x270a, 0x236c, 0xa674, 0xaeec, 0x2612, 0xad85, 0xa7c8, 0x2610, 0x3100, 0x2bbc,
+    0xabc3, 0xaffa, 0xaf8b, 0xb169, 0x2c27, 0xa384, 0x2f5c, 0xb208, 0xac30, 0x2246, 0x3017, 0xb021,
+    0x3000, 0xa9de, 0x28b9, 0x284a, 0xb013, 0xaa71, 0xb0ef, 0x3017, 0xaa38, 0xb08d, 0x2bbb, 0xac97,
+    0x9c37, 0xa6e9, 0xa03e, 0xb2e0, 0xabb6, 0xa634, 0x3327, 0xb0fc, 0x21bf, 0xa1cc, 0xa8e0, 0x2d64,
+    0x29bf, 0xb2e4, 0x2929, 0xa8f3, 0xaca1, 0xb4c3, 0x3135, 0xae85, 0x2a89, 0x329e, 0xb396, 0xb2cf,
+    0x301f, 0xb20b, 0xad86, 0x1944, 0x2d45, 0x26ce, 0x284a, 0x2a14, 0x2643, 0x27a9, 0x93e5, 0xa4ef,
+    0x259a, 0x2c4a, 0xab82, 0xac7a, 0x2e38, 0xb4ee, 0xa44d, 0xaf11, 0xb4c2, 0xb3e0, 0x3578, 0xaf50,
+    0x294d, 0xaca9, 0x26ff, 0x332a, 0x30f6, 0x3270, 0x36e8, 0xb6b5, 0x2ff0, 0x35d1, 0xb6ee, 0x365f,
+    0x32ba, 0xa216, 0x28e2, 0x311e, 0xad85, 0xb15e, 0xa893, 0xb437, 0x3360, 0xabb1, 0x30e9, 0x2dfc,
+    0x2dfd, 0xae62, 0x1c9a, 0xa82a, 0x25b9, 0xae9e, 0x2e4c, 0x29c9, 0xa51b, 0x2e2b, 0x305a, 0x2720,
+    0xb05d, 0x2fba, 0x957e, 0xab65, 0x2ef5, 0xacce, 0x2ac7, 0xac26, 0x2a4a, 0xb008, 0x2f91, 0xb051,
+    0xa723, 0x2b62, 0x2d2b, 0xafec, 0x242a, 0x29ca, 0x28b6, 0x1bd6, 0xa953, 0xa949, 0xaffe, 0x29d7,
+    0xa568, 0xb2c7, 0x2c26, 0xb079, 0x2af9, 0xad4d, 0xa973, 0x249f, 0xaaa3, 0x2c7a, 0x1dfc, 0x2ae6,
+    0x29f6, 0x29a8, 0xaf77, 0x2c81, 0xad6b, 0xb44c, 0xa287, 0x3260, 0xae70, 0xb3da, 0xb242, 0xb28b,
+    0x3372, 0xa95f, 0xb142, 0x2ef8, 0x998d, 0xacf8, 0xa9eb, 0x2a89, 0x2fc4, 0xb003, 0x35aa, 0xb340,
+    0xadf5, 0xb525, 0x2ad2, 0xb4a2, 0x31fc, 0xb439, 0x2e6a, 0xaeed, 0x3132, 0xae82, 0x2758, 0x2b23,
+    0x90dc, 0xb0b2, 0x309b, 0x31fb, 0x93cc, 0xb1c8, 0x28d2, 0xb473, 0x2fd0, 0xb150, 0x3110, 0xabd6,
+    0x3291, 0xae23, 0xa434, 0xaf09, 0x2c74, 0xb280, 0x361a, 0x2bd8, 0xaca3, 0x31f0, 0x3421, 0xb11a,
+    0xb198, 0x32e4, 0xab22, 0xb1d6, 0x2e75, 0xae01, 0x2944, 0x2b29, 0x2af2, 0xac33, 0x31f5, 0x302f,
+    0xa775, 0x340a, 0x3168, 0xae57, 0x1c68, 0x29d1, 0xadb7, 0x2f96, 0x2d31, 0xb366, 0xa1d0, 0xa144,
+    0xa236, 0xb33e, 0x2902, 0x29a7, 0x249a, 0xb0f6, 0xaa15, 0xac81, 0x1478, 0xa0c8, 0x2ba5, 0x2c62,
+    0x949a, 0xa349, 0xb206, 0xb20c, 0x3038, 0xafad, 0x313a, 0xac3a, 0x2b52, 0xb0c7, 0x1c01, 0xb4a6,
+    0x2f18, 0x2c08, 0x26fa, 0x2a6c, 0x2eb1, 0xafb3, 0xa0e7, 0x2727, 0xb08d, 0xb12e, 0xb04c, 0x324e,
+    0xb105, 0xaa4e, 0xae89, 0xb1a7, 0xacc1, 0x21a9, 0xb0f7, 0x2551, 0xa854, 0xb439, 0xb57d, 0xb10b,
+    0x295c, 0xb2b9, 0x2c34, 0x2cd5, 0xa1c0, 0xb46c, 0xb04d, 0xb1d3, 0x2c5e, 0x2b6c, 0x306d, 0xb025,
+    0x308a, 0xa9ac, 0xb158, 0x1d13, 0x31bb, 0xad6d, 0x305e, 0x3184, 0xafb3, 0xb081, 0x300d, 0xb098,
+    0xa96b, 0x2b1a, 0x28fb, 0xafe6, 0x2c4e, 0xa938, 0xb030, 0xb4bc, 0x2c32, 0xb4cb, 0x30fb, 0x1e58,
+    0xb1a5, 0xad70, 0xaf9a, 0xa731, 0x3113, 0x2c81, 0xa03d, 0x2c75, 0xb12d, 0xae1a, 0xa991, 0xae8a,
+    0x2a70, 0xb473, 0x3532, 0x2f4a, 0x18f7, 0x2ff7, 0x2c68, 0xb40c, 0xaf21, 0x318b, 0xb086, 0x2b5f,
+    0x2d65, 0xb0f0, 0xa8aa, 0x316b, 0x1e5d, 0xad9d, 0x2fac, 0xaab3, 0x9658, 0xa94b, 0xa443, 0xb13d,
+    0x2716, 0x25d9, 0x3032, 0xac62, 0xae28, 0xae42, 0xb2a0, 0xb0c1, 0x2cad, 0xb22e, 0x32b0, 0x299e,
+    0x2338, 0x9fba, 0x175a, 0xb204, 0x2848, 0x2dbc, 0x2b6b, 0xacdd, 0x2e65, 0xac01, 0xb16b, 0x2fd0,
+    0xa8ad, 0xaf87, 0x2f54, 0xa639, 0x1bbb, 0xadcd, 0x2690, 0xac3c, 0xa998, 0xa9a1, 0xa06c, 0x71f,
+    0x27ab, 0xaf00, 0xb206, 0xaf3b, 0x263d, 0xb0d8, 0xae5a, 0xa8ad, 0x2158, 0x9c59, 0xb1ab, 0xa001,
+    0x239e, 0xa4a1, 0x2d70, 0x234e, 0x1e6e, 0xb0eb, 0xb34b, 0xa454, 0x9a38, 0xb668, 0x3356, 0x347d,
+    0xb43c, 0x2eaa, 0xb1f6, 0xa7dc, 0x24b0, 0xb127, 0x2c3e, 0xa6e4, 0xace2, 0xb481, 0xb1fd, 0x2e3f,
+    0xa7b3, 0xb44b, 0x31df, 0x2cbc, 0x2501, 0xaa7a, 0xac25, 0xaecf, 0x9cce, 0x2b74, 0x9b4a, 0x2c7a,
+    0x2d1d, 0x2d64, 0x152e, 0xac3b, 0x3025, 0xb0d9, 0x3076, 0xb0d6, 0x28f1, 0x31b2, 0x277b, 0xb06b,
+    0x253a, 0x2e87, 0x3257, 0xb17c, 0x2afd, 0xa766, 0xb1ce, 0xa880, 0x2e35, 0xa7c8, 0x29e3, 0x2436,
+    0x237b, 0xb342, 0x9c23, 0xb082, 0x2cc8, 0x29f5, 0x320a, 0xa847, 0x2bf3, 0xacb6, 0xb0da, 0xab68,
+    0x2802, 0xb281, 0x3363, 0x2c7a, 0xa3e6, 0x2151, 0x2ae6, 0xb3fc, 0xb037, 0x2d42, 0xace0, 0xb188,
+    0x2afe, 0xaf64, 0xad03, 0x2cd7, 0x2fe2, 0xb1a2, 0x2c5d, 0x2d48, 0xaa0f, 0xab69, 0xa82d, 0xb0f1,
+    0xa40e, 0x2a4d, 0x30ee, 0xb00d, 0x271f, 0x2960, 0xb0b8, 0x28e3, 0x31d2, 0xb2c0, 0x2fb9, 0x2cf9,
+    0xacbe, 0x2b93, 0xa308, 0xb1a4, 0x312b, 0x158f, 0xada0, 0x347a, 0x26e2, 0xb246, 0xa1ab, 0x3025,
+    0x2e13, 0xad0b, 0x310a, 0xae0c, 0x29c7, 0xac7b, 0x2c06, 0xb47d, 0x311e, 0x20cb, 0xae78, 0x285c,
+    0x1fbb, 0xb08b, 0xaf14, 0x1b58,
+};
+
+#endif
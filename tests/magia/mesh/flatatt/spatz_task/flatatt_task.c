@@ -0,0 +1,293 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tile.h"
+#include "flatatt_params.h"
+
+/**
+ * Online-softmax primitives of the FlatAttention test, offloaded to Spatz.
+ * The exponentials use the bit-level approximation (Schraudolph 1999) of the onnx_softmax task:
+ *      exp(x) ~ reinterpret_fp16(COEF * x + BIAS)
+ * with COEF = 2^10 / ln(2) and BIAS = 15 * 2^10. All the arguments are <= 0 here, as they are
+ * differences with a running maximum.
+ */
+#define FASTEXP_COEF (1486.0f)
+#define FASTEXP_BIAS (15360.0f)
+
+static inline _Float16 row_max(const _Float16 *src, size_t len)
+{
+    const _Float16 *p_src;
+    _Float16 max;
+
+    size_t avl;
+    size_t vl;
+
+    max   = src[0];
+    p_src = src;
+    avl   = len;
+
+    asm volatile("vsetvli %0, %1, e16, m8, ta, ma" : "=r"(vl) : "r"(avl));
+    asm volatile("vfmv.s.f v0, %0" ::"f"(max));
+    asm volatile("vfmv.v.f v8, %0" ::"f"(max));
+
+    /* Tail-undisturbed: on the last, shorter strip the lanes past vl keep their partial maxes */
+    for (; avl > 0; avl -= vl) {
+        asm volatile("vsetvli %0, %1, e16, m8, tu, ma" : "=r"(vl) : "r"(avl));
+        asm volatile("vle16.v v16, (%0)" ::"r"(p_src));
+        asm volatile("vfmax.vv v8, v16, v8");
+
+        p_src += vl;
+    }
+
+    asm volatile("vsetvli %0, %1, e16, m8, ta, ma" : "=r"(vl) : "r"(len));
+    asm volatile("vfredmax.vs v0, v8, v0");
+    asm volatile("vfmv.f.s %0, v0" : "=f"(max));
+
+    return max;
+}
+
+/**
+ * row = exp(row - max) in place, returns the sum of the exponentials.
+ */
+static inline _Float16 row_exp_sum(_Float16 *row, size_t len, _Float16 max)
+{
+    register _Float16 COEF asm("f10")  = FASTEXP_COEF;
+    register _Float16 BIAS asm("f11")  = FASTEXP_BIAS;
+    register _Float16 ZERO_f asm("f2") = 0.0f;
+
+    _Float16 *p_row;
+    _Float16 sum;
+
+    size_t avl;
+    size_t vl;
+
+    p_row = row;
+    avl   = len;
+
+    asm volatile("vsetvli %0, %1, e16, m8, ta, ma" : "=r"(vl) : "r"(avl));
+    asm volatile("vfmv.v.f v0, %0" ::"f"(ZERO_f));
+    asm volatile("vfmv.v.f v8, %0" ::"f"(ZERO_f));
+
+    /* Tail-undisturbed: on the last, shorter strip the lanes past vl keep their partial sums */
+    for (; avl > 0; avl -= vl) {
+        asm volatile("vsetvli %0, %1, e16, m8, tu, ma" : "=r"(vl) : "r"(avl));
+        asm volatile("vle16.v v16, (%0)" ::"r"(p_row));
+        asm volatile("vfsub.vf v16, v16, %0" ::"f"(max));
+        asm volatile("vfmul.vf v16, v16, %0" ::"f"(COEF));
+        asm volatile("vfadd.vf v16, v16, %0" ::"f"(BIAS));
+        asm volatile("vfcvt.rtz.xu.f.v v16, v16");
+        asm volatile("vse16.v v16, (%0)" ::"r"(p_row));
+        asm volatile("vfadd.vv v0, v0, v16");
+
+        p_row += vl;
+    }
+
+    asm volatile("vsetvli %0, %1, e16, m8, ta, ma" : "=r"(vl) : "r"(len));
+    asm volatile("vfredusum.vs v8, v0, v8");
+    asm volatile("vfmv.f.s %0, v8" : "=f"(sum));
+
+    return sum;
+}
+
+/**
+ * dst = exp(a - b), element-wise.
+ */
+static inline void vec_exp_diff(_Float16 *dst, const _Float16 *a, const _Float16 *b, size_t len)
+{
+    register _Float16 COEF asm("f10") = FASTEXP_COEF;
+    register _Float16 BIAS asm("f11") = FASTEXP_BIAS;
+
+    size_t avl;
+    size_t vl;
+
+    for (avl = len; avl > 0; avl -= vl) {
+        asm volatile("vsetvli %0, %1, e16, m8, ta, ma" : "=r"(vl) : "r"(avl));
+        asm volatile("vle16.v v0, (%0)" ::"r"(a));
+        asm volatile("vle16.v v8, (%0)" ::"r"(b));
+        asm volatile("vfsub.vv v0, v0, v8");
+        asm volatile("vfmul.vf v0, v0, %0" ::"f"(COEF));
+        asm volatile("vfadd.vf v0, v0, %0" ::"f"(BIAS));
+        asm volatile("vfcvt.rtz.xu.f.v v0, v0");
+        asm volatile("vse16.v v0, (%0)" ::"r"(dst));
+
+        a += vl;
+        b += vl;
+        dst += vl;
+    }
+}
+
+/**
+ * dst = dst * src, element-wise.
+ */
+static inline void vec_mul(_Float16 *dst, const _Float16 *src, size_t len)
+{
+    size_t avl;
+    size_t vl;
+
+    for (avl = len; avl > 0; avl -= vl) {
+        asm volatile("vsetvli %0, %1, e16, m8, ta, ma" : "=r"(vl) : "r"(avl));
+        asm volatile("vle16.v v0, (%0)" ::"r"(dst));
+        asm volatile("vle16.v v8, (%0)" ::"r"(src));
+        asm volatile("vfmul.vv v0, v0, v8");
+        asm volatile("vse16.v v0, (%0)" ::"r"(dst));
+
+        src += vl;
+        dst += vl;
+    }
+}
+
+/**
+ * dst = dst + src, element-wise.
+ */
+static inline void vec_add(_Float16 *dst, const _Float16 *src, size_t len)
+{
+    size_t avl;
+    size_t vl;
+
+    for (avl = len; avl > 0; avl -= vl) {
+        asm volatile("vsetvli %0, %1, e16, m8, ta, ma" : "=r"(vl) : "r"(avl));
+        asm volatile("vle16.v v0, (%0)" ::"r"(dst));
+        asm volatile("vle16.v v8, (%0)" ::"r"(src));
+        asm volatile("vfadd.vv v0, v0, v8");
+        asm volatile("vse16.v v0, (%0)" ::"r"(dst));
+
+        src += vl;
+        dst += vl;
+    }
+}
+
+/**
+ * row = beta * row (+ alpha * prev), then divided by `sum` if `sum` is not zero.
+ */
+static inline void row_update(_Float16 *row,
+                              const _Float16 *prev,
+                              size_t len,
+                              _Float16 beta,
+                              _Float16 alpha,
+                              _Float16 sum)
+{
+    size_t avl;
+    size_t vl;
+
+    for (avl = len; avl > 0; avl -= vl) {
+        asm volatile("vsetvli %0, %1, e16, m8, ta, ma" : "=r"(vl) : "r"(avl));
+        asm volatile("vle16.v v0, (%0)" ::"r"(row));
+        asm volatile("vfmul.vf v0, v0, %0" ::"f"(beta));
+        if (prev) {
+            asm volatile("vle16.v v8, (%0)" ::"r"(prev));
+            asm volatile("vfmacc.vf v0, %0, v8" ::"f"(alpha));
+            prev += vl;
+        }
+        if (sum != 0)
+            asm volatile("vfdiv.vf v0, v0, %0" ::"f"(sum));
+        asm volatile("vse16.v v0, (%0)" ::"r"(row));
+
+        row += vl;
+    }
+}
+
+/**
+ * Fused pass over the score tile S_j: for each row, its max m_loc, P = exp(S - m_loc) in place
+ * and l = rowsum(P). m_loc is also copied in the running max buffer, where the mesh-row
+ * exchange of the CV32 turns it into m_j.
+ */
+int flatatt_softmax_task(void)
+{
+    volatile flatatt_params_t *params;
+    _Float16 *s;
+    _Float16 *m_loc;
+    _Float16 *m;
+    _Float16 *l;
+    uint32_t rows;
+    uint32_t cols;
+
+    params = (volatile flatatt_params_t *)mmio32(SPATZ_DATA);
+
+    s     = (_Float16 *)params->addr_s;
+    m_loc = (_Float16 *)params->addr_m_loc;
+    m     = (_Float16 *)params->addr_m;
+    l     = (_Float16 *)params->addr_l;
+    rows  = params->rows;
+    cols  = params->cols;
+
+    for (uint32_t r = 0; r < rows; r++) {
+        _Float16 max = row_max(s, cols);
+
+        m_loc[r] = max;
+        m[r]     = max;
+        l[r]     = row_exp_sum(s, cols, max);
+        s += cols;
+    }
+
+    return 0;
+}
+
+/**
+ * Once m_j is known: beta = exp(m_loc - m_j) and l *= beta, plus, past the first block,
+ * alpha = exp(m_j-1 - m_j) (in the m_j-1 buffer) and l_prev *= alpha.
+ */
+int flatatt_rescale_task(void)
+{
+    volatile flatatt_params_t *params;
+    _Float16 *m;
+    _Float16 *m_prev;
+    _Float16 *beta;
+    uint32_t rows;
+
+    params = (volatile flatatt_params_t *)mmio32(SPATZ_DATA);
+
+    m      = (_Float16 *)params->addr_m;
+    m_prev = (_Float16 *)params->addr_m_prev;
+    beta   = (_Float16 *)params->addr_beta;
+    rows   = params->rows;
+
+    vec_exp_diff(beta, (_Float16 *)params->addr_m_loc, m, rows);
+    vec_mul((_Float16 *)params->addr_l, beta, rows);
+    if (!params->first) {
+        vec_exp_diff(m_prev, m_prev, m, rows);
+        vec_mul((_Float16 *)params->addr_l_prev, m_prev, rows);
+    }
+
+    return 0;
+}
+
+/**
+ * Once l holds the row sums of the whole mesh row: l += l_prev and
+ * O = beta * (P_j * V_j) + alpha * O_prev, normalized by l on the last block.
+ */
+int flatatt_output_task(void)
+{
+    volatile flatatt_params_t *params;
+    _Float16 *o;
+    _Float16 *o_prev;
+    _Float16 *alpha;
+    _Float16 *beta;
+    _Float16 *l;
+    uint32_t rows;
+    uint32_t d;
+    uint32_t last;
+
+    params = (volatile flatatt_params_t *)mmio32(SPATZ_DATA);
+
+    o      = (_Float16 *)params->addr_o;
+    o_prev = params->first ? NULL : (_Float16 *)params->addr_o_prev;
+    alpha  = (_Float16 *)params->addr_m_prev;
+    beta   = (_Float16 *)params->addr_beta;
+    l      = (_Float16 *)params->addr_l;
+    rows   = params->rows;
+    d      = params->d;
+    last   = params->last;
+
+    if (o_prev)
+        vec_add(l, (_Float16 *)params->addr_l_prev, rows);
+
+    for (uint32_t r = 0; r < rows; r++) {
+        row_update(o, o_prev, d, beta[r], o_prev ? alpha[r] : 0, last ? l[r] : 0);
+        o += d;
+        if (o_prev)
+            o_prev += d;
+    }
+
+    return 0;
+}
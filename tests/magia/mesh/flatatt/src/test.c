@@ -11,16 +11,83 @@
 #include "fsync.h"
 #include "idma.h"
 #include "redmule.h"
+#include "utils/attention_utils.h"
+
+/**
+ * FLATATT_SPATZ == 1 offloads the online softmax to Spatz (see spatz_task/flatatt_task.c), which
+ * works on the scores of block j while RedMulE computes the ones of block j+1.
+ */
+#ifndef FLATATT_SPATZ
+#define FLATATT_SPATZ 0
+#endif
+
+#if FLATATT_SPATZ
+#include "eventunit.h"
+#include "flatatt_params.h"
+#include "test_flatatt_task_bin.h"
+#endif
 
 /**
  * Flush
  */
-int flush(uint32_t o, uint32_t dim)
+void flush(uint32_t o, uint32_t dim)
 {
     for (uint32_t i = 0; i < dim; i++)
         mmio16(o + i * 2) = 0x0000;
 }
 
+#if FLATATT_SPATZ
+/**
+ * Start the scores S = Q * Kt of a block on RedMulE, one timestep at a time, and return without
+ * waiting for the last job. The Q and K buffers can be reused once that job has completed.
+ */
+redmule_job_t flatatt_scores(idma_controller_t *idma_ctrl,
+                             redmule_controller_t *redmule_ctrl,
+                             uint32_t axi_addr_q,
+                             uint32_t axi_addr_k,
+                             uint32_t obi_addr_q,
+                             uint32_t obi_addr_k,
+                             uint32_t obi_addr_s,
+                             uint32_t tile_h,
+                             uint32_t tile_w,
+                             uint32_t t_size,
+                             uint32_t n_timesteps)
+{
+    redmule_job_t job = -1;
+
+    flush(obi_addr_s, tile_h * tile_w);
+    for (uint32_t k = 0; k < n_timesteps; k++) {
+        if (job >= 0)
+            redmule_wait_job(redmule_ctrl, job);
+        idma_wait(idma_ctrl,
+                  idma_memcpy_2d_async(idma_ctrl,
+                                       0,
+                                       axi_addr_q + (k * t_size * 2),
+                                       obi_addr_q,
+                                       t_size * 2,
+                                       D_SIZE * 2,
+                                       tile_h));
+        idma_wait(idma_ctrl,
+                  idma_memcpy_2d_async(idma_ctrl,
+                                       0,
+                                       axi_addr_k + (k * t_size * S_SIZE * 2),
+                                       obi_addr_k,
+                                       tile_w * 2,
+                                       S_SIZE * 2,
+                                       t_size));
+        job = redmule_gemm_async(redmule_ctrl,
+                                 obi_addr_q,
+                                 obi_addr_k,
+                                 obi_addr_s,
+                                 (uint16_t)tile_h,
+                                 (uint16_t)t_size,
+                                 (uint16_t)tile_w);
+    }
+
+    return job;
+}
+#endif
+
 /**
  * This test aims to verify the functionality of MAGIA as a tile group for the FlatAttention
  * algorithm.
@@ -63,11 +130,10 @@ int main(void)
     uint32_t l1_tile_base = get_l1_base(hartid);
 
     /**
-     * 1a. Set arbitrary B value, dimension of the square block to be computed by the mesh at each
-     * cycle Calculate number of blocks, and dimension of the leftover block
+     * 1a. B_SIZE (see test.h) is the dimension of the square block to be computed by the mesh at
+     * each cycle. Calculate number of blocks, and dimension of the leftover block
      */
-    uint32_t B_SIZE = S_SIZE;
-    uint32_t T      = S_SIZE / B_SIZE;
+    uint32_t T = S_SIZE / B_SIZE;
 
     /**
      * 1b. Set arbitrary timestep value to further divide the Q and K tiles in subtiles.
@@ -144,6 +210,245 @@ int main(void)
     uint32_t reps_v     = (uint32_t)tile_w;
     uint32_t axi_addr_v = (uint32_t)v_inp + (x_id * tile_w_max * D_SIZE * 2);
 
+#if FLATATT_SPATZ
+    /**
+     * 2. Cycle over the blocks, with the online softmax offloaded to Spatz.
+     * The scores of each block are computed with the local row maxes (m_loc) and rescaled by
+     * beta = exp(m_loc - m_j) once the mesh row has agreed on the running maxes m_j, so that
+     * Spatz can start on them right away while RedMulE computes the scores of the next block.
+     */
+    uint32_t obi_addr_s1     = obi_addr_sb + (tile_h * t_size * 2);
+    uint32_t obi_addr_m_loc  = obi_addr_s1 + (tile_h * tile_w * 2);
+    uint32_t obi_addr_beta   = obi_addr_m_loc + (tile_h * 2);
+    uint32_t obi_addr_params = (obi_addr_beta + (tile_h * 2) + 3) & ~3;
+    uint32_t score_buffer;
+    redmule_job_t job;
+
+    volatile flatatt_params_t *params = (volatile flatatt_params_t *)obi_addr_params;
+
+    eu_config_t eu_cfg      = {.hartid = hartid};
+    eu_controller_t eu_ctrl = {
+        .base = NULL,
+        .cfg  = &eu_cfg,
+        .api  = &eu_api,
+    };
+
+    eu_init(&eu_ctrl);
+    eu_redmule_init(&eu_ctrl, 0);
+    eu_idma_init(&eu_ctrl, 0);
+    eu_spatz_init(&eu_ctrl, 0);
+    spatz_init(SPATZ_BINARY_START);
+
+    params->addr_m_loc = obi_addr_m_loc;
+    params->addr_beta  = obi_addr_beta;
+    params->rows       = (uint32_t)tile_h;
+    params->cols       = (uint32_t)tile_w;
+    params->d          = D_SIZE;
+
+    for (uint8_t i = 0; i < T; i++) {
+        uint32_t axi_addr_qi = axi_addr_q + (i * B_SIZE * D_SIZE * 2);
+
+        /**
+         * 2a. Flush the output buffers, and start the scores of the first block
+         */
+        flush(obi_addr_o_0, tile_h * D_SIZE);
+        flush(obi_addr_o_1, tile_h * D_SIZE);
+
+        job = flatatt_scores(&idma_ctrl,
+                             &redmule_ctrl,
+                             axi_addr_qi,
+                             axi_addr_k,
+                             obi_addr_q,
+                             obi_addr_k,
+                             obi_addr_s,
+                             tile_h,
+                             tile_w,
+                             t_size,
+                             n_timesteps);
+
+        /**
+         * 3. Cycle over the blocks columns of the attention map
+         */
+        for (uint8_t j = 0; j < T; j++) {
+            /**
+             * 3a. Set which buffers we are using, and which ones refers to the previous block.
+             */
+            if (j % 2) {
+                max_buffer         = obi_addr_m_1;
+                prev_max_buffer    = obi_addr_m_0;
+                sum_buffer         = obi_addr_l_1;
+                prev_sum_buffer    = obi_addr_l_0;
+                output_buffer      = obi_addr_o_1;
+                prev_output_buffer = obi_addr_o_0;
+                score_buffer       = obi_addr_s1;
+            } else {
+                max_buffer         = obi_addr_m_0;
+                prev_max_buffer    = obi_addr_m_1;
+                sum_buffer         = obi_addr_l_0;
+                prev_sum_buffer    = obi_addr_l_1;
+                output_buffer      = obi_addr_o_0;
+                prev_output_buffer = obi_addr_o_1;
+                score_buffer       = obi_addr_s;
+            }
+
+            params->addr_s      = score_buffer;
+            params->addr_m      = max_buffer;
+            params->addr_m_prev = prev_max_buffer;
+            params->addr_l      = sum_buffer;
+            params->addr_l_prev = prev_sum_buffer;
+            params->addr_o      = output_buffer;
+            params->addr_o_prev = prev_output_buffer;
+            params->first       = (j == 0);
+            params->last        = (j == T - 1);
+
+            /**
+             * 3b. Once the scores are there, Spatz takes their row maxes, exponentials and row
+             * sums in a single pass, while RedMulE goes on with the scores of the next block in
+             * the other score buffer.
+             */
+            redmule_wait_job(&redmule_ctrl, job);
+            spatz_run_task_with_params(FLATATT_SOFTMAX_TASK, (uint32_t)params);
+            if (j + 1 < T)
+                job = flatatt_scores(&idma_ctrl,
+                                     &redmule_ctrl,
+                                     axi_addr_qi,
+                                     axi_addr_k + ((j + 1) * B_SIZE * 2),
+                                     obi_addr_q,
+                                     obi_addr_k,
+                                     (j % 2) ? obi_addr_s : obi_addr_s1,
+                                     tile_h,
+                                     tile_w,
+                                     t_size,
+                                     n_timesteps);
+            eu_spatz_wait(&eu_ctrl, WFE);
+
+            /**
+             * 3c. Find the running row maxes, as in the scalar path, starting from the local
+             * maxes left by Spatz in the max buffer.
+             */
+            if (x_id != 0) {
+                fsync_sync_left(&fsync_ctrl);
+                if (j % 2)
+                    max_compare(max_buffer, get_l1_base(hartid - 1) + (tile_h * 2), tile_h);
+                else
+                    max_compare(max_buffer, get_l1_base(hartid - 1), tile_h);
+            }
+            if (x_id != (MESH_X_TILES - 1))
+                fsync_sync_right(&fsync_ctrl);
+            else if (j > 0)
+                max_compare(max_buffer, prev_max_buffer, tile_h);
+            fsync_sync_row(&fsync_ctrl);
+            if (x_id != (MESH_X_TILES - 1)) {
+                if (j % 2)
+                    max_compare(max_buffer,
+                                get_l1_base(GET_ID(y_id, (MESH_X_TILES - 1))) + (tile_h * 2),
+                                tile_h);
+                else
+                    max_compare(max_buffer, get_l1_base(GET_ID(y_id, (MESH_X_TILES - 1))), tile_h);
+            }
+            fsync_sync_row(&fsync_ctrl);
+
+            /**
+             * 3d. Rescale the local row sums by beta and, past the first block, the previous
+             * running sums by alpha = exp(m_j-1 - m_j).
+             */
+            spatz_run_task_with_params(FLATATT_RESCALE_TASK, (uint32_t)params);
+            eu_spatz_wait(&eu_ctrl, WFE);
+
+            /**
+             * 3e. Row wise summation across the mesh row, as in the scalar path.
+             */
+            if (x_id != 0) {
+                fsync_sync_left(&fsync_ctrl);
+                if (j % 2)
+                    vect_sum(sum_buffer, get_l1_base(hartid - 1) + (tile_h * 6), tile_h);
+                else
+                    vect_sum(sum_buffer, get_l1_base(hartid - 1) + (tile_h * 4), tile_h);
+            }
+            if (x_id != (MESH_X_TILES - 1))
+                fsync_sync_right(&fsync_ctrl);
+            fsync_sync_row(&fsync_ctrl);
+            if (x_id != (MESH_X_TILES - 1)) {
+                idma_wait(&idma_ctrl,
+                          idma_memcpy_1d_async(&idma_ctrl,
+                                               0,
+                                               get_l1_base(GET_ID(y_id, (MESH_X_TILES - 1))) +
+                                                   (tile_h * ((j % 2) ? 6 : 4)),
+                                               sum_buffer,
+                                               tile_h * 2));
+            }
+            fsync_sync_row(&fsync_ctrl);
+
+            /**
+             * 3f. Input static Activation * V, queued on RedMulE behind the next scores
+             */
+            for (uint32_t k = 0; k < n_timesteps; k++) {
+                idma_wait(&idma_ctrl,
+                          idma_memcpy_2d_async(&idma_ctrl,
+                                               0,
+                                               axi_addr_v + (j * B_SIZE * D_SIZE * 2) +
+                                                   (k * t_size * 2),
+                                               obi_addr_v,
+                                               len_v,
+                                               std_v,
+                                               reps_v));
+                flush(obi_addr_sb, tile_h * t_size);
+                redmule_wait_job(&redmule_ctrl,
+                                 redmule_gemm_async(&redmule_ctrl,
+                                                    score_buffer,
+                                                    obi_addr_v,
+                                                    obi_addr_sb,
+                                                    (uint16_t)tile_h,
+                                                    (uint16_t)tile_w,
+                                                    (uint16_t)t_size));
+                idma_wait(&idma_ctrl,
+                          idma_memcpy_2d_async(&idma_ctrl,
+                                               0,
+                                               obi_addr_sb,
+                                               output_buffer + (k * t_size * 2),
+                                               t_size * 2,
+                                               D_SIZE * 2,
+                                               tile_h));
+            }
+
+            /**
+             * 3g. O = beta * (P * V) + alpha * O_prev, normalized by the row sums on the last
+             * block.
+             */
+            spatz_run_task_with_params(FLATATT_OUTPUT_TASK, (uint32_t)params);
+            eu_spatz_wait(&eu_ctrl, WFE);
+        }
+
+        /**
+         * 4. Propagate and sum all the output buffers in a systolic way
+         */
+        if (x_id != 0) {
+            fsync_sync_left(&fsync_ctrl);
+            if (T % 2)
+                vect_sum(output_buffer, get_l1_base(hartid - 1) + (8 * tile_h), tile_h * D_SIZE);
+            else
+                vect_sum(output_buffer,
+                         get_l1_base(hartid - 1) + (8 * tile_h + 2 * D_SIZE * tile_h),
+                         tile_h * D_SIZE);
+        }
+        if (x_id != (MESH_X_TILES - 1))
+            fsync_sync_right(&fsync_ctrl);
+        else {
+            idma_wait(&idma_ctrl,
+                      idma_memcpy_2d_async(&idma_ctrl,
+                                           1,
+                                           (uint32_t)o_out +
+                                               ((i * B_SIZE + y_id * tile_h_max) * D_SIZE * 2),
+                                           output_buffer,
+                                           D_SIZE * 2,
+                                           D_SIZE * 2,
+                                           tile_h));
+        }
+        fsync_sync_row(&fsync_ctrl);
+    }
+
+    spatz_clk_dis();
+#else
     /**
      * 2. Cycle over the blocks.
      *      i-cycle -> cycle over the blocks rows of the attention map
@@ -156,7 +461,7 @@ int main(void)
         flush(obi_addr_o_0, tile_h * D_SIZE);
         flush(obi_addr_o_1, tile_h * D_SIZE);
 
-        axi_addr_q = axi_addr_q + (i * B_SIZE * D_SIZE * 2);
+        uint32_t axi_addr_qi = axi_addr_q + (i * B_SIZE * D_SIZE * 2);
 
         /**
          * 3. Cycle over the blocks columns of the attention map
@@ -182,41 +487,43 @@ int main(void)
             }
 
             /**
-             * 3b. Output static matmul Q * Kt
+             * 3b. Output static matmul Q * Kt, accumulated over the timesteps
              */
-            for (uint32_t k = 0; k < t_size; k++) {
+            flush(obi_addr_s, tile_h * tile_w);
+            for (uint32_t k = 0; k < n_timesteps; k++) {
                 /**
                  * 3ba. IDMA to load the input and weight data-tile for current timeslot
                  */
-                idma_memcpy_2d(&idma_ctrl,
-                               0,
-                               (axi_addr_q + (t_size * k * 2)),
-                               obi_addr_q,
-                               len_q,
-                               std_q,
-                               reps_q);
-                idma_wait();
-                idma_memcpy_2d(&idma_ctrl,
-                               0,
-                               (axi_addr_k + (j * B_SIZE * 2) + (t_size * S_SIZE * i * 2)),
-                               obi_addr_k,
-                               len_k,
-                               std_k,
-                               reps_k);
-                idma_wait();
+                idma_wait(&idma_ctrl,
+                          idma_memcpy_2d_async(&idma_ctrl,
+                                               0,
+                                               (axi_addr_qi + (t_size * k * 2)),
+                                               obi_addr_q,
+                                               len_q,
+                                               std_q,
+                                               reps_q));
+                idma_wait(&idma_ctrl,
+                          idma_memcpy_2d_async(&idma_ctrl,
+                                               0,
+                                               (axi_addr_k + (j * B_SIZE * 2) +
+                                                (t_size * S_SIZE * k * 2)),
+                                               obi_addr_k,
+                                               len_k,
+                                               std_k,
+                                               reps_k));
 
                 /**
                  * 3bb. Evoke the RED MULE
                  * https://www.youtube.com/watch?v=RG-bRbBuaBI&list=PLTLXyHxNV4azQtL26W-7l6fTrOa3rJgLo&index=35
                  */
-                redmule_gemm(&redmule_ctrl,
-                             obi_addr_q,
-                             obi_addr_k,
-                             obi_addr_s,
-                             (uint16_t)tile_h,
-                             (uint16_t)t_size,
-                             (uint16_t)tile_w);
-                redmule_wait();
+                redmule_wait_job(&redmule_ctrl,
+                                 redmule_gemm_async(&redmule_ctrl,
+                                                    obi_addr_q,
+                                                    obi_addr_k,
+                                                    obi_addr_s,
+                                                    (uint16_t)tile_h,
+                                                    (uint16_t)t_size,
+                                                    (uint16_t)tile_w));
             }
 
             /**
@@ -275,19 +582,13 @@ int main(void)
                 fsync_sync_right(&fsync_ctrl);
             fsync_sync_row(&fsync_ctrl);
             if (x_id != (MESH_X_TILES - 1)) {
-                if (j % 2)
-                    idma_memcpy_1d(&idma_ctrl,
-                                   0,
-                                   get_l1_base(GET_ID(y_id, (MESH_X_TILES - 1))) + (tile_h * 6),
-                                   sum_buffer,
-                                   tile_h * 2);
-                else
-                    idma_memcpy_1d(&idma_ctrl,
-                                   0,
-                                   get_l1_base(GET_ID(y_id, (MESH_X_TILES - 1))) + (tile_h * 4),
-                                   sum_buffer,
-                                   tile_h * 2);
-                idma_wait();
+                idma_wait(&idma_ctrl,
+                          idma_memcpy_1d_async(&idma_ctrl,
+                                               0,
+                                               get_l1_base(GET_ID(y_id, (MESH_X_TILES - 1))) +
+                                                   (tile_h * ((j % 2) ? 6 : 4)),
+                                               sum_buffer,
+                                               tile_h * 2));
             }
             fsync_sync_row(&fsync_ctrl);
 
@@ -319,11 +620,10 @@ int main(void)
                 vect_sum(sum_buffer, prev_sum_buffer, tile_h);
 
                 /**
-                 * 3ge. Row-wise divide each row of the previous block's output by the exponential
-                 * of the difference between the current block rows' maxes and the previous block's
-                 * ones. (Sadly, I'm serious.)
+                 * 3ge. Row-wise multiply each row of the previous block's output by the same
+                 * exponential, exp(m_j-1 - m_j) <= 1, as the sums.
                  */
-                rowdiv(prev_output_buffer, prev_max_buffer, tile_h, D_SIZE);
+                rowmul(prev_output_buffer, prev_max_buffer, tile_h, D_SIZE);
             }
 
             /**
@@ -333,39 +633,41 @@ int main(void)
                 /**
                  * 3ha. Load V data-tile required for the j-th block column and k-th timestep
                  */
-                idma_memcpy_2d(&idma_ctrl,
-                               0,
-                               axi_addr_v + (j * B_SIZE * D_SIZE * 2) + (k * t_size * 2),
-                               obi_addr_v,
-                               len_v,
-                               std_v,
-                               reps_v);
-                idma_wait();
+                idma_wait(&idma_ctrl,
+                          idma_memcpy_2d_async(&idma_ctrl,
+                                               0,
+                                               axi_addr_v + (j * B_SIZE * D_SIZE * 2) +
+                                                   (k * t_size * 2),
+                                               obi_addr_v,
+                                               len_v,
+                                               std_v,
+                                               reps_v));
 
                 /**
                  * 3hb. Evoke REDMULE
                  * https://www.youtube.com/watch?v=xDbIDKel-O4
                  */
-                redmule_gemm(&redmule_ctrl,
-                             obi_addr_s,
-                             obi_addr_v,
-                             obi_addr_sb,
-                             (uint16_t)tile_h,
-                             (uint16_t)tile_w,
-                             (uint16_t)t_size);
-                redmule_wait();
+                flush(obi_addr_sb, tile_h * t_size);
+                redmule_wait_job(&redmule_ctrl,
+                                 redmule_gemm_async(&redmule_ctrl,
+                                                    obi_addr_s,
+                                                    obi_addr_v,
+                                                    obi_addr_sb,
+                                                    (uint16_t)tile_h,
+                                                    (uint16_t)tile_w,
+                                                    (uint16_t)t_size));
 
                 /**
                  * 3hc. Strided store of the current timestep buffer in the output
                  */
-                idma_memcpy_2d(&idma_ctrl,
-                               0,
-                               obi_addr_sb,
-                               output_buffer + (k * t_size * 2),
-                               t_size * 2,
-                               D_SIZE * 2,
-                               tile_h);
-                idma_wait();
+                idma_wait(&idma_ctrl,
+                          idma_memcpy_2d_async(&idma_ctrl,
+                                               0,
+                                               obi_addr_sb,
+                                               output_buffer + (k * t_size * 2),
+                                               t_size * 2,
+                                               D_SIZE * 2,
+                                               tile_h));
             }
 
             /**
@@ -389,17 +691,52 @@ int main(void)
                 vect_sum(output_buffer, get_l1_base(hartid - 1) + (8 * tile_h), tile_h * D_SIZE);
             else
                 vect_sum(output_buffer,
-                         get_l1_base(hartid - 1) + (8 * tile_h + D_SIZE * tile_h),
+                         get_l1_base(hartid - 1) + (8 * tile_h + 2 * D_SIZE * tile_h),
                          tile_h * D_SIZE);
         }
         if (x_id != (MESH_X_TILES - 1))
             fsync_sync_right(&fsync_ctrl);
         else {
-            idma_memcpy_2d(&idma_ctrl, 1, o_out, output_buffer, D_SIZE, D_SIZE, tile_h);
-            idma_wait();
+            idma_wait(&idma_ctrl,
+                      idma_memcpy_2d_async(&idma_ctrl,
+                                           1,
+                                           (uint32_t)o_out +
+                                               ((i * B_SIZE + y_id * tile_h_max) * D_SIZE * 2),
+                                           output_buffer,
+                                           D_SIZE * 2,
+                                           D_SIZE * 2,
+                                           tile_h));
         }
         fsync_sync_row(&fsync_ctrl);
     }
 
-    return 0;
+#endif
+
+    /**
+     * 6. The last tile of each mesh row checks the output rows it stored
+     */
+    uint32_t errors = 0;
+    if (x_id == (MESH_X_TILES - 1)) {
+        for (uint32_t r = 0; r < T * tile_h; r++) {
+            uint32_t i = (r / tile_h) * B_SIZE + y_id * tile_h_max + (r % tile_h);
+            for (uint32_t j = 0; j < D_SIZE; j++) {
+                float computed = (float)*(volatile _Float16 *)(o_out + (i * D_SIZE + j));
+                float expected = (float)*(volatile _Float16 *)(o_golden + (i * D_SIZE + j));
+                float diff     = (computed > expected) ? (computed - expected) : (expected - computed);
+                if (diff > O_TOL) {
+#if EVAL == 1
+                    printf("Error detected at coordinates[%d][%d]: O=%x golden=%x\n",
+                           i,
+                           j,
+                           *(volatile uint16_t *)(o_out + (i * D_SIZE + j)),
+                           *(volatile uint16_t *)(o_golden + (i * D_SIZE + j)));
+#endif
+                    errors++;
+                }
+            }
+        }
+        printf("Number of errors: %d\n", errors);
+    }
+
+    return errors;
 }
\ No newline at end of file
@@ -0,0 +1,17 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+
+#ifndef _TEST_FSYNC_SPLIT_INCLUDE_GUARD_
+#define _TEST_FSYNC_SPLIT_INCLUDE_GUARD_
+
+#define N_SCOPES (3)   // Global, row and column barriers
+#define N_ROUNDS (4)   // Barriers per scope
+#define N_WORK   (256) // Words of L1 the tile checksums between arrive and wait
+
+// Stamp of every tile in the current round of each scope, double-buffered on the round parity
+volatile uint32_t l2_stamp[N_SCOPES][2][NUM_HARTS];
+
+#endif //_TEST_FSYNC_SPLIT_INCLUDE_GUARD_
@@ -0,0 +1,134 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+
+#include <stdint.h>
+
+#include "tile.h"
+#include "fsync.h"
+#include "eventunit.h"
+
+#include "test.h"
+
+/* Barrier scopes of the test, see N_SCOPES */
+enum { SCOPE_GLOBAL = 0, SCOPE_ROW, SCOPE_COL };
+
+static inline uint32_t stamp(uint32_t scope, uint32_t round, uint32_t hartid)
+{
+    return (scope << 24) | (round << 16) | hartid;
+}
+
+/* 1 if tile t synchronizes with the current tile on the barrier of the scope */
+static inline int member(uint32_t scope, uint32_t hartid, uint32_t t)
+{
+    if (scope == SCOPE_ROW)
+        return GET_Y_ID(t) == GET_Y_ID(hartid);
+    if (scope == SCOPE_COL)
+        return GET_X_ID(t) == GET_X_ID(hartid);
+    return 1;
+}
+
+/**
+ * This test checks the split-phase barriers: every tile publishes a stamp in L2, arrives on the
+ * global, row or column barrier, checksums a buffer of its L1 while the barrier is in flight,
+ * then waits for it. Once the barrier is open, the stamps of all the tiles of the group must be
+ * the ones of the current round. Every scope has its own stamps, since the tiles of another row
+ * or column may already be ahead, double-buffered on the round parity: a tile can only publish
+ * the stamp of round r + 2 after every tile of its group arrived on r + 1.
+ */
+int main(void)
+{
+    uint32_t hartid = get_hartid();
+
+    fsync_config_t fsync_cfg      = {.hartid = hartid};
+    fsync_controller_t fsync_ctrl = {
+        .base = NULL,
+        .cfg  = &fsync_cfg,
+        .api  = &fsync_api,
+    };
+    fsync_init(&fsync_ctrl);
+
+#if STALLING == 0
+    eu_config_t eu_cfg      = {.hartid = hartid};
+    eu_controller_t eu_ctrl = {
+        .base = NULL,
+        .cfg  = &eu_cfg,
+        .api  = &eu_api,
+    };
+    eu_init(&eu_ctrl);
+    eu_fsync_init(&eu_ctrl, 0);
+#endif
+
+    uint32_t l1_tile_base = get_l1_base(hartid);
+    uint32_t errors       = 0;
+    uint32_t expected     = 0;
+
+    for (uint32_t i = 0; i < N_WORK; i++) {
+        mmio32(l1_tile_base + i * 4) = hartid + i;
+        expected += (hartid + i) * (i | 1);
+    }
+
+    for (uint32_t scope = SCOPE_GLOBAL; scope < N_SCOPES; scope++) {
+        uint32_t n_members = 0;
+        for (uint32_t t = 0; t < NUM_HARTS; t++)
+            n_members += member(scope, hartid, t);
+
+        for (uint32_t round = 0; round < N_ROUNDS; round++) {
+            volatile uint32_t *slot = l2_stamp[scope][round % 2];
+            fsync_token_t token;
+
+            /**
+             * 1. Publish the stamp of the round and arrive.
+             */
+            slot[hartid] = stamp(scope, round, hartid);
+            if (scope == SCOPE_GLOBAL)
+                token = fsync_arrive_global(&fsync_ctrl);
+            else if (scope == SCOPE_ROW)
+                token = fsync_arrive_row(&fsync_ctrl);
+            else
+                token = fsync_arrive_col(&fsync_ctrl);
+
+            if ((token == FSYNC_TOKEN_NONE) != (n_members == 1)) {
+                printf("[HARTID %d] ERROR: scope %d token %d with %d tiles\n",
+                       hartid,
+                       scope,
+                       token,
+                       n_members);
+                errors++;
+            }
+
+            /**
+             * 2. Work while the barrier is in flight.
+             */
+            uint32_t checksum = 0;
+            for (uint32_t i = 0; i < N_WORK; i++)
+                checksum += mmio32(l1_tile_base + i * 4) * (i | 1);
+            if (checksum != expected)
+                errors++;
+
+            /**
+             * 3. Wait for the barrier, then check the stamps of the group.
+             */
+            if (fsync_wait(&fsync_ctrl, token)) {
+                printf("[HARTID %d] ERROR: scope %d round %d timed out\n", hartid, scope, round);
+                errors++;
+            }
+            for (uint32_t t = 0; t < NUM_HARTS; t++) {
+                if (member(scope, hartid, t) && slot[t] != stamp(scope, round, t)) {
+                    printf("[HARTID %d] ERROR: scope %d round %d stamp of tile %d is %x\n",
+                           hartid,
+                           scope,
+                           round,
+                           t,
+                           slot[t]);
+                    errors++;
+                }
+            }
+        }
+    }
+
+    printf("Number of errors: %d\n", errors);
+    return errors;
+}
@@ -7,6 +7,8 @@
 #ifndef _TEST_FSYNC_SYNC_INCLUDE_GUARD_
 #define _TEST_FSYNC_SYNC_INCLUDE_GUARD_
 
+#define N_ROUNDS (8) // Rounds over the precompiled barrier
+
 int check_values(uint32_t *ids, uint8_t n_tiles);
 
 #endif //_TEST_FSYNC_SYNC_INCLUDE_GUARD_
\ No newline at end of file
@@ -105,9 +105,30 @@ int main(void)
             if (!check_values(ids, N_TILES))
                 printf("No errors detected for arbitrary sync!\n");
 
+            /**
+             * 2d. Repeat over a precompiled barrier, writing a different value at every round.
+             * The second barrier keeps the next value from landing before everybody checked.
+             */
+            fsync_barrier_t barrier = fsync_barrier_create(&fsync_ctrl, ids, N_TILES, dir, 0);
+            for (uint8_t round = 0; round < N_ROUNDS; round++) {
+                mmio8(l1_tile_base) = round;
+                fsync_barrier_wait(&fsync_ctrl, &barrier);
+#if STALLING == 0
+                eu_fsync_wait(&eu_ctrl, WAIT_MODE);
+#endif
+                if (check_values(ids, N_TILES))
+                    flag = 1;
+                fsync_barrier_wait(&fsync_ctrl, &barrier);
+#if STALLING == 0
+                eu_fsync_wait(&eu_ctrl, WAIT_MODE);
+#endif
+            }
+            if (!flag)
+                printf("No errors detected for the precompiled barrier!\n");
+
             break;
         }
     }
 
-    return 0;
+    return flag;
 }
\ No newline at end of file
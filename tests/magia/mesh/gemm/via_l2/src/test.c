@@ -7,10 +7,12 @@
 
 #include "tile.h"
 #include "utils/gemm_utils.h"
+#include "utils/vect_utils.h"
 #include "fsync.h"
 #include "idma.h"
 #include "redmule.h"
 #include "eventunit.h"
+#include "collectives.h"
 
 #define WAIT_MODE            WFE
 
@@ -63,8 +65,7 @@ void get_row_range(uint32_t local_idx,
 
 void mem_set_zero(uint32_t o, uint32_t dim)
 {
-    for (uint32_t i = 0; i < dim; i++)
-        mmio16(o + i * 2) = 0x0000;
+    vect_fill_f16(o, 0, dim);
 }
 
 /**
@@ -136,11 +137,14 @@ int main(void)
     eu_redmule_init(&eu_ctrl, 0);
 #endif
 
-    // Global barrier: ensure all tiles have completed startup (including BSS zeroing
-    // in crt0.S) before any tile begins writing results to L2 output buffers.
-    // Without this, slow tiles still zeroing BSS can overwrite Phase 1 results.
-    fsync_sync_level(&fsync_ctrl, MAX_SYNC_LVL - 1, 0);
-    eu_fsync_wait(&eu_ctrl, WAIT_MODE);
+    // The shared operand of each GEMM is read once from L2 and fanned out over its group
+    coll_ctx_t coll_ctx = {
+        .idma    = &idma_ctrl,
+        .fsync   = &fsync_ctrl,
+        .eu      = &eu_ctrl,
+        .algo    = COLL_TREE,
+        .scratch = 0,
+    };
 
     /**
      * Phase 1: GEMM1 and GEMM2 in parallel (row-parallel within each group)
@@ -152,23 +156,29 @@ int main(void)
         uint32_t start_row, num_rows;
         get_row_range(gemm1_idx, GEMM1_N_TILES, DIM_A, &start_row, &num_rows);
 
-        if (num_rows > 0) {
-            // L1 layout: M1_slice, M2, R1_slice
-            uint32_t obi_m1 = l1_tile_base;
-            uint32_t obi_m2 = obi_m1 + (num_rows * DIM_B * 2);
-            uint32_t obi_r1 = obi_m2 + (DIM_B * DIM_C * 2);
+        // L1 layout: M2, M1_slice, R1_slice. M2 is at the same offset on the whole group
+        uint32_t obi_m2 = l1_tile_base;
+        uint32_t obi_m1 = obi_m2 + (DIM_B * DIM_C * 2);
+        uint32_t obi_r1 = obi_m1 + (num_rows * DIM_B * 2);
+
+        // Fetch the slice of M1 [num_rows x B] while the group shares the full M2 [BxC]
+        idma_handle_t slice = IDMA_HANDLE_NONE;
+        if (num_rows > 0)
+            slice = idma_memcpy_1d_async(&idma_ctrl,
+                                         0,
+                                         (uint32_t)m1_inp + start_row * DIM_B * 2,
+                                         obi_m1,
+                                         num_rows * DIM_B * 2);
+        idma_multicast(&coll_ctx,
+                       gemm1_tiles,
+                       GEMM1_N_TILES,
+                       0,
+                       (uint32_t)m2_inp,
+                       obi_m2,
+                       DIM_B * DIM_C * 2);
 
-            // Load slice of M1 [num_rows x B] from L2
-            idma_memcpy_1d(&idma_ctrl,
-                           0,
-                           (uint32_t)m1_inp + start_row * DIM_B * 2,
-                           obi_m1,
-                           num_rows * DIM_B * 2);
-            eu_idma_wait_a2o(&eu_ctrl, WAIT_MODE);
-
-            // Load full M2 [BxC] from L2
-            idma_memcpy_1d(&idma_ctrl, 0, (uint32_t)m2_inp, obi_m2, DIM_B * DIM_C * 2);
-            eu_idma_wait_a2o(&eu_ctrl, WAIT_MODE);
+        if (num_rows > 0) {
+            idma_wait(&idma_ctrl, slice);
 
             // Zero accumulator and compute: R1_slice = M1_slice @ M2
             mem_set_zero(obi_r1, num_rows * DIM_C);
@@ -196,23 +206,29 @@ int main(void)
         uint32_t start_row, num_rows;
         get_row_range(gemm2_idx, GEMM2_N_TILES, DIM_C, &start_row, &num_rows);
 
-        if (num_rows > 0) {
-            // L1 layout: M3_slice, M4, R2_slice
-            uint32_t obi_m3 = l1_tile_base;
-            uint32_t obi_m4 = obi_m3 + (num_rows * DIM_D * 2);
-            uint32_t obi_r2 = obi_m4 + (DIM_D * DIM_E * 2);
-
-            // Load slice of M3 [num_rows x D] from L2
-            idma_memcpy_1d(&idma_ctrl,
-                           0,
-                           (uint32_t)m3_inp + start_row * DIM_D * 2,
-                           obi_m3,
-                           num_rows * DIM_D * 2);
-            eu_idma_wait_a2o(&eu_ctrl, WAIT_MODE);
+        // L1 layout: M4, M3_slice, R2_slice. M4 is at the same offset on the whole group
+        uint32_t obi_m4 = l1_tile_base;
+        uint32_t obi_m3 = obi_m4 + (DIM_D * DIM_E * 2);
+        uint32_t obi_r2 = obi_m3 + (num_rows * DIM_D * 2);
+
+        // Fetch the slice of M3 [num_rows x D] while the group shares the full M4 [DxE]
+        idma_handle_t slice = IDMA_HANDLE_NONE;
+        if (num_rows > 0)
+            slice = idma_memcpy_1d_async(&idma_ctrl,
+                                         0,
+                                         (uint32_t)m3_inp + start_row * DIM_D * 2,
+                                         obi_m3,
+                                         num_rows * DIM_D * 2);
+        idma_multicast(&coll_ctx,
+                       gemm2_tiles,
+                       GEMM2_N_TILES,
+                       1,
+                       (uint32_t)m4_inp,
+                       obi_m4,
+                       DIM_D * DIM_E * 2);
 
-            // Load full M4 [DxE] from L2
-            idma_memcpy_1d(&idma_ctrl, 0, (uint32_t)m4_inp, obi_m4, DIM_D * DIM_E * 2);
-            eu_idma_wait_a2o(&eu_ctrl, WAIT_MODE);
+        if (num_rows > 0) {
+            idma_wait(&idma_ctrl, slice);
 
             // Zero accumulator and compute: R2_slice = M3_slice @ M4
             mem_set_zero(obi_r2, num_rows * DIM_E);
@@ -248,23 +264,29 @@ int main(void)
         uint32_t start_row, num_rows;
         get_row_range(gemm3_idx, GEMM3_N_TILES, DIM_A, &start_row, &num_rows);
 
-        if (num_rows > 0) {
-            // L1 layout: R1_slice, R2, R3_slice
-            uint32_t obi_r1 = l1_tile_base;
-            uint32_t obi_r2 = obi_r1 + (num_rows * DIM_C * 2);
-            uint32_t obi_r3 = obi_r2 + (DIM_C * DIM_E * 2);
+        // L1 layout: R2, R1_slice, R3_slice. R2 is at the same offset on the whole group
+        uint32_t obi_r2 = l1_tile_base;
+        uint32_t obi_r1 = obi_r2 + (DIM_C * DIM_E * 2);
+        uint32_t obi_r3 = obi_r1 + (num_rows * DIM_C * 2);
+
+        // Fetch the slice of R1 [num_rows x C] while the group shares the full R2 [CxE]
+        idma_handle_t slice = IDMA_HANDLE_NONE;
+        if (num_rows > 0)
+            slice = idma_memcpy_1d_async(&idma_ctrl,
+                                         0,
+                                         (uint32_t)r1_out + start_row * DIM_C * 2,
+                                         obi_r1,
+                                         num_rows * DIM_C * 2);
+        idma_multicast(&coll_ctx,
+                       gemm3_tiles,
+                       GEMM3_N_TILES,
+                       0,
+                       (uint32_t)r2_out,
+                       obi_r2,
+                       DIM_C * DIM_E * 2);
 
-            // Load slice of R1 [num_rows x C] from L2
-            idma_memcpy_1d(&idma_ctrl,
-                           0,
-                           (uint32_t)r1_out + start_row * DIM_C * 2,
-                           obi_r1,
-                           num_rows * DIM_C * 2);
-            eu_idma_wait_a2o(&eu_ctrl, WAIT_MODE);
-
-            // Load full R2 [CxE] from L2
-            idma_memcpy_1d(&idma_ctrl, 0, (uint32_t)r2_out, obi_r2, DIM_C * DIM_E * 2);
-            eu_idma_wait_a2o(&eu_ctrl, WAIT_MODE);
+        if (num_rows > 0) {
+            idma_wait(&idma_ctrl, slice);
 
             // Zero accumulator and compute: R3_slice = R1_slice @ R2
             mem_set_zero(obi_r3, num_rows * DIM_E);
@@ -300,23 +322,29 @@ int main(void)
         uint32_t start_row, num_rows;
         get_row_range(gemm4_idx, GEMM4_N_TILES, DIM_A, &start_row, &num_rows);
 
-        if (num_rows > 0) {
-            // L1 layout: R3_slice, M5, O_slice
-            uint32_t obi_r3 = l1_tile_base;
-            uint32_t obi_m5 = obi_r3 + (num_rows * DIM_E * 2);
-            uint32_t obi_o  = obi_m5 + (DIM_E * DIM_F * 2);
-
-            // Load slice of R3 [num_rows x E] from L2
-            idma_memcpy_1d(&idma_ctrl,
-                           0,
-                           (uint32_t)r3_out + start_row * DIM_E * 2,
-                           obi_r3,
-                           num_rows * DIM_E * 2);
-            eu_idma_wait_a2o(&eu_ctrl, WAIT_MODE);
+        // L1 layout: M5, R3_slice, O_slice. M5 is at the same offset on the whole group
+        uint32_t obi_m5 = l1_tile_base;
+        uint32_t obi_r3 = obi_m5 + (DIM_E * DIM_F * 2);
+        uint32_t obi_o  = obi_r3 + (num_rows * DIM_E * 2);
+
+        // Fetch the slice of R3 [num_rows x E] while the group shares the full M5 [ExF]
+        idma_handle_t slice = IDMA_HANDLE_NONE;
+        if (num_rows > 0)
+            slice = idma_memcpy_1d_async(&idma_ctrl,
+                                         0,
+                                         (uint32_t)r3_out + start_row * DIM_E * 2,
+                                         obi_r3,
+                                         num_rows * DIM_E * 2);
+        idma_multicast(&coll_ctx,
+                       gemm4_tiles,
+                       GEMM4_N_TILES,
+                       0,
+                       (uint32_t)m5_inp,
+                       obi_m5,
+                       DIM_E * DIM_F * 2);
 
-            // Load full M5 [ExF] from L2
-            idma_memcpy_1d(&idma_ctrl, 0, (uint32_t)m5_inp, obi_m5, DIM_E * DIM_F * 2);
-            eu_idma_wait_a2o(&eu_ctrl, WAIT_MODE);
+        if (num_rows > 0) {
+            idma_wait(&idma_ctrl, slice);
 
             // Zero accumulator and compute: O_slice = R3_slice @ M5
             mem_set_zero(obi_o, num_rows * DIM_F);
@@ -10,6 +10,7 @@
 #include "idma.h"
 #include "redmule.h"
 #include "eventunit.h"
+#include "utils/vect_utils.h"
 
 #define WAIT_MODE            WFE
 #define abs_threshold_millis 8 /* 0.008 expressed as integer millis */
@@ -31,15 +32,10 @@ static int get_local_idx(uint32_t hartid, const uint32_t *tiles, uint32_t n_tile
     return -1;
 }
 
-/* Zero `n_halfwords` fp16 elements starting at L1 address `base` using 32-bit
- * stores. Assumes `base` is 4-byte aligned and `n_halfwords` is even, which
- * holds for the ping-pong chunks below (chunk_rows * DIM_C with even DIM_C). */
+/* Zero `n_halfwords` fp16 elements starting at L1 address `base` */
 static inline void l1_zero_fp16(uint32_t base, uint32_t n_halfwords)
 {
-    volatile uint32_t *p = (volatile uint32_t *)base;
-    uint32_t n           = n_halfwords >> 1;
-    for (uint32_t i = 0; i < n; i++)
-        p[i] = 0;
+    vect_fill_f16(base, 0, n_halfwords);
 }
 
 int main(void)
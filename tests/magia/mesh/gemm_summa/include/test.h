@@ -0,0 +1,18 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+
+#ifndef _TEST_GEMM_SUMMA_INCLUDE_GUARD_
+#define _TEST_GEMM_SUMMA_INCLUDE_GUARD_
+
+/* Not multiples of any mesh size, so that the output blocks and the panels are ragged */
+#define M_SIZE (35)
+#define N_SIZE (50)
+#define K_SIZE (27)
+
+/* From a single grid of output blocks and panel down to several of both on every mesh size */
+static const uint32_t l1_budgets[] = {0x8000, 0x600, 0x300};
+
+#endif //_TEST_GEMM_SUMMA_INCLUDE_GUARD_
@@ -0,0 +1,167 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+
+#include <stdint.h>
+#include "test.h"
+
+#include "tile.h"
+#include "idma.h"
+#include "redmule.h"
+#include "fsync.h"
+#include "eventunit.h"
+#include "utils/gemm_utils.h"
+
+#define WAIT_MODE WFE
+
+static _Float16 x_inp[M_SIZE * N_SIZE];
+static _Float16 w_inp[N_SIZE * K_SIZE];
+static _Float16 y_inp[M_SIZE * K_SIZE];
+
+/* Small integers: every partial sum is exact in fp16, whatever the accumulation order */
+static int32_t x_val(uint32_t i, uint32_t j)
+{
+    return (int32_t)((i * 3 + j * 5) % 5) - 2;
+}
+
+static int32_t w_val(uint32_t i, uint32_t j)
+{
+    return (int32_t)((i * 7 + j * 3) % 5) - 2;
+}
+
+static int32_t y_val(uint32_t i, uint32_t j)
+{
+    return (int32_t)((i + j * 2) % 9) - 4;
+}
+
+static void barrier(fsync_controller_t *fsync_ctrl, eu_controller_t *eu_ctrl)
+{
+    fsync_sync_global(fsync_ctrl);
+#if STALLING == 0
+    eu_fsync_wait(eu_ctrl, WAIT_MODE);
+#endif
+}
+
+/**
+ * This test verifies the gemm_summa library routine: the whole mesh computes a GEMM whose sizes
+ * are not multiples of the mesh, once for every L1 budget, and every tile checks a share of the
+ * output rows against an integer reference.
+ */
+int main(void)
+{
+    /**
+     * 0. Get the mesh-tile's hartid and initialize the controllers for the idma, redmule, fsync
+     * and event unit.
+     */
+    uint32_t hartid = get_hartid();
+
+    idma_config_t idma_cfg      = {.hartid = hartid};
+    idma_controller_t idma_ctrl = {
+        .base = NULL,
+        .cfg  = &idma_cfg,
+        .api  = &idma_api,
+    };
+
+    redmule_config_t redmule_cfg      = {.hartid = hartid};
+    redmule_controller_t redmule_ctrl = {
+        .base = NULL,
+        .cfg  = &redmule_cfg,
+        .api  = &redmule_api,
+    };
+
+    fsync_config_t fsync_cfg      = {.hartid = hartid};
+    fsync_controller_t fsync_ctrl = {
+        .base = NULL,
+        .cfg  = &fsync_cfg,
+        .api  = &fsync_api,
+    };
+
+    idma_init(&idma_ctrl);
+    redmule_init(&redmule_ctrl);
+    fsync_init(&fsync_ctrl);
+
+    eu_config_t eu_cfg      = {.hartid = hartid};
+    eu_controller_t eu_ctrl = {
+        .base = NULL,
+        .cfg  = &eu_cfg,
+        .api  = &eu_api,
+    };
+#if STALLING == 0
+    eu_init(&eu_ctrl);
+    eu_fsync_init(&eu_ctrl, 0);
+    eu_redmule_init(&eu_ctrl, 0);
+    eu_idma_init(&eu_ctrl, 0);
+#endif
+
+    gemm_tiled_t gemm = {
+        .x       = (uint32_t)x_inp,
+        .w       = (uint32_t)w_inp,
+        .y       = (uint32_t)y_inp,
+        .m       = M_SIZE,
+        .n       = N_SIZE,
+        .k       = K_SIZE,
+        .ldx     = N_SIZE,
+        .ldw     = K_SIZE,
+        .ldy     = K_SIZE,
+        .l1_base = get_l1_base(hartid),
+    };
+
+    uint32_t errors = 0;
+
+    for (uint32_t b = 0; b < sizeof(l1_budgets) / sizeof(l1_budgets[0]); b++) {
+        /**
+         * 1. Every tile initializes a share of the rows, gemm_summa starts with a global barrier.
+         */
+        for (uint32_t i = hartid; i < M_SIZE; i += NUM_HARTS) {
+            for (uint32_t j = 0; j < N_SIZE; j++)
+                x_inp[i * N_SIZE + j] = (_Float16)x_val(i, j);
+            for (uint32_t j = 0; j < K_SIZE; j++)
+                y_inp[i * K_SIZE + j] = (_Float16)y_val(i, j);
+        }
+        for (uint32_t i = hartid; i < N_SIZE; i += NUM_HARTS)
+            for (uint32_t j = 0; j < K_SIZE; j++)
+                w_inp[i * K_SIZE + j] = (_Float16)w_val(i, j);
+
+        /**
+         * 2. Compute the GEMM with the whole mesh.
+         */
+        gemm.l1_size = l1_budgets[b];
+        if (gemm_summa(&idma_ctrl, &redmule_ctrl, &fsync_ctrl, &eu_ctrl, &gemm))
+            return 1;
+        barrier(&fsync_ctrl, &eu_ctrl);
+
+        /**
+         * 3. Check results
+         */
+        for (uint32_t i = hartid; i < M_SIZE; i += NUM_HARTS) {
+            for (uint32_t j = 0; j < K_SIZE; j++) {
+                int32_t acc = y_val(i, j);
+                for (uint32_t l = 0; l < N_SIZE; l++)
+                    acc += x_val(i, l) * w_val(l, j);
+
+                _Float16 expected = (_Float16)acc;
+                _Float16 computed = y_inp[i * K_SIZE + j];
+                if (*(uint16_t *)&computed != *(uint16_t *)&expected) {
+#if EVAL == 1
+                    printf("Error detected with budget %x at coordinates[%d][%d]: Y=%x Z=%x\n",
+                           l1_budgets[b],
+                           i,
+                           j,
+                           *(uint16_t *)&computed,
+                           *(uint16_t *)&expected);
+#endif
+                    errors++;
+                }
+            }
+        }
+
+        /* The next initialization overwrites the rows checked by the other tiles */
+        barrier(&fsync_ctrl, &eu_ctrl);
+    }
+
+    printf("Number of errors: %d\n", errors);
+
+    return errors;
+}
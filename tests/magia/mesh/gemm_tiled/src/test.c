@@ -0,0 +1,132 @@
+// Copyright 2025-2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+
+#include <stdint.h>
+#include "test.h"
+
+#include "tile.h"
+#include "idma.h"
+#include "redmule.h"
+#include "eventunit.h"
+#include "utils/gemm_utils.h"
+
+/* Small on purpose, so that every mesh size exercises slicing and ragged tiles */
+#define L1_BUDGET (0x2000)
+
+/**
+ * This test verifies the gemm_tiled library routine: every mesh-tile computes its output-static
+ * data-tile with a double-buffered tiling chosen from a reduced L1 budget.
+ */
+int main(void)
+{
+    /**
+     * 0. Get the mesh-tile's hartid, mesh-tile coordinates and define its L1 base,
+     * also initialize the controllers for the idma and redmule.
+     */
+    uint32_t hartid = get_hartid();
+
+    idma_config_t idma_cfg      = {.hartid = hartid};
+    idma_controller_t idma_ctrl = {
+        .base = NULL,
+        .cfg  = &idma_cfg,
+        .api  = &idma_api,
+    };
+
+    redmule_config_t redmule_cfg      = {.hartid = hartid};
+    redmule_controller_t redmule_ctrl = {
+        .base = NULL,
+        .cfg  = &redmule_cfg,
+        .api  = &redmule_api,
+    };
+
+    idma_init(&idma_ctrl);
+    redmule_init(&redmule_ctrl);
+
+    eu_config_t eu_cfg      = {.hartid = hartid};
+    eu_controller_t eu_ctrl = {
+        .base = NULL,
+        .cfg  = &eu_cfg,
+        .api  = &eu_api,
+    };
+#if STALLING == 0
+    eu_init(&eu_ctrl);
+    eu_redmule_init(&eu_ctrl, 0);
+    eu_idma_init(&eu_ctrl, 0);
+#endif
+
+    uint32_t y_id = GET_Y_ID(hartid);
+    uint32_t x_id = GET_X_ID(hartid);
+
+    /**
+     * 1. Calculate the static output data-tile dimensions.
+     */
+    uint32_t tile_h_max = ((M_SIZE + MESH_Y_TILES - 1) / MESH_Y_TILES);
+    uint32_t tile_w_max = ((K_SIZE + MESH_X_TILES - 1) / MESH_X_TILES);
+    int32_t tile_h;
+    int32_t tile_w;
+
+    if (((tile_h_max * y_id) + tile_h_max) > M_SIZE) {
+        tile_h = M_SIZE - (tile_h_max * y_id);
+    } else {
+        tile_h = tile_h_max;
+    }
+
+    if (((tile_w_max * x_id) + tile_w_max) > K_SIZE) {
+        tile_w = K_SIZE - (tile_w_max * x_id);
+    } else {
+        tile_w = tile_w_max;
+    }
+
+    if (tile_h < 1 || tile_w < 1) {
+        return 0;
+    }
+
+    /**
+     * 2. Compute the data-tile.
+     */
+    gemm_tiled_t gemm = {
+        .x       = (uint32_t)x_inp + (y_id * tile_h_max * N_SIZE * 2),
+        .w       = (uint32_t)w_inp + (x_id * tile_w_max * 2),
+        .y       = (uint32_t)y_inp + ((y_id * tile_h_max * K_SIZE) + (x_id * tile_w_max)) * 2,
+        .m       = (uint32_t)tile_h,
+        .n       = N_SIZE,
+        .k       = (uint32_t)tile_w,
+        .ldx     = N_SIZE,
+        .ldw     = K_SIZE,
+        .ldy     = K_SIZE,
+        .l1_base = get_l1_base(hartid),
+        .l1_size = L1_BUDGET,
+    };
+
+    if (gemm_tiled(&idma_ctrl, &redmule_ctrl, &eu_ctrl, &gemm))
+        return 1;
+
+    /**
+     * 3. Check results
+     */
+    uint32_t errors = 0;
+    uint16_t computed, expected, diff = 0;
+    for (int i = (y_id * tile_h_max); i < (y_id * tile_h_max + tile_h); i++) {
+        for (int j = (x_id * tile_w_max); j < (x_id * tile_w_max) + tile_w; j++) {
+            computed = *(volatile uint16_t *)(y_inp + (i * K_SIZE + j));
+            expected = *(volatile uint16_t *)(z_out + (i * K_SIZE + j));
+            diff     = (computed > expected) ? (computed - expected) : (expected - computed);
+            if (diff > 0x0011) {
+#if EVAL == 1
+                printf("Error detected at coordinates[%d][%d]: Y=%x Z=%x\n",
+                       i,
+                       j,
+                       *(volatile uint16_t *)(y_inp + (i * K_SIZE + j)),
+                       *(volatile uint16_t *)(z_out + (i * K_SIZE + j)));
+#endif
+                errors++;
+            }
+        }
+    }
+    printf("Number of errors: %d\n", errors);
+
+    return errors;
+}
@@ -15,6 +15,7 @@
 #include "redmule.h"
 #include "fsync.h"
 #include "eventunit.h"
+#include "utils/vect_utils.h"
 
 #define WAIT_MODE WFE
 
@@ -32,7 +33,6 @@ int main(void)
     /**
      * 0. Get the mesh-tile's hartid, mesh-tile coordinates and define its L1 base.
      * Initialize the controllers for the idma, redmule, fsync and event unit.
-     * Move in identity matrix.
      */
     uint32_t hartid = get_hartid();
 
@@ -124,18 +124,6 @@ int main(void)
 
     // printf("Blocking dimensions: height %0d, width %0d\n", tile_h, tile_w);
 
-    /**
-     * 2. Use iDMA to transfer indentity matrix.
-     */
-    uint32_t len_id      = tile_w * 2;
-    uint32_t std_id      = K_SIZE * 2;
-    uint32_t reps_id     = tile_w;
-    uint32_t obi_addr_id = (l1_tile_base);
-    uint32_t axi_addr_id = (uint32_t)id_mat;
-
-    idma_memcpy_2d(&idma_ctrl, 0, axi_addr_id, obi_addr_id, len_id, std_id, reps_id);
-    eu_idma_wait_a2o(&eu_ctrl, WAIT_MODE);
-
     /**
      * 2a. Use iDMA to transfer bias blocks.
      * To avoid accumulating the bias multiple times only one tile per row fetches it, the rest
@@ -143,7 +131,7 @@ int main(void)
      * bias.
      */
     uint32_t len_y      = tile_w * 2;
-    uint32_t obi_addr_y = obi_addr_id + (tile_w * tile_w * 2);
+    uint32_t obi_addr_y = l1_tile_base;
     uint32_t axi_addr_y =
         (x_id == 0) ? (uint32_t)y_in + (y_id * tile_w * 2) : (uint32_t)y_out + (y_id * tile_w * 2);
 
@@ -192,11 +180,11 @@ int main(void)
         axi_addr_y = (uint32_t)y_out;
         idma_memcpy_1d(&idma_ctrl, 1, axi_addr_y, obi_addr_y, len_y);
         eu_idma_wait_o2a(&eu_ctrl, WAIT_MODE);
-    }
-    axi_addr_y = (uint32_t)y_out + (y_id * tile_w * 2);
-    idma_memcpy_1d(&idma_ctrl, 1, axi_addr_y, obi_addr_y, len_y);
-    eu_idma_wait_o2a(&eu_ctrl, WAIT_MODE);
-    if (MESH_2_POWER != 0) {
+    } else {
+        /**
+         * The partial GeMV stays in L1: only the leftmost tile of the row stores the reduced
+         * result, a store of the partials would race with it on the same y_out block.
+         */
         uint32_t log_tree_mask = 1;
         uint32_t log_tree_bit  = 1;
         for (int i = 0; i < reduce_phases; i++) {
@@ -212,14 +200,7 @@ int main(void)
                     for (int j = 0; j < (reduce_degree - 1); j++) {
                         if ((x_id + 1 + j) <= (MESH_X_TILES - 1)) {
                             uint32_t partial_gemv_addr = obi_addr_x + (j * len_y);
-                            redmule_gemm(&redmule_ctrl,
-                                         partial_gemv_addr,
-                                         obi_addr_id,
-                                         obi_addr_y,
-                                         tile_m,
-                                         tile_w,
-                                         tile_w);
-                            eu_redmule_wait(&eu_ctrl, WAIT_MODE);
+                            vect_acc_f16(obi_addr_y, partial_gemv_addr, tile_m * tile_w);
                         }
                     }
                 } else { // The non-leader tiles write on the L1 of their group leader.
@@ -229,8 +210,7 @@ int main(void)
                     uint32_t group_id = reduce_degree * (x_id / reduce_degree);
                     // printf("Group id: %d\n", group_id);
                     uint32_t partial_gemv_addr = get_l1_base(GET_ID(y_id, group_id)) +
-                                                 (tile_w * tile_w * 2) + (tile_w * tile_h * 2) +
-                                                 (tile_w * 2) +
+                                                 (obi_addr_x - l1_tile_base) +
                                                  (((x_id % reduce_degree) - 1) * len_y);
 
                     idma_memcpy_1d(&idma_ctrl, 1, partial_gemv_addr, obi_addr_y, len_y);
@@ -250,14 +230,7 @@ int main(void)
                     for (int j = 0; j < (reduce_degree - 1); j++) {
                         if ((x_id + 1 + j) <= (MESH_X_TILES - 1)) {
                             uint32_t partial_gemv_addr = obi_addr_x + (j * len_y);
-                            redmule_gemm(&redmule_ctrl,
-                                         partial_gemv_addr,
-                                         obi_addr_id,
-                                         obi_addr_y,
-                                         tile_m,
-                                         tile_w,
-                                         tile_w);
-                            eu_redmule_wait(&eu_ctrl, WAIT_MODE);
+                            vect_acc_f16(obi_addr_y, partial_gemv_addr, tile_m * tile_w);
                         }
                     }
                 } else if (x_id % reduce_degree ==
@@ -266,8 +239,7 @@ int main(void)
                      * 4a. Scatter partial GeMV.
                      */
                     uint32_t partial_gemv_addr = get_l1_base(GET_ID(y_id, 0)) +
-                                                 (tile_w * tile_w * 2) + (tile_w * tile_h * 2) +
-                                                 (tile_w * 2) +
+                                                 (obi_addr_x - l1_tile_base) +
                                                  (((x_id / reduce_degree) - 1) * len_y);
 
                     idma_memcpy_1d(&idma_ctrl, 1, partial_gemv_addr, obi_addr_y, len_y);
@@ -286,16 +258,14 @@ int main(void)
                  * 4a. Calculate the tile from which add the partial gemv
                  */
                 uint32_t partial_gemv_addr =
-                    get_l1_base(GET_ID(y_id, x_id ^ log_tree_bit)) + (tile_w * tile_h * 2);
+                    get_l1_base(GET_ID(y_id, x_id ^ log_tree_bit)) + (obi_addr_y - l1_tile_base);
                 idma_memcpy_1d(&idma_ctrl, 0, partial_gemv_addr, obi_addr_x, len_y);
                 eu_idma_wait_a2o(&eu_ctrl, WAIT_MODE);
 
                 /**
                  * 4b. Sum partial GeMV.
                  */
-                redmule_gemm(
-                    &redmule_ctrl, obi_addr_x, obi_addr_id, obi_addr_y, tile_m, tile_w, tile_w);
-                eu_redmule_wait(&eu_ctrl, WAIT_MODE);
+                vect_acc_f16(obi_addr_y, obi_addr_x, tile_m * tile_w);
             }
             log_tree_mask = (log_tree_mask << 1) | 1;
             log_tree_bit <<= 1;
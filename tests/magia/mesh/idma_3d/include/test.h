@@ -0,0 +1,361 @@
+// Copyright 2025-2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+
+#ifndef _TEST_IDMA_3D_INCLUDE_GUARD_
+#define _TEST_IDMA_3D_INCLUDE_GUARD_
+
+#define B_SIZE (4)
+#define R_SIZE (32)
+#define C_SIZE (32)
+
+uint16_t x_inp[B_SIZE * R_SIZE * C_SIZE] = {
+    0x279d, 0x32f6, 0x316a, 0x242c, 0x2bd6, 0x3353, 0x2f2b, 0x3405, 0x3296, 0x2218, 0x3361, 0x206b,
+    0x3acc, 0x2f03, 0x284c, 0x31a0, 0x277f, 0x2622, 0x36f2, 0x2f0c, 0x314f, 0x3ac4, 0x3196, 0x2f3e,
+    0x2cb5, 0x3473, 0x3b8d, 0x24d1, 0x276b, 0x3450, 0x24da, 0x3bc7, 0x30bd, 0x2c7a, 0x37b8, 0x207c,
+    0x357c, 0x38df, 0x220c, 0x2519, 0x3843, 0x32ea, 0x215e, 0x29a3, 0x38f6, 0x20fe, 0x3a5a, 0x3bb2,
+    0x289f, 0x2f20, 0x3308, 0x3700, 0x2c67, 0x36da, 0x3938, 0x2da9, 0x2ca3, 0x374c, 0x39a1, 0x3276,
+    0x2e3a, 0x244a, 0x2bb2, 0x231e, 0x2125, 0x2459, 0x2fd6, 0x26f1, 0x2841, 0x3581, 0x2df5, 0x38ed,
+    0x340d, 0x3b5e, 0x29a2, 0x2d7a, 0x303b, 0x3aab, 0x2c59, 0x325e, 0x2b3a, 0x3117, 0x32b8, 0x2d0a,
+    0x32b2, 0x276f, 0x2ac6, 0x35d2, 0x20ea, 0x3b67, 0x28f3, 0x3362, 0x357b, 0x3642, 0x2538, 0x365b,
+    0x3b8a, 0x2a71, 0x3156, 0x324d, 0x3236, 0x2354, 0x36d7, 0x34f9, 0x26c1, 0x3441, 0x3a9c, 0x325a,
+    0x288b, 0x291e, 0x23fb, 0x2207, 0x2f6c, 0x3b53, 0x3470, 0x2f78, 0x22d5, 0x2b02, 0x399e, 0x2221,
+    0x2d22, 0x24d3, 0x20a4, 0x2967, 0x2dab, 0x3899, 0x2d49, 0x3bed, 0x23ce, 0x216a, 0x335c, 0x33aa,
+    0x385f, 0x2170, 0x2c16, 0x36fd, 0x32c3, 0x2a97, 0x31a0, 0x28ee, 0x302c, 0x278c, 0x2127, 0x29e8,
+    0x203b, 0x2276, 0x2375, 0x3331, 0x3123, 0x2101, 0x2650, 0x2d0d, 0x2954, 0x3388, 0x286d, 0x24ff,
+    0x3612, 0x215b, 0x3bc4, 0x2adf, 0x2a0a, 0x2b86, 0x246d, 0x3b93, 0x2c16, 0x2c0e, 0x2ebb, 0x3bd6,
+    0x30a4, 0x2c5b, 0x349a, 0x3bbd, 0x330f, 0x35ca, 0x31e5, 0x2348, 0x33d8, 0x39f7, 0x3039, 0x28ae,
+    0x2dcc, 0x344c, 0x370c, 0x36e6, 0x279a, 0x29a2, 0x2dff, 0x2843, 0x30ad, 0x29b2, 0x318c, 0x2ad8,
+    0x205d, 0x393a, 0x2d49, 0x328f, 0x2a13, 0x20a4, 0x2c0c, 0x33b4, 0x32da, 0x343a, 0x2443, 0x21ec,
+    0x3445, 0x3413, 0x2aa3, 0x2eeb, 0x2b4b, 0x35bc, 0x2b48, 0x337b, 0x369f, 0x28ec, 0x379d, 0x2faa,
+    0x20b5, 0x32dc, 0x21f0, 0x35a1, 0x20ae, 0x2bd0, 0x2809, 0x3418, 0x2e9a, 0x298e, 0x32f7, 0x333f,
+    0x2a3d, 0x25ad, 0x2ba5, 0x25ed, 0x2a01, 0x3842, 0x2bd0, 0x3b00, 0x330f, 0x2873, 0x299c, 0x3931,
+    0x2c11, 0x235b, 0x38b6, 0x3a04, 0x20dc, 0x3237, 0x35e1, 0x3786, 0x2434, 0x29eb, 0x3000, 0x271f,
+    0x34eb, 0x39b8, 0x289e, 0x27a3, 0x2a7d, 0x25ff, 0x35b2, 0x2ded, 0x34c9, 0x3656, 0x231a, 0x2342,
+    0x3339, 0x2a4d, 0x2aae, 0x3599, 0x3aac, 0x272e, 0x2e07, 0x39e9, 0x3b60, 0x256a, 0x228e, 0x2ac6,
+    0x37bf, 0x34ce, 0x26fa, 0x3230, 0x2e6f, 0x28a8, 0x2733, 0x392f, 0x23de, 0x2115, 0x30f2, 0x261b,
+    0x2a15, 0x39d1, 0x3ac2, 0x3ad4, 0x3265, 0x25df, 0x3ba3, 0x28ea, 0x2ae2, 0x39d4, 0x3a7e, 0x348a,
+    0x22bc, 0x39cc, 0x33d1, 0x2b0c, 0x32dd, 0x2426, 0x2d7b, 0x2957, 0x3096, 0x3967, 0x3b32, 0x28ad,
+    0x2ede, 0x2b15, 0x344b, 0x2d57, 0x294a, 0x2d6e, 0x322f, 0x2d1a, 0x2123, 0x2d39, 0x24fd, 0x2662,
+    0x2026, 0x2f46, 0x3aa4, 0x33ec, 0x3053, 0x2de6, 0x31e2, 0x36f3, 0x271b, 0x2108, 0x37db, 0x2e9d,
+    0x3ac6, 0x381b, 0x3537, 0x37ef, 0x309b, 0x293f, 0x3167, 0x2aea, 0x2747, 0x3b91, 0x222d, 0x3b74,
+    0x32d6, 0x292f, 0x23d7, 0x39ed, 0x27d3, 0x2171, 0x211f, 0x39b1, 0x3632, 0x3064, 0x2659, 0x2dc1,
+    0x3276, 0x2194, 0x206b, 0x2f64, 0x37d9, 0x23dd, 0x257f, 0x301a, 0x2998, 0x27a6, 0x3536, 0x20a2,
+    0x30cc, 0x312f, 0x2d3d, 0x21b4, 0x3396, 0x23a2, 0x2aec, 0x2403, 0x2814, 0x3b92, 0x314f, 0x2f45,
+    0x39f8, 0x3908, 0x21f6, 0x2b42, 0x2710, 0x2650, 0x23e9, 0x311b, 0x3a23, 0x23d0, 0x257b, 0x27a9,
+    0x3955, 0x28c2, 0x39cb, 0x241c, 0x3a5a, 0x203d, 0x2f99, 0x341d, 0x3244, 0x3b9a, 0x2ccf, 0x2199,
+    0x3835, 0x28af, 0x27f1, 0x2898, 0x33c7, 0x30df, 0x30a1, 0x2d89, 0x21a1, 0x2f21, 0x2a56, 0x38d9,
+    0x3a39, 0x200e, 0x3b6c, 0x21c1, 0x38ce, 0x240f, 0x217a, 0x23fc, 0x2198, 0x2230, 0x2f73, 0x210e,
+    0x3b57, 0x36ce, 0x22c1, 0x307e, 0x3011, 0x2fae, 0x2a1b, 0x2506, 0x2a11, 0x224b, 0x2b3d, 0x2c58,
+    0x34b3, 0x2c77, 0x32c5, 0x29bb, 0x2b8b, 0x287a, 0x261d, 0x2a85, 0x2db7, 0x23f5, 0x2415, 0x31c6,
+    0x201c, 0x36e9, 0x3723, 0x2c2a, 0x3973, 0x228e, 0x3222, 0x25b6, 0x215f, 0x2bf1, 0x2ebf, 0x3357,
+    0x34cf, 0x390b, 0x3152, 0x2c2b, 0x345f, 0x39a3, 0x2163, 0x33ef, 0x2dcf, 0x21b2, 0x2bea, 0x3414,
+    0x2fe0, 0x3852, 0x367d, 0x2a14, 0x2d74, 0x3636, 0x2d62, 0x2ebf, 0x2092, 0x27d7, 0x26ff, 0x3125,
+    0x28a4, 0x363e, 0x32e0, 0x224a, 0x39b3, 0x2d98, 0x272e, 0x2da0, 0x242b, 0x20e6, 0x2a6b, 0x2bf9,
+    0x31e3, 0x394f, 0x3bd9, 0x2863, 0x23e2, 0x2eda, 0x3619, 0x23f0, 0x3a05, 0x3768, 0x3531, 0x3b31,
+    0x30f7, 0x395b, 0x2c0b, 0x355c, 0x2379, 0x377a, 0x2a30, 0x320b, 0x3105, 0x234c, 0x39f8, 0x32ce,
+    0x36ee, 0x2028, 0x2f27, 0x2497, 0x278d, 0x38c7, 0x2c70, 0x216b, 0x30de, 0x22f0, 0x320e, 0x232d,
+    0x3518, 0x2c06, 0x25bb, 0x3a38, 0x20c0, 0x2aed, 0x3aed, 0x3b46, 0x23e1, 0x20d0, 0x3b01, 0x23ae,
+    0x358d, 0x2f6b, 0x3ac2, 0x3648, 0x291a, 0x3287, 0x2994, 0x398f, 0x22d7, 0x2129, 0x388e, 0x3209,
+    0x305c, 0x30ed, 0x36e2, 0x27a0, 0x236a, 0x31be, 0x37f7, 0x2332, 0x31b4, 0x21f4, 0x319a, 0x2a60,
+    0x3bd2, 0x320c, 0x25c6, 0x3a7f, 0x2279, 0x27bf, 0x25c0, 0x34ab, 0x27ff, 0x2e88, 0x33b6, 0x3667,
+    0x381d, 0x2c99, 0x2817, 0x2bc2, 0x332e, 0x2cb1, 0x2b35, 0x31cf, 0x2d62, 0x22aa, 0x2c02, 0x3002,
+    0x2787, 0x2d35, 0x3afe, 0x37ea, 0x2523, 0x2d49, 0x361b, 0x3230, 0x3832, 0x328d, 0x3590, 0x308c,
+    0x35f0, 0x2f7a, 0x24ff, 0x3493, 0x2cd5, 0x24c7, 0x2533, 0x2311, 0x2fef, 0x37f0, 0x2f78, 0x365b,
+    0x308d, 0x2e2d, 0x32c4, 0x3701, 0x3b75, 0x25f4, 0x245c, 0x288e, 0x3810, 0x265f, 0x24b0, 0x32bd,
+    0x307f, 0x2a13, 0x276f, 0x3b3f, 0x361d, 0x3137, 0x38f1, 0x2977, 0x357b, 0x3692, 0x3b5e, 0x2d38,
+    0x330c, 0x3b51, 0x32b4, 0x32b5, 0x288c, 0x26f6, 0x29d4, 0x20bd, 0x2894, 0x2f57, 0x39bb, 0x2c3f,
+    0x266b, 0x2583, 0x323c, 0x2b88, 0x27a4, 0x2a4e, 0x2f71, 0x38c6, 0x3ba4, 0x2498, 0x2d63, 0x3652,
+    0x2f58, 0x3672, 0x332b, 0x2695, 0x2efa, 0x3293, 0x3ab5, 0x3a4a, 0x34e0, 0x31d3, 0x20e3, 0x2f66,
+    0x3710, 0x2250, 0x3b69, 0x2cce, 0x390f, 0x3779, 0x2177, 0x2ef4, 0x2758, 0x2783, 0x34be, 0x36f7,
+    0x38df, 0x359c, 0x2237, 0x26f4, 0x3b52, 0x2822, 0x27bf, 0x2611, 0x38d3, 0x2846, 0x2466, 0x25fd,
+    0x33e6, 0x368d, 0x359a, 0x3b79, 0x212d, 0x2829, 0x256e, 0x3bae, 0x2170, 0x2a07, 0x25dd, 0x2d8b,
+    0x22e9, 0x3753, 0x3990, 0x22bf, 0x23c6, 0x22f6, 0x2874, 0x3aaf, 0x2956, 0x2127, 0x2b69, 0x2e79,
+    0x3291, 0x377d, 0x359d, 0x2ac5, 0x2038, 0x20f0, 0x2ab6, 0x2a9b, 0x2df5, 0x2c26, 0x2f8c, 0x227e,
+    0x26b9, 0x349e, 0x32b9, 0x37c1, 0x2fad, 0x2c82, 0x2403, 0x316b, 0x2a33, 0x23d0, 0x28ca, 0x2270,
+    0x354b, 0x2dd7, 0x2399, 0x2e07, 0x30e1, 0x2807, 0x2319, 0x30e2, 0x366c, 0x2bf9, 0x35b5, 0x38b7,
+    0x2bca, 0x383b, 0x2e69, 0x2975, 0x3536, 0x35a0, 0x3570, 0x34ee, 0x39cb, 0x3a27, 0x287f, 0x236d,
+    0x3822, 0x2ad5, 0x3587, 0x321d, 0x3128, 0x30d2, 0x23a0, 0x3557, 0x2fcd, 0x3047, 0x2b44, 0x21e7,
+    0x36fa, 0x296b, 0x35b6, 0x374a, 0x321f, 0x37c0, 0x25d2, 0x34aa, 0x34a9, 0x375d, 0x3430, 0x24c9,
+    0x25bb, 0x2bdd, 0x34f8, 0x2e89, 0x23f0, 0x2376, 0x31e9, 0x2486, 0x2a9b, 0x34a3, 0x370e, 0x34c9,
+    0x331e, 0x2d71, 0x31c1, 0x299e, 0x34b8, 0x25fb, 0x2ea5, 0x2f6f, 0x29ff, 0x3907, 0x25a4, 0x3693,
+    0x2231, 0x236f, 0x36e8, 0x25cc, 0x3824, 0x31b8, 0x3161, 0x326d, 0x37ab, 0x2c8a, 0x2b7e, 0x2332,
+    0x2881, 0x28aa, 0x2c44, 0x21b6, 0x3beb, 0x245e, 0x2158, 0x2f51, 0x3026, 0x28ae, 0x27e9, 0x3641,
+    0x389a, 0x3078, 0x2b54, 0x2aa6, 0x2ce8, 0x2e57, 0x3153, 0x39e4, 0x38b1, 0x2237, 0x2b4a, 0x2fef,
+    0x3b19, 0x2396, 0x24d9, 0x28a7, 0x32e2, 0x2330, 0x35ce, 0x239b, 0x320f, 0x38ed, 0x3745, 0x2396,
+    0x25ea, 0x3657, 0x260d, 0x3225, 0x2d55, 0x3571, 0x37c9, 0x2c84, 0x3a1a, 0x37f5, 0x241c, 0x32f0,
+    0x3373, 0x24af, 0x3b81, 0x2cbf, 0x398a, 0x2632, 0x316e, 0x30e2, 0x2573, 0x3230, 0x25b9, 0x2677,
+    0x3bcb, 0x2801, 0x2bd3, 0x3903, 0x2960, 0x20f6, 0x3af4, 0x39b3, 0x2e3c, 0x2d08, 0x3a10, 0x2c42,
+    0x2a1c, 0x31ae, 0x32a8, 0x29e8, 0x3446, 0x2fee, 0x30ee, 0x35f8, 0x369f, 0x2994, 0x3b85, 0x355d,
+    0x2f7d, 0x20f7, 0x333e, 0x2618, 0x3742, 0x344a, 0x2013, 0x2370, 0x38a7, 0x3830, 0x352e, 0x277b,
+    0x2fbd, 0x258a, 0x30c1, 0x3400, 0x2ebc, 0x265d, 0x2630, 0x3907, 0x30f2, 0x26c7, 0x212f, 0x3a01,
+    0x3003, 0x34ab, 0x2e37, 0x2392, 0x321c, 0x2910, 0x350a, 0x24e2, 0x2456, 0x2ef3, 0x395b, 0x22d6,
+    0x33f1, 0x219e, 0x20d1, 0x2b84, 0x33c9, 0x2778, 0x3030, 0x227d, 0x2ff4, 0x313e, 0x209a, 0x2ade,
+    0x2a56, 0x2a81, 0x3bdb, 0x2b00, 0x363a, 0x3630, 0x244c, 0x2293, 0x3b77, 0x3ad9, 0x333c, 0x38cf,
+    0x2116, 0x36e9, 0x228f, 0x37ab, 0x2afe, 0x39d0, 0x2690, 0x2206, 0x3b91, 0x2666, 0x2dfc, 0x365e,
+    0x3838, 0x2711, 0x2f85, 0x2a1b, 0x237d, 0x392e, 0x215d, 0x2d12, 0x227e, 0x3b0c, 0x2668, 0x3696,
+    0x2525, 0x2c87, 0x2fe8, 0x2f25, 0x3660, 0x222c, 0x3132, 0x3b41, 0x2d81, 0x26ab, 0x34c6, 0x2fa6,
+    0x29bf, 0x20bf, 0x2edc, 0x2ea4, 0x383a, 0x361f, 0x2cd8, 0x2e07, 0x25c7, 0x2e92, 0x2131, 0x3707,
+    0x2836, 0x2bbd, 0x3b29, 0x2bdf, 0x2e53, 0x30f0, 0x2b91, 0x3316, 0x2cdb, 0x2729, 0x2016, 0x39bb,
+    0x26b0, 0x2847, 0x390f, 0x2bd4, 0x2497, 0x3b5f, 0x2eb8, 0x3115, 0x263f, 0x2517, 0x26b2, 0x20b6,
+    0x2576, 0x32b4, 0x2ceb, 0x301d, 0x2562, 0x345f, 0x20e1, 0x2474, 0x2385, 0x337a, 0x2562, 0x2e2a,
+    0x2fb0, 0x25e9, 0x21e9, 0x3aee, 0x20b7, 0x2ce6, 0x2e56, 0x2a2b, 0x2d0c, 0x210d, 0x3682, 0x36d9,
+    0x21a2, 0x27a7, 0x2ce7, 0x2140, 0x2cb1, 0x2fc8, 0x20da, 0x2701, 0x27ba, 0x2304, 0x2c73, 0x2f2f,
+    0x2619, 0x2545, 0x2aa7, 0x33eb, 0x23b7, 0x2b15, 0x23f7, 0x3305, 0x21a9, 0x39d6, 0x3749, 0x294e,
+    0x28cd, 0x3935, 0x2ee4, 0x3941, 0x299e, 0x2fa2, 0x27ff, 0x31f4, 0x2881, 0x20f6, 0x3a11, 0x2ac8,
+    0x3421, 0x2b08, 0x2a25, 0x22ff, 0x21d0, 0x35d6, 0x2dee, 0x22dc, 0x32f3, 0x33c3, 0x201d, 0x235a,
+    0x20f8, 0x35c9, 0x22e5, 0x209c, 0x2573, 0x3018, 0x212b, 0x2f6b, 0x21b9, 0x260d, 0x34f0, 0x304f,
+    0x2a99, 0x266c, 0x383c, 0x2f42, 0x2ae1, 0x39b6, 0x2f50, 0x2b3f, 0x3513, 0x2118, 0x2c3b, 0x29c0,
+    0x380c, 0x336b, 0x3435, 0x2c9e, 0x22cf, 0x2963, 0x25e4, 0x3b32, 0x2d37, 0x23ab, 0x303d, 0x2c79,
+    0x3183, 0x2ab1, 0x312b, 0x35c2, 0x38e8, 0x2ce3, 0x2596, 0x3acc, 0x37ac, 0x3baa, 0x377c, 0x2c58,
+    0x3abd, 0x31b4, 0x2b7e, 0x25e2, 0x2b9c, 0x39a7, 0x2d45, 0x2e07, 0x2757, 0x2e39, 0x38f1, 0x367c,
+    0x2f61, 0x2b0b, 0x289f, 0x3a45, 0x256e, 0x3039, 0x370f, 0x3816, 0x3361, 0x36bd, 0x364d, 0x2c60,
+    0x2f96, 0x215e, 0x24ec, 0x257e, 0x36be, 0x380d, 0x20bc, 0x3a54, 0x2ef1, 0x22f1, 0x3845, 0x3623,
+    0x35ac, 0x3523, 0x231b, 0x2a3e, 0x2796, 0x3338, 0x3aff, 0x39a4, 0x348e, 0x21ce, 0x3397, 0x3be9,
+    0x218a, 0x2e65, 0x2eed, 0x3bcc, 0x3773, 0x34b0, 0x2aad, 0x2bd7, 0x200d, 0x224e, 0x263c, 0x2cc7,
+    0x392e, 0x235c, 0x2ad4, 0x3234, 0x29f6, 0x2386, 0x2e69, 0x2296, 0x3a4d, 0x34c5, 0x26bb, 0x27b3,
+    0x3605, 0x218f, 0x24e2, 0x34a0, 0x2494, 0x32bc, 0x205f, 0x2396, 0x275b, 0x2933, 0x26ae, 0x270a,
+    0x3b39, 0x31ff, 0x307f, 0x2d6d, 0x3028, 0x38ff, 0x3356, 0x2a34, 0x393c, 0x3120, 0x3907, 0x2605,
+    0x2ef5, 0x25ae, 0x33ea, 0x2288, 0x2152, 0x3a6a, 0x39cd, 0x2399, 0x3324, 0x20c4, 0x3b7b, 0x233e,
+    0x2660, 0x2829, 0x22be, 0x237d, 0x2ee3, 0x2cc5, 0x2720, 0x3a6a, 0x3a8b, 0x35c7, 0x33b1, 0x237b,
+    0x3489, 0x2f89, 0x385d, 0x3564, 0x3be4, 0x3662, 0x2b12, 0x2ce4, 0x334c, 0x3527, 0x2e42, 0x38e3,
+    0x238c, 0x2956, 0x3abb, 0x3305, 0x2e32, 0x3a12, 0x2c24, 0x2697, 0x23bd, 0x3140, 0x203d, 0x2eda,
+    0x2993, 0x374b, 0x3490, 0x2278, 0x2aee, 0x2b13, 0x2624, 0x2f81, 0x381d, 0x2249, 0x31af, 0x35f6,
+    0x3787, 0x2bab, 0x2d88, 0x3917, 0x34bf, 0x2224, 0x3363, 0x3099, 0x26da, 0x27ff, 0x2b37, 0x3ad0,
+    0x21ff, 0x2ab9, 0x278e, 0x2dc9, 0x2e0c, 0x22b1, 0x2807, 0x26f8, 0x2a57, 0x2549, 0x37fc, 0x269f,
+    0x373e, 0x26ff, 0x3bfd, 0x3786, 0x3396, 0x2ed5, 0x36c2, 0x3124, 0x3b48, 0x2d66, 0x2bc4, 0x261d,
+    0x33f5, 0x2d18, 0x2f7e, 0x38c0, 0x2d05, 0x2f05, 0x32cd, 0x211e, 0x2958, 0x2094, 0x25e8, 0x2311,
+    0x20e7, 0x371d, 0x24d2, 0x296a, 0x301c, 0x309f, 0x21f6, 0x3474, 0x2f1b, 0x214c, 0x263b, 0x37d8,
+    0x26a2, 0x28d4, 0x2fbc, 0x2dd6, 0x2134, 0x2b08, 0x2efb, 0x37bf, 0x264b, 0x37e5, 0x3906, 0x2931,
+    0x2493, 0x234e, 0x2e35, 0x2994, 0x2d27, 0x2e33, 0x227b, 0x2694, 0x24e7, 0x2f98, 0x3868, 0x39eb,
+    0x3669, 0x2919, 0x2c00, 0x39ca, 0x344b, 0x2bec, 0x2529, 0x2dcd, 0x29fb, 0x2ed2, 0x2f2b, 0x30d4,
+    0x3158, 0x271f, 0x2b82, 0x3b49, 0x293a, 0x2920, 0x20f0, 0x2ed2, 0x2bf3, 0x2b7f, 0x39d4, 0x3a96,
+    0x2984, 0x37eb, 0x27c3, 0x39d0, 0x30a0, 0x2052, 0x2075, 0x2435, 0x3421, 0x30fc, 0x24c5, 0x3125,
+    0x20aa, 0x254d, 0x219b, 0x200f, 0x2686, 0x38a3, 0x3961, 0x2ee7, 0x2b5b, 0x3923, 0x2b9c, 0x31af,
+    0x211f, 0x2faf, 0x25eb, 0x27a3, 0x206c, 0x28db, 0x2dd5, 0x2ad3, 0x3abc, 0x21a3, 0x334f, 0x3178,
+    0x39f5, 0x2300, 0x2e66, 0x29f8, 0x2860, 0x27e9, 0x3580, 0x39ab, 0x2ff4, 0x2d62, 0x3721, 0x2854,
+    0x2add, 0x2168, 0x20f0, 0x2dbe, 0x2131, 0x3414, 0x359b, 0x254c, 0x385d, 0x39df, 0x320a, 0x27ea,
+    0x2457, 0x37cc, 0x3844, 0x3aec, 0x3943, 0x2d32, 0x3048, 0x3804, 0x3a97, 0x2acc, 0x31a8, 0x2447,
+    0x28f2, 0x2088, 0x2566, 0x2173, 0x208b, 0x2f8b, 0x3494, 0x21ef, 0x3a1f, 0x2eb8, 0x2ef5, 0x30ad,
+    0x354b, 0x3826, 0x3b86, 0x3a0c, 0x3348, 0x307c, 0x2d42, 0x2bdf, 0x3096, 0x343a, 0x2577, 0x2966,
+    0x25da, 0x225c, 0x35e1, 0x2477, 0x3aa1, 0x3181, 0x2340, 0x2d0f, 0x38c6, 0x2b42, 0x2e36, 0x2e8e,
+    0x28e8, 0x39b1, 0x282d, 0x2e7b, 0x290e, 0x30f4, 0x24f8, 0x3278, 0x2a13, 0x2478, 0x30b4, 0x2135,
+    0x2d2e, 0x2f89, 0x3b3b, 0x2760, 0x3a7b, 0x2eaf, 0x32bc, 0x3399, 0x28bf, 0x20fa, 0x2a20, 0x3262,
+    0x3320, 0x3197, 0x23b6, 0x2f9a, 0x2401, 0x28f4, 0x3922, 0x36b3, 0x381e, 0x2890, 0x2347, 0x2ded,
+    0x3565, 0x226d, 0x2be1, 0x2113, 0x3079, 0x2f95, 0x3814, 0x3a73, 0x3497, 0x2e54, 0x263e, 0x29f6,
+    0x2b10, 0x25cb, 0x34ec, 0x2c44, 0x3a80, 0x2cb0, 0x2a1e, 0x2193, 0x28ab, 0x26da, 0x2136, 0x2a22,
+    0x2a28, 0x3389, 0x2c8f, 0x31c4, 0x2905, 0x2123, 0x2435, 0x2d5b, 0x2801, 0x2d3a, 0x2289, 0x2fd8,
+    0x275a, 0x2666, 0x3799, 0x228b, 0x3657, 0x30d7, 0x23af, 0x37c6, 0x343b, 0x3ad3, 0x23f4, 0x3432,
+    0x3ad6, 0x3a2b, 0x202b, 0x2907, 0x3625, 0x2238, 0x2dcc, 0x2890, 0x2f73, 0x2ec6, 0x2892, 0x2942,
+    0x3179, 0x31e7, 0x2182, 0x2596, 0x278c, 0x2f92, 0x2560, 0x249d, 0x24cb, 0x3693, 0x25b1, 0x3614,
+    0x2ef4, 0x3596, 0x2cb9, 0x34b3, 0x2045, 0x248d, 0x2c89, 0x21bf, 0x25c4, 0x384d, 0x340d, 0x25a3,
+    0x29f3, 0x2611, 0x34c1, 0x3a53, 0x242f, 0x3bfe, 0x24b2, 0x218f, 0x30c4, 0x24dd, 0x311c, 0x26db,
+    0x2c3c, 0x38eb, 0x236d, 0x2ddd, 0x2c79, 0x25d1, 0x20d7, 0x28fc, 0x2357, 0x2433, 0x23ae, 0x24a5,
+    0x2970, 0x240f, 0x2c46, 0x2b47, 0x3351, 0x2276, 0x2624, 0x203c, 0x2bde, 0x248f, 0x2f4e, 0x27de,
+    0x220e, 0x2b57, 0x3179, 0x2f85, 0x2352, 0x3682, 0x3b19, 0x2a06, 0x2f20, 0x20ae, 0x37a9, 0x2b0d,
+    0x30fc, 0x37f1, 0x3b54, 0x3905, 0x2e28, 0x3234, 0x2d09, 0x2ed9, 0x3137, 0x3138, 0x29c5, 0x2e27,
+    0x24c5, 0x311a, 0x2e99, 0x3aa7, 0x2c49, 0x266a, 0x3836, 0x3304, 0x2975, 0x37fd, 0x3b25, 0x37ec,
+    0x25be, 0x299f, 0x3b7b, 0x3ae1, 0x255f, 0x2a24, 0x2882, 0x3ae0, 0x2679, 0x242c, 0x21b2, 0x3350,
+    0x21d2, 0x2d18, 0x33a9, 0x3bed, 0x25b1, 0x23aa, 0x3259, 0x2072, 0x250d, 0x3bd5, 0x23eb, 0x3968,
+    0x2ce8, 0x3234, 0x35ef, 0x2bf9, 0x30ce, 0x364d, 0x3883, 0x28cd, 0x22f5, 0x2ed4, 0x314a, 0x3296,
+    0x2e1e, 0x2a6d, 0x24ae, 0x32e5, 0x3336, 0x26fe, 0x2a57, 0x2e99, 0x3034, 0x3209, 0x2bf3, 0x3460,
+    0x2a2e, 0x32e9, 0x2b78, 0x367a, 0x333b, 0x38ab, 0x3723, 0x2b02, 0x3b97, 0x3618, 0x3aba, 0x2aec,
+    0x292d, 0x2985, 0x28a1, 0x25d5, 0x23f1, 0x3344, 0x3006, 0x2714, 0x376e, 0x2ae9, 0x3752, 0x34a6,
+    0x27f4, 0x2909, 0x2de9, 0x288a, 0x2e7e, 0x2427, 0x2f4a, 0x2ab4, 0x3101, 0x393c, 0x3bff, 0x25a0,
+    0x33d9, 0x30e9, 0x30ad, 0x2e21, 0x33c5, 0x21a6, 0x2237, 0x2d5b, 0x2d9d, 0x3198, 0x3b1e, 0x3389,
+    0x38e0, 0x2951, 0x21e6, 0x2790, 0x3b57, 0x2c36, 0x2c49, 0x26c2, 0x2264, 0x2bbb, 0x3072, 0x26de,
+    0x21c5, 0x318e, 0x2fcf, 0x23c3, 0x2dcb, 0x376e, 0x3bc2, 0x2c77, 0x36c3, 0x31ee, 0x2b91, 0x2061,
+    0x299e, 0x2be7, 0x302b, 0x2bdf, 0x2cc4, 0x2e0e, 0x2beb, 0x34da, 0x35ee, 0x2355, 0x32b3, 0x2fd7,
+    0x24ad, 0x2a59, 0x2709, 0x2000, 0x2bde, 0x220e, 0x33ab, 0x2001, 0x2476, 0x229c, 0x26b1, 0x2a42,
+    0x2dec, 0x290e, 0x264c, 0x20f1, 0x20e8, 0x313d, 0x3776, 0x2a0a, 0x3119, 0x2e38, 0x3798, 0x2ba5,
+    0x3a82, 0x3713, 0x3ace, 0x39a1, 0x26d1, 0x2e1f, 0x2ada, 0x35d6, 0x32b1, 0x23dd, 0x304d, 0x2c1a,
+    0x2732, 0x2f36, 0x2472, 0x29d0, 0x292d, 0x31af, 0x2613, 0x23c1, 0x3a5a, 0x258e, 0x3329, 0x22b6,
+    0x2dc8, 0x20e5, 0x3978, 0x2b3d, 0x2c3f, 0x203d, 0x2faf, 0x3aa3, 0x25e0, 0x2f20, 0x28c6, 0x247a,
+    0x2c70, 0x2684, 0x305f, 0x3458, 0x2dd5, 0x32c1, 0x341d, 0x351d, 0x2988, 0x2df5, 0x292e, 0x231a,
+    0x347e, 0x37dc, 0x361e, 0x22ac, 0x220f, 0x2e22, 0x381d, 0x37df, 0x2a46, 0x221c, 0x3b32, 0x204d,
+    0x2a61, 0x2f5b, 0x2d81, 0x3434, 0x2303, 0x3a72, 0x351f, 0x2a9c, 0x349d, 0x2d66, 0x32a6, 0x273b,
+    0x2a53, 0x2676, 0x34bf, 0x2c8a, 0x22d4, 0x21a9, 0x3485, 0x3093, 0x20d9, 0x3049, 0x30c2, 0x27a9,
+    0x325d, 0x3a87, 0x22ba, 0x25c2, 0x276e, 0x3a44, 0x2f00, 0x3a60, 0x3b6f, 0x313f, 0x2cac, 0x291b,
+    0x2b00, 0x2e97, 0x352a, 0x30e8, 0x2740, 0x2679, 0x3256, 0x298d, 0x2af7, 0x32d1, 0x2440, 0x329f,
+    0x3102, 0x2ba9, 0x33d6, 0x3093, 0x2b5b, 0x2a13, 0x3899, 0x3b85, 0x32b5, 0x3b70, 0x371e, 0x379d,
+    0x30d3, 0x2683, 0x2e4e, 0x21ea, 0x3715, 0x2dd9, 0x3b72, 0x29fc, 0x3425, 0x2634, 0x2fca, 0x3be2,
+    0x3b52, 0x26ea, 0x25e1, 0x3a54, 0x2350, 0x2e9e, 0x23d4, 0x300a, 0x2cb5, 0x3af3, 0x26c8, 0x2a17,
+    0x25f7, 0x3827, 0x2134, 0x2a76, 0x2ff5, 0x27e6, 0x2c4c, 0x3b3f, 0x35c9, 0x3aa8, 0x3755, 0x21d2,
+    0x2793, 0x2cd7, 0x2bbd, 0x2c74, 0x2726, 0x25af, 0x291e, 0x2805, 0x2b0f, 0x286d, 0x21b0, 0x3636,
+    0x2ae2, 0x376e, 0x238e, 0x26a4, 0x270d, 0x29b8, 0x2e26, 0x2588, 0x3213, 0x2562, 0x27db, 0x2f74,
+    0x3663, 0x26b1, 0x26e4, 0x39f2, 0x3577, 0x2bac, 0x337f, 0x276f, 0x259f, 0x35e3, 0x3808, 0x30fb,
+    0x2c9d, 0x3326, 0x3143, 0x2d95, 0x3320, 0x25ab, 0x3419, 0x29a8, 0x2e27, 0x2bfb, 0x21ca, 0x2283,
+    0x392c, 0x3129, 0x3b82, 0x2ea0, 0x2faf, 0x2093, 0x3287, 0x25a5, 0x2897, 0x30a1, 0x2d6d, 0x35f0,
+    0x2fd6, 0x2719, 0x2c73, 0x3a28, 0x3005, 0x2f87, 0x2b12, 0x2cff, 0x33cf, 0x2f75, 0x3842, 0x25b8,
+    0x23ac, 0x36f0, 0x2d69, 0x2ad8, 0x3ba8, 0x376f, 0x249d, 0x32ab, 0x2a48, 0x2371, 0x2b2b, 0x30e6,
+    0x24b0, 0x3b3a, 0x2988, 0x2f4a, 0x3423, 0x3142, 0x24dc, 0x3b9e, 0x2e4a, 0x2bfe, 0x2fc4, 0x2156,
+    0x32a6, 0x2b1d, 0x3a5d, 0x344f, 0x267f, 0x33f2, 0x22fe, 0x3676, 0x385b, 0x31ae, 0x32f8, 0x29b0,
+    0x32b1, 0x35b1, 0x293b, 0x3153, 0x2a59, 0x2d20, 0x3ac0, 0x37f0, 0x34d6, 0x2952, 0x2058, 0x2d88,
+    0x35b7, 0x31e0, 0x3786, 0x3872, 0x2b38, 0x2d87, 0x2f52, 0x2bd7, 0x3226, 0x25ce, 0x27fe, 0x2973,
+    0x3652, 0x260c, 0x3200, 0x3ab0, 0x2c56, 0x36d1, 0x2381, 0x2a5e, 0x31b9, 0x252f, 0x2a3a, 0x3732,
+    0x2f8c, 0x2585, 0x3151, 0x2c9e, 0x2ee4, 0x2647, 0x2d10, 0x31b0, 0x3271, 0x2bb3, 0x236b, 0x3729,
+    0x21c0, 0x3368, 0x2f6e, 0x3675, 0x2673, 0x254e, 0x3029, 0x354b, 0x2559, 0x23d0, 0x2339, 0x31aa,
+    0x3133, 0x23c0, 0x2c63, 0x3bcb, 0x31d1, 0x307f, 0x2a19, 0x2cb6, 0x28c6, 0x221d, 0x2f58, 0x28d7,
+    0x35e4, 0x2a0e, 0x275f, 0x2858, 0x23c0, 0x26c6, 0x2385, 0x2f41, 0x2be2, 0x2de3, 0x24b8, 0x2864,
+    0x2bd1, 0x35cf, 0x25f4, 0x2878, 0x3248, 0x38f7, 0x3058, 0x2662, 0x3557, 0x2722, 0x27e7, 0x2844,
+    0x394e, 0x2b1f, 0x3778, 0x2afb, 0x236c, 0x2327, 0x3bca, 0x3683, 0x2455, 0x3804, 0x22ab, 0x2736,
+    0x2ea0, 0x2aaf, 0x23ac, 0x2a74, 0x3a83, 0x3865, 0x248a, 0x2549, 0x215d, 0x3559, 0x2fb5, 0x289f,
+    0x3048, 0x2441, 0x2bea, 0x3bd9, 0x2e1d, 0x37d5, 0x2db3, 0x3022, 0x321a, 0x35fd, 0x325f, 0x2daf,
+    0x39bc, 0x2dc2, 0x283d, 0x2973, 0x3169, 0x28b6, 0x32bd, 0x2c6b, 0x24ec, 0x217d, 0x2101, 0x2570,
+    0x2dcd, 0x347e, 0x200c, 0x26c3, 0x394f, 0x3842, 0x2432, 0x3028, 0x3752, 0x26a3, 0x3b21, 0x3658,
+    0x3746, 0x349d, 0x2beb, 0x2839, 0x2164, 0x341a, 0x31d0, 0x3209, 0x37dc, 0x2b75, 0x267c, 0x23c6,
+    0x2512, 0x26f5, 0x37a9, 0x225c, 0x2f81, 0x2db0, 0x37a1, 0x293c, 0x24c8, 0x23bc, 0x3168, 0x2ac7,
+    0x3565, 0x3a14, 0x3352, 0x3762, 0x2528, 0x284a, 0x2460, 0x22c6, 0x33fe, 0x228e, 0x35c7, 0x246b,
+    0x230d, 0x203a, 0x3654, 0x22a6, 0x3420, 0x3920, 0x3098, 0x2c81, 0x36a8, 0x2e95, 0x31b1, 0x3539,
+    0x338e, 0x2e2a, 0x286d, 0x25a2, 0x366e, 0x3a74, 0x2010, 0x223d, 0x2902, 0x35d6, 0x365b, 0x2d4a,
+    0x2577, 0x2037, 0x210b, 0x2ac5, 0x3095, 0x373e, 0x2a7d, 0x3ab2, 0x2b93, 0x2340, 0x216a, 0x39ab,
+    0x26c3, 0x2c6e, 0x205f, 0x39c5, 0x3123, 0x2e3e, 0x355b, 0x3714, 0x2a73, 0x3412, 0x272f, 0x2e1d,
+    0x2e7a, 0x2792, 0x399b, 0x202f, 0x2b0c, 0x26e0, 0x275b, 0x250c, 0x2d4e, 0x2c8d, 0x2311, 0x2ca7,
+    0x2a1a, 0x3254, 0x23ab, 0x3174, 0x3553, 0x331e, 0x27cc, 0x2947, 0x2317, 0x20cb, 0x2cfe, 0x20d9,
+    0x32d4, 0x2ad9, 0x2725, 0x2649, 0x2e88, 0x3235, 0x3056, 0x287d, 0x347b, 0x3861, 0x333e, 0x2c33,
+    0x3531, 0x3789, 0x26b1, 0x30b1, 0x32c2, 0x2da6, 0x3460, 0x29de, 0x3999, 0x2203, 0x25b0, 0x396b,
+    0x2e77, 0x3000, 0x30f9, 0x2330, 0x2917, 0x329f, 0x33f4, 0x24bc, 0x2e09, 0x309f, 0x2409, 0x29df,
+    0x30b3, 0x2561, 0x273a, 0x2bb8, 0x30d5, 0x2972, 0x23e8, 0x2257, 0x2ffb, 0x222e, 0x2f59, 0x39ad,
+    0x27ec, 0x37b1, 0x38a3, 0x2d41, 0x20a6, 0x205e, 0x20bc, 0x2f27, 0x33e3, 0x2026, 0x21dc, 0x36ac,
+    0x3043, 0x3bcf, 0x2f5c, 0x206d, 0x2188, 0x2b05, 0x359b, 0x297b, 0x29c0, 0x3a22, 0x2f1f, 0x2fb9,
+    0x299d, 0x38eb, 0x29c2, 0x39a8, 0x243f, 0x29e3, 0x3405, 0x3205, 0x22d5, 0x2cfc, 0x34ca, 0x2167,
+    0x23a3, 0x35ca, 0x2621, 0x2799, 0x22ab, 0x2512, 0x37d5, 0x2c87, 0x30fd, 0x37f3, 0x389b, 0x371f,
+    0x3045, 0x2471, 0x342d, 0x2543, 0x22a5, 0x3590, 0x29a1, 0x3065, 0x3b57, 0x305a, 0x2032, 0x2fde,
+    0x222f, 0x2b97, 0x35a3, 0x2ffe, 0x22be, 0x2d7e, 0x3556, 0x36c0, 0x2aa5, 0x31ef, 0x390b, 0x2c82,
+    0x2de2, 0x2ee4, 0x2afc, 0x3340, 0x20ec, 0x2a55, 0x29c7, 0x2f65, 0x379e, 0x3453, 0x2842, 0x392c,
+    0x2f24, 0x37ed, 0x2837, 0x2694, 0x2b71, 0x231e, 0x34d1, 0x2860, 0x37cc, 0x2f53, 0x2d76, 0x2f42,
+    0x381a, 0x267d, 0x3708, 0x2ac8, 0x3333, 0x21df, 0x3539, 0x27aa, 0x32b4, 0x218e, 0x338e, 0x2cdd,
+    0x27ba, 0x2c55, 0x25cf, 0x2a36, 0x2323, 0x34ee, 0x25b7, 0x300b, 0x2e78, 0x282a, 0x2dcd, 0x2d7c,
+    0x3213, 0x3276, 0x2ae2, 0x2c11, 0x2dcb, 0x3a35, 0x2147, 0x2baa, 0x3773, 0x3a21, 0x3808, 0x2c9e,
+    0x2ba2, 0x3737, 0x2c86, 0x28b8, 0x30d4, 0x2706, 0x246a, 0x274d, 0x264b, 0x3880, 0x3363, 0x20fd,
+    0x348c, 0x2d39, 0x3749, 0x3b0a, 0x2352, 0x3357, 0x3885, 0x2cd5, 0x2f4e, 0x2f4c, 0x2c1c, 0x3017,
+    0x3019, 0x31df, 0x2dd9, 0x339b, 0x2667, 0x2f2d, 0x2ca3, 0x21dd, 0x34ac, 0x31ea, 0x36e3, 0x252a,
+    0x20b3, 0x2638, 0x321f, 0x35e0, 0x399c, 0x36d0, 0x231d, 0x3a21, 0x2469, 0x2cad, 0x38d9, 0x3068,
+    0x23b5, 0x23e7, 0x2355, 0x3307, 0x26dc, 0x2960, 0x3193, 0x3b5e, 0x241d, 0x2d82, 0x2dec, 0x24a5,
+    0x250b, 0x26e5, 0x3618, 0x3a8d, 0x340d, 0x2d82, 0x2fed, 0x2a19, 0x3409, 0x2e2c, 0x3072, 0x20ed,
+    0x2820, 0x3198, 0x2095, 0x32e6, 0x2af9, 0x2a24, 0x31ad, 0x2c55, 0x26db, 0x23e1, 0x2905, 0x265c,
+    0x22be, 0x269d, 0x2c76, 0x27cd, 0x3b58, 0x2717, 0x3be7, 0x2aaf, 0x2756, 0x37a6, 0x22f1, 0x2aa8,
+    0x31df, 0x29b4, 0x38c3, 0x26e8, 0x3aa8, 0x315a, 0x26a3, 0x31ec, 0x3757, 0x2cbf, 0x200d, 0x303c,
+    0x349f, 0x298a, 0x3a1d, 0x3ace, 0x27ae, 0x24a6, 0x3819, 0x28e4, 0x3a3b, 0x32bc, 0x2243, 0x3951,
+    0x2802, 0x2b01, 0x2684, 0x294d, 0x24f4, 0x2b06, 0x26eb, 0x2666, 0x3403, 0x31d9, 0x3900, 0x23ba,
+    0x2e89, 0x2daa, 0x2808, 0x21cc, 0x3110, 0x2ca4, 0x287f, 0x3281, 0x2938, 0x3a80, 0x30d4, 0x266a,
+    0x2e6f, 0x2687, 0x29f4, 0x2b2d, 0x3546, 0x22d6, 0x236a, 0x2d7f, 0x38be, 0x2cc1, 0x36e5, 0x2b0a,
+    0x3970, 0x34f0, 0x38ea, 0x32fd, 0x279d, 0x2807, 0x37e9, 0x23f9, 0x3373, 0x326a, 0x23e9, 0x20ca,
+    0x258b, 0x3be2, 0x2a3e, 0x2b00, 0x3338, 0x256d, 0x2727, 0x2a7e, 0x2185, 0x23a4, 0x38ef, 0x2a21,
+    0x336f, 0x3162, 0x222d, 0x2d05, 0x2ab1, 0x31ca, 0x294e, 0x20a4, 0x2f91, 0x2e27, 0x38eb, 0x36a1,
+    0x2e01, 0x3892, 0x2563, 0x2f72, 0x2006, 0x23d9, 0x390c, 0x2572, 0x2bd2, 0x3b1f, 0x3b54, 0x2f56,
+    0x28e5, 0x2c3c, 0x3b1e, 0x3080, 0x2654, 0x3b14, 0x2ebe, 0x2c02, 0x2f24, 0x2b92, 0x364d, 0x2bb6,
+    0x3769, 0x2058, 0x316f, 0x2a8e, 0x2f55, 0x320f, 0x2fdd, 0x3122, 0x2e73, 0x2054, 0x2f1e, 0x225f,
+    0x36e5, 0x29c1, 0x25f4, 0x277a, 0x3102, 0x23ab, 0x351b, 0x3bb9, 0x258c, 0x259a, 0x3794, 0x3972,
+    0x2856, 0x2a0b, 0x2280, 0x2b9b, 0x314d, 0x2024, 0x3ad8, 0x2714, 0x3b0e, 0x2aa9, 0x2078, 0x338b,
+    0x21b3, 0x2c21, 0x2548, 0x236b, 0x3481, 0x382a, 0x3010, 0x2e72, 0x2b27, 0x37cf, 0x2f82, 0x3976,
+    0x2046, 0x2eb9, 0x35a8, 0x2de4, 0x34dc, 0x318d, 0x37b6, 0x2294, 0x237c, 0x386d, 0x22e9, 0x354d,
+    0x22be, 0x2673, 0x3a92, 0x2356, 0x28fa, 0x22a9, 0x3532, 0x2aa6, 0x20ea, 0x3995, 0x26be, 0x2194,
+    0x36e6, 0x2e16, 0x2134, 0x23f1, 0x3056, 0x3726, 0x26db, 0x2a70, 0x368d, 0x2e3e, 0x37cd, 0x33d6,
+    0x29b8, 0x3885, 0x2a4b, 0x3657, 0x2074, 0x3b84, 0x2623, 0x3677, 0x312a, 0x34ab, 0x207c, 0x26f1,
+    0x3825, 0x32c7, 0x2deb, 0x241b, 0x3671, 0x3b19, 0x2b28, 0x2e3e, 0x309f, 0x30b3, 0x2d20, 0x356b,
+    0x2f18, 0x245e, 0x33d5, 0x3752, 0x3998, 0x29b2, 0x3b81, 0x3423, 0x2901, 0x227f, 0x277f, 0x3845,
+    0x2547, 0x316f, 0x2aad, 0x2e04, 0x39ce, 0x2c79, 0x27b9, 0x30a7, 0x365a, 0x3123, 0x2a2d, 0x2956,
+    0x2ac3, 0x2b08, 0x3884, 0x3807, 0x38da, 0x257e, 0x2978, 0x2bed, 0x225b, 0x25e5, 0x2c5e, 0x3759,
+    0x29b4, 0x3303, 0x2e94, 0x2cf2, 0x3053, 0x2dc7, 0x3a44, 0x26ed, 0x2336, 0x3407, 0x2b3b, 0x203d,
+    0x3339, 0x377e, 0x2baa, 0x2e1a, 0x21c0, 0x34cb, 0x3480, 0x2ea9, 0x30f3, 0x3521, 0x3a67, 0x3341,
+    0x280e, 0x33c3, 0x2fd8, 0x311e, 0x30bc, 0x37d2, 0x2fb8, 0x38dd, 0x3a9a, 0x37bf, 0x2623, 0x3b1d,
+    0x3922, 0x298b, 0x22ca, 0x3b29, 0x361c, 0x2254, 0x3a04, 0x2f85, 0x390c, 0x2e2c, 0x2ca9, 0x36c5,
+    0x2542, 0x267a, 0x3b56, 0x2865, 0x36dd, 0x2441, 0x31f7, 0x3273, 0x2861, 0x2004, 0x25b1, 0x2663,
+    0x3400, 0x279c, 0x2e8f, 0x3599, 0x3218, 0x23cc, 0x2944, 0x2bc4, 0x351c, 0x2624, 0x3a03, 0x308a,
+    0x357a, 0x233c, 0x200b, 0x2a67, 0x2e10, 0x29a6, 0x2fa4, 0x332b, 0x216c, 0x3947, 0x345e, 0x2a34,
+    0x390e, 0x2963, 0x25b6, 0x3402, 0x2eb6, 0x32b6, 0x3211, 0x2fe2, 0x29f1, 0x3b7f, 0x309a, 0x2f3c,
+    0x2afb, 0x27b3, 0x220f, 0x2674, 0x31b1, 0x2120, 0x2ba1, 0x312b, 0x225f, 0x2b1e, 0x3a4c, 0x2038,
+    0x25bb, 0x2135, 0x2f29, 0x250d, 0x2a74, 0x2301, 0x2577, 0x3b3e, 0x2baa, 0x3295, 0x3a5f, 0x27a1,
+    0x2f3f, 0x36bd, 0x3048, 0x344d, 0x3137, 0x21fc, 0x205d, 0x380a, 0x3173, 0x2752, 0x35b9, 0x2a34,
+    0x248a, 0x3243, 0x2925, 0x31e8, 0x27f8, 0x2b2f, 0x3b97, 0x391b, 0x3a31, 0x2b2b, 0x328a, 0x2c0d,
+    0x24c4, 0x2e89, 0x2db7, 0x3570, 0x3676, 0x2cf5, 0x21da, 0x2ed5, 0x2ce5, 0x3aec, 0x20b6, 0x34b3,
+    0x365a, 0x38be, 0x33c3, 0x2294, 0x288a, 0x2d69, 0x29c7, 0x2bae, 0x23f1, 0x2041, 0x25c5, 0x398d,
+    0x3988, 0x230c, 0x2d08, 0x37cf, 0x2168, 0x2cae, 0x360f, 0x2d8b, 0x384e, 0x27ff, 0x35fa, 0x227a,
+    0x3b0a, 0x2de5, 0x215c, 0x287e, 0x2bcb, 0x25e0, 0x2dbd, 0x3573, 0x2b24, 0x2d38, 0x37ae, 0x20a7,
+    0x277d, 0x3645, 0x3325, 0x2b68, 0x3040, 0x2772, 0x37f3, 0x3a13, 0x2c43, 0x2bd6, 0x3635, 0x2b5f,
+    0x2936, 0x33aa, 0x2516, 0x274e, 0x2ba1, 0x3790, 0x2000, 0x27d5, 0x34c2, 0x2507, 0x2f8a, 0x286b,
+    0x263d, 0x2465, 0x323e, 0x3bec, 0x2f2c, 0x384b, 0x30ee, 0x32c5, 0x3a53, 0x3be2, 0x2e29, 0x2549,
+    0x3809, 0x3a79, 0x2cf3, 0x3aaa, 0x282f, 0x2c35, 0x384e, 0x3255, 0x2c8b, 0x22f3, 0x269a, 0x2c15,
+    0x34e4, 0x2364, 0x26be, 0x3bed, 0x383b, 0x352f, 0x3261, 0x2b96, 0x3a6c, 0x395a, 0x2b68, 0x284c,
+    0x29b2, 0x3ae6, 0x365e, 0x3533, 0x34b2, 0x2c1a, 0x34a7, 0x31f0, 0x38c1, 0x2def, 0x24ec, 0x3493,
+    0x2b02, 0x3089, 0x226a, 0x2923, 0x2a4f, 0x3342, 0x3847, 0x3986, 0x28e7, 0x3745, 0x2637, 0x262e,
+    0x3764, 0x3638, 0x3a50, 0x2cbe, 0x34e3, 0x3a3e, 0x26d4, 0x34da, 0x370d, 0x26e9, 0x30be, 0x2777,
+    0x2bf2, 0x3bdd, 0x32d8, 0x286e, 0x2e5c, 0x27e3, 0x34c2, 0x380d, 0x23c8, 0x37d9, 0x238e, 0x306d,
+    0x3246, 0x209e, 0x3506, 0x328c, 0x2d37, 0x3b4b, 0x3b23, 0x2100, 0x395d, 0x3a7d, 0x33f1, 0x317e,
+    0x32b2, 0x29f1, 0x29fa, 0x33d0, 0x2b6a, 0x2403, 0x37c8, 0x30d0, 0x2439, 0x283f, 0x2587, 0x39bf,
+    0x2f21, 0x389c, 0x3828, 0x3585, 0x2c50, 0x285a, 0x30c1, 0x27ae, 0x252a, 0x35a4, 0x3b73, 0x32c7,
+    0x3873, 0x3911, 0x3851, 0x2f5e, 0x22aa, 0x2634, 0x3a38, 0x2b5b, 0x2062, 0x3215, 0x3583, 0x2f9c,
+    0x3be0, 0x21e5, 0x31df, 0x2d7e, 0x2dd9, 0x23b6, 0x33fa, 0x2c87, 0x2a10, 0x2d26, 0x3a0f, 0x29a3,
+    0x2b5f, 0x345a, 0x32be, 0x2cd3, 0x3b61, 0x227b, 0x2eda, 0x2639, 0x2246, 0x35d0, 0x2819, 0x2e02,
+    0x38ac, 0x3765, 0x23af, 0x287b, 0x3169, 0x222f, 0x3b7d, 0x2783, 0x32e0, 0x3147, 0x2b23, 0x28e4,
+    0x3841, 0x3475, 0x3a6b, 0x27ed, 0x328a, 0x35bc, 0x340f, 0x2a50, 0x3bab, 0x2d09, 0x2191, 0x2268,
+    0x325c, 0x200d, 0x24b8, 0x2647, 0x33fe, 0x2735, 0x34ef, 0x395f, 0x2365, 0x266b, 0x2b5a, 0x256b,
+    0x3111, 0x3882, 0x22c1, 0x2567, 0x2ca1, 0x301b, 0x2e92, 0x20be, 0x2355, 0x3a3b, 0x2a5c, 0x26a1,
+    0x2c39, 0x3923, 0x2d47, 0x38f8, 0x271b, 0x237c, 0x2179, 0x22d2, 0x3680, 0x222b, 0x31f4, 0x3715,
+    0x29b3, 0x358c, 0x3aa6, 0x3b21, 0x264e, 0x25db, 0x2e3b, 0x25e3, 0x22ca, 0x360e, 0x2b36, 0x2251,
+    0x2f8d, 0x3000, 0x3519, 0x24ea, 0x248a, 0x2791, 0x2737, 0x349e, 0x2f84, 0x28e3, 0x2cf1, 0x3583,
+    0x21f0, 0x3bce, 0x2762, 0x33e6, 0x299e, 0x3a4f, 0x3590, 0x2b55, 0x2236, 0x347f, 0x2582, 0x251a,
+    0x340e, 0x33dc, 0x20d4, 0x2e5b, 0x2386, 0x38a3, 0x3908, 0x2790, 0x2376, 0x3b65, 0x258c, 0x3acc,
+    0x2449, 0x31c2, 0x2a1f, 0x3652, 0x26c4, 0x31d6, 0x38d4, 0x2d9f, 0x20c7, 0x296d, 0x22de, 0x2e03,
+    0x27fd, 0x3011, 0x2ebf, 0x2790, 0x23df, 0x2cfb, 0x3b4e, 0x3272, 0x3405, 0x37b1, 0x335f, 0x2521,
+    0x273d, 0x3529, 0x30e0, 0x288f, 0x2320, 0x2403, 0x2efe, 0x3999, 0x3baa, 0x398d, 0x2d10, 0x20da,
+    0x3344, 0x2c59, 0x23a4, 0x3aa1, 0x2781, 0x3168, 0x2d67, 0x3bbc, 0x37d4, 0x2546, 0x22d7, 0x2272,
+    0x2f26, 0x20f4, 0x39f3, 0x259f, 0x2795, 0x2a5a, 0x3a34, 0x336d, 0x3a2d, 0x2aa1, 0x2f0b, 0x365c,
+    0x2eb1, 0x2958, 0x2273, 0x3aa6, 0x237b, 0x399e, 0x2b7e, 0x32f4, 0x3252, 0x21fb, 0x20a9, 0x2b7b,
+    0x2a1c, 0x2120, 0x222e, 0x25be, 0x284a, 0x23d2, 0x20df, 0x3b94, 0x2900, 0x35fb, 0x36b7, 0x33de,
+    0x2f08, 0x3434, 0x2037, 0x3b54, 0x3a50, 0x2d7b, 0x36de, 0x2c4c, 0x219a, 0x280e, 0x2afe, 0x24fe,
+    0x3b03, 0x3180, 0x2b43, 0x2688, 0x34c9, 0x37ad, 0x2228, 0x2a41, 0x3908, 0x3289, 0x2995, 0x317c,
+    0x37e7, 0x3417, 0x2c21, 0x24f8, 0x2c77, 0x2833, 0x22a4, 0x3609, 0x32b6, 0x26d2, 0x2fab, 0x357c,
+    0x304a, 0x22e0, 0x2c73, 0x29cc, 0x224a, 0x33a8, 0x3bf5, 0x3753, 0x30d6, 0x3182, 0x3816, 0x2a15,
+    0x35d7, 0x27e5, 0x263f, 0x2713, 0x3092, 0x3725, 0x3296, 0x2c97, 0x2ed6, 0x351e, 0x344b, 0x294c,
+    0x3970, 0x3638, 0x39fd, 0x2497, 0x24e6, 0x3680, 0x35e8, 0x3413, 0x352b, 0x320b, 0x2014, 0x27b7,
+    0x2584, 0x3032, 0x2e81, 0x2beb, 0x379c, 0x3694, 0x2d42, 0x32ef, 0x39d1, 0x2cbc, 0x37c5, 0x2e09,
+    0x306c, 0x31fd, 0x29a7, 0x2cf8, 0x3111, 0x2c2c, 0x3949, 0x29b5, 0x2282, 0x36c6, 0x3a57, 0x3359,
+    0x33bd, 0x37ca, 0x2a19, 0x2364, 0x228d, 0x2c50, 0x3386, 0x2d87, 0x2850, 0x36a2, 0x2edc, 0x2981,
+    0x2319, 0x2765, 0x2e87, 0x3acf, 0x323c, 0x36c1, 0x3387, 0x3bb8, 0x2f78, 0x2532, 0x3bc1, 0x2376,
+    0x32b0, 0x2c23, 0x36e6, 0x2fdd, 0x26c4, 0x36bf, 0x2e00, 0x298b, 0x20a9, 0x3797, 0x32b1, 0x293c,
+    0x35b7, 0x3935, 0x2956, 0x225b, 0x2464, 0x32f3, 0x2602, 0x3722, 0x215d, 0x2158, 0x2f4e, 0x2d28,
+    0x30a2, 0x2c6f, 0x3399, 0x39b8, 0x2c01, 0x3b91, 0x2dc5, 0x3917, 0x2076, 0x24ed, 0x3828, 0x2027,
+    0x2c0e, 0x3bca, 0x2d27, 0x2e67, 0x235b, 0x27d1, 0x25af, 0x3abd, 0x3667, 0x35db, 0x25a6, 0x349e,
+    0x2bf0, 0x239c, 0x35a8, 0x323d, 0x2b46, 0x34e9, 0x395f, 0x3791, 0x341a, 0x2b1c, 0x3405, 0x20ca,
+    0x29e8, 0x2b9f, 0x347e, 0x2196, 0x34c5, 0x3afd, 0x32c8, 0x28ee, 0x2fb3, 0x2a8a, 0x380c, 0x2016,
+    0x268a, 0x2c1e, 0x36d4, 0x36e3, 0x2126, 0x2811, 0x203f, 0x22a3, 0x27f7, 0x3a2b, 0x2a4b, 0x3297,
+    0x2f35, 0x2239, 0x2f4f, 0x3426, 0x2cbe, 0x203e, 0x2c0c, 0x3b2d, 0x209c, 0x29ac, 0x2e76, 0x31d1,
+    0x245e, 0x3552, 0x2ce5, 0x27ec, 0x24e1, 0x2deb, 0x383f, 0x3000, 0x230d, 0x222e, 0x225b, 0x3bb9,
+    0x23b7, 0x27e9, 0x3b7a, 0x2098, 0x27e8, 0x361d, 0x2a56, 0x2a03, 0x2e47, 0x3942, 0x31a8, 0x217c,
+    0x2d38, 0x273f, 0x2267, 0x2ae6, 0x2390, 0x2f3a, 0x34ef, 0x3b96, 0x367c, 0x27cb, 0x2c35, 0x2591,
+    0x3ac9, 0x3ac2, 0x3a80, 0x2a1c, 0x257b, 0x3a4e, 0x2b7a, 0x2bee, 0x31d5, 0x2aa6, 0x233e, 0x3bf3,
+    0x25b8, 0x2e29, 0x22b5, 0x2af3, 0x3acb, 0x25a6, 0x2b3b, 0x273a, 0x22fe, 0x3bf6, 0x242e, 0x2f07,
+    0x31bf, 0x29be, 0x33fd, 0x2ed8, 0x30a7, 0x294b, 0x3013, 0x232c, 0x2cb8, 0x221d, 0x2621, 0x2352,
+    0x3a45, 0x2258, 0x3bec, 0x320b, 0x27b7, 0x280d, 0x2a1f, 0x3490, 0x2674, 0x258b, 0x2578, 0x3407,
+    0x3776, 0x3a9b, 0x3930, 0x3250, 0x30cf, 0x2382, 0x367f, 0x3b9e, 0x24ff, 0x2649, 0x2aff, 0x3452,
+    0x2a51, 0x3959, 0x382f, 0x2793, 0x226c, 0x355a, 0x3b41, 0x258c, 0x2ccd, 0x36fd, 0x2057, 0x27de,
+    0x3940, 0x28fe, 0x29e1, 0x2185, 0x2bea, 0x2e88, 0x2bda, 0x2aa3, 0x3132, 0x29b1, 0x2ac5, 0x38ed,
+    0x3264, 0x2e1e, 0x3229, 0x3b64, 0x232b, 0x3b79, 0x2ad0, 0x369f, 0x36f3, 0x263b, 0x3656, 0x35fc,
+    0x2854, 0x3283, 0x2f73, 0x273a, 0x3220, 0x2e4b, 0x29c4, 0x36c0, 0x2654, 0x3629, 0x2bbd, 0x39f1,
+    0x2362, 0x2f3d, 0x23bc, 0x3058, 0x2fec, 0x35a0, 0x25d5, 0x2ada, 0x353b, 0x24c3, 0x219c, 0x2aa3,
+    0x21f6, 0x3aab, 0x338a, 0x28c3, 0x2017, 0x2785, 0x29bd, 0x2bd4, 0x2855, 0x25ba, 0x3344, 0x2e32,
+    0x35ab, 0x241f, 0x24c0, 0x2a15, 0x30b8, 0x2bae, 0x330c, 0x3133, 0x3080, 0x26ec, 0x365f, 0x29ef,
+    0x2a4c, 0x2d96, 0x36b8, 0x2296, 0x394d, 0x2d51, 0x2775, 0x3b57, 0x324e, 0x23f9, 0x282e, 0x3234,
+    0x38fe, 0x2377, 0x3b0e, 0x2461, 0x307c, 0x208b, 0x2f9c, 0x2e0d, 0x2848, 0x3b7a, 0x2a47, 0x2908,
+    0x26af, 0x2923, 0x2cc7, 0x398a, 0x37af, 0x227b, 0x208e, 0x23cb, 0x353b, 0x2da6, 0x22d2, 0x393c,
+    0x30e0, 0x24a1, 0x371b, 0x3341, 0x2524, 0x3b3d, 0x3030, 0x2e7f, 0x27b4, 0x28be, 0x2a87, 0x33f2,
+    0x2db4, 0x3667, 0x21d2, 0x2c9a, 0x27ad, 0x2057, 0x2c0d, 0x3a9a, 0x302f, 0x31c2, 0x28c1, 0x290d,
+    0x3510, 0x282c, 0x2506, 0x3ac6, 0x2b41, 0x2091, 0x2717, 0x37a8, 0x2282, 0x2589, 0x240c, 0x393a,
+    0x26e5, 0x3372, 0x2265, 0x2d54, 0x2045, 0x2e2d, 0x2d18, 0x360a, 0x30af, 0x3880, 0x2f20, 0x27af,
+    0x22f2, 0x2a79, 0x3890, 0x3029, 0x346c, 0x2842, 0x3078, 0x2b1b, 0x20d4, 0x26cd, 0x32ba, 0x27b7,
+    0x31ee, 0x37fb, 0x3a05, 0x334e, 0x32fd, 0x2e41, 0x3340, 0x2f17, 0x34b1, 0x33a1, 0x346c, 0x35e8,
+    0x384b, 0x20bb, 0x37d9, 0x3afc, 0x2fef, 0x2ece, 0x35e3, 0x2af1, 0x255a, 0x2acd, 0x3836, 0x22ca,
+    0x2b36, 0x3a5e, 0x20c8, 0x280a, 0x2dfd, 0x3109, 0x2e12, 0x2a03, 0x2bfe, 0x3301, 0x2320, 0x20f0,
+    0x3274, 0x3195, 0x2826, 0x2495, 0x3861, 0x30e9, 0x230a, 0x295e, 0x2e3a, 0x3a6f, 0x2967, 0x2e53,
+    0x2fa3, 0x22b3, 0x3071, 0x28f4, 0x297a, 0x21af, 0x2b71, 0x2dbf, 0x28dd, 0x272d, 0x34dd, 0x2af7,
+    0x24f0, 0x27ab, 0x2f3d, 0x2681, 0x31d4, 0x2bed, 0x2202, 0x346c, 0x207c, 0x20b6, 0x31c2, 0x2fa9,
+    0x3320, 0x2d9e, 0x2905, 0x3529};
+
+/* Not zero-initialized, so it is not placed in .bss */
+uint16_t y_out[B_SIZE * R_SIZE * C_SIZE] = {[0 ... (B_SIZE * R_SIZE * C_SIZE - 1)] = 0xFFFF};
+
+#endif //_TEST_IDMA_3D_INCLUDE_GUARD_
@@ -0,0 +1,162 @@
+// Copyright 2025-2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+
+#include <stdint.h>
+#include "test.h"
+
+#include "tile.h"
+#include "idma.h"
+#include "fsync.h"
+#include "eventunit.h"
+
+#define WAIT_MODE WFE
+
+/**
+ * This test verifies the 3-dimensional and N-dimensional iDMA transfers.
+ * Each mesh-tile moves its (rows x cols) window of every batch of a 3-D tensor to L1 with a
+ * single 3-D job, then writes it back to a second tensor with a 4-D descriptor.
+ */
+int main(void)
+{
+    /**
+     * 0. Get the mesh-tile's hartid, mesh-tile coordinates and define its L1 base,
+     * also initialize the controllers for the idma and fsync.
+     */
+    uint32_t hartid = get_hartid();
+
+    idma_config_t idma_cfg      = {.hartid = hartid};
+    idma_controller_t idma_ctrl = {
+        .base = NULL,
+        .cfg  = &idma_cfg,
+        .api  = &idma_api,
+    };
+
+    idma_init(&idma_ctrl);
+
+    fsync_config_t fsync_cfg      = {.hartid = hartid};
+    fsync_controller_t fsync_ctrl = {
+        .base = NULL,
+        .cfg  = &fsync_cfg,
+        .api  = &fsync_api,
+    };
+
+    fsync_init(&fsync_ctrl);
+
+    uint32_t y_id         = GET_Y_ID(hartid);
+    uint32_t x_id         = GET_X_ID(hartid);
+    uint32_t l1_tile_base = get_l1_base(hartid);
+
+#if STALLING == 0
+    eu_config_t eu_cfg      = {.hartid = hartid};
+    eu_controller_t eu_ctrl = {
+        .base = NULL,
+        .cfg  = &eu_cfg,
+        .api  = &eu_api,
+    };
+
+    eu_init(&eu_ctrl);
+    eu_clear_events(0xFFFFFFFF);
+    eu_fsync_init(&eu_ctrl, 0);
+    eu_idma_init(&eu_ctrl, 0);
+#endif
+
+    /**
+     * 1. Calculate the window of each batch assigned to this mesh-tile.
+     */
+    uint32_t tile_h_max = ((R_SIZE + MESH_Y_TILES - 1) / MESH_Y_TILES);
+    uint32_t tile_w_max = ((C_SIZE + MESH_X_TILES - 1) / MESH_X_TILES);
+    int32_t tile_h;
+    int32_t tile_w;
+
+    if (((tile_h_max * y_id) + tile_h_max) > R_SIZE) {
+        tile_h = R_SIZE - (tile_h_max * y_id);
+    } else {
+        tile_h = tile_h_max;
+    }
+
+    if (((tile_w_max * x_id) + tile_w_max) > C_SIZE) {
+        tile_w = C_SIZE - (tile_w_max * x_id);
+    } else {
+        tile_w = tile_w_max;
+    }
+
+    if (tile_h < 1 || tile_w < 1) {
+        return 0;
+    }
+
+    uint32_t offset   = ((y_id * tile_h_max * C_SIZE) + (x_id * tile_w_max)) * 2;
+    uint32_t obi_addr = l1_tile_base;
+
+    /**
+     * 2. Load the window of all the batches with a single 3-D job.
+     */
+    idma_memcpy_3d(&idma_ctrl,
+                   0,
+                   (uint32_t)x_inp + offset,
+                   obi_addr,
+                   tile_w * 2,
+                   C_SIZE * 2,
+                   (uint32_t)tile_h,
+                   R_SIZE * C_SIZE * 2,
+                   B_SIZE);
+#if STALLING == 0
+    eu_idma_wait_a2o(&eu_ctrl, WAIT_MODE);
+#endif
+
+    /**
+     * 3. Store it back splitting the batch dimension in two, so that the outer dimension is
+     * unrolled by the driver.
+     */
+    uint32_t plane      = tile_h * tile_w * 2;
+    idma_nd_desc_t desc = {
+        .dir      = 1,
+        .axi_addr = (uint32_t)y_out + offset,
+        .obi_addr = obi_addr,
+        .len      = tile_w * 2,
+        .ndims    = 3,
+        .dims =
+            {
+                {.axi_std = C_SIZE * 2, .obi_std = tile_w * 2, .reps = tile_h},
+                {.axi_std = R_SIZE * C_SIZE * 2, .obi_std = plane, .reps = 2},
+                {.axi_std = R_SIZE * C_SIZE * 4, .obi_std = plane * 2, .reps = B_SIZE / 2},
+            },
+    };
+    idma_wait(&idma_ctrl, idma_memcpy_nd(&idma_ctrl, &desc));
+
+    /**
+     * 4. Wait that all the tiles have finished
+     */
+    fsync_sync_global(&fsync_ctrl);
+#if STALLING == 0
+    eu_fsync_wait(&eu_ctrl, WAIT_MODE);
+#endif
+
+    /**
+     * 5. Check results
+     */
+    volatile uint32_t errors = 0;
+    for (uint32_t b = 0; b < B_SIZE; b++) {
+        for (uint32_t i = (y_id * tile_h_max); i < (y_id * tile_h_max + tile_h); i++) {
+            for (uint32_t j = (x_id * tile_w_max); j < (x_id * tile_w_max + tile_w); j++) {
+                uint32_t idx = (b * R_SIZE * C_SIZE) + (i * C_SIZE) + j;
+                if (*(volatile uint16_t *)(y_out + idx) != *(volatile uint16_t *)(x_inp + idx)) {
+#if EVAL == 1
+                    printf("Error detected at coordinates[%d][%d][%d]: Y=%x X=%x\n",
+                           b,
+                           i,
+                           j,
+                           *(volatile uint16_t *)(y_out + idx),
+                           *(volatile uint16_t *)(x_inp + idx));
+#endif
+                    errors++;
+                }
+            }
+        }
+    }
+    printf("Number of errors: %d\n", errors);
+
+    return errors;
+}
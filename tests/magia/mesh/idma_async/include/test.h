@@ -0,0 +1,11 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef _TEST_IDMA_ASYNC_INCLUDE_GUARD_
+#define _TEST_IDMA_ASYNC_INCLUDE_GUARD_
+
+#define CHUNK_ELEMS (32)                   // uint16_t elements per transfer
+#define N_CHUNKS    (3 * IDMA_QUEUE_DEPTH) // More transfers than the queue holds
+
+#endif
@@ -0,0 +1,133 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <stdint.h>
+#include "tile.h"
+#include "idma.h"
+#include "eventunit.h"
+#include "test.h"
+
+#define CHUNK_SIZE (CHUNK_ELEMS * 2)
+
+static uint16_t l2_src[NUM_HARTS][N_CHUNKS * CHUNK_ELEMS];
+static uint16_t l2_dst[NUM_HARTS][IDMA_QUEUE_DEPTH * CHUNK_ELEMS];
+
+static uint16_t value(uint32_t hartid, uint32_t i)
+{
+    return (uint16_t)((hartid << 8) ^ (i * 7 + 1));
+}
+
+/**
+ * This test checks the completion tracking of the asynchronous iDMA transfers:
+ * - waiting on a handle retires every transfer issued before it on the same direction, also when
+ *   more transfers than IDMA_QUEUE_DEPTH are issued back-to-back;
+ * - transfers whose completion events merged in the event unit buffer are all retired by the
+ *   idle-status fallback;
+ * - IDMA_HANDLE_NONE, also returned by idma_memcpy_nd for an invalid descriptor, is always done.
+ */
+int main(void)
+{
+    uint32_t hartid  = get_hartid();
+    uint32_t l1_base = get_l1_base(hartid);
+
+    idma_config_t idma_cfg      = {.hartid = hartid};
+    idma_controller_t idma_ctrl = {
+        .base = NULL,
+        .cfg  = &idma_cfg,
+        .api  = &idma_api,
+    };
+    idma_init(&idma_ctrl);
+
+#if STALLING == 0
+    eu_config_t eu_cfg      = {.hartid = hartid};
+    eu_controller_t eu_ctrl = {
+        .base = NULL,
+        .cfg  = &eu_cfg,
+        .api  = &eu_api,
+    };
+    eu_init(&eu_ctrl);
+    eu_clear_events(0xFFFFFFFF);
+    eu_idma_init(&eu_ctrl, 0);
+#endif
+
+    uint32_t errors = 0;
+    idma_handle_t handles[N_CHUNKS];
+    uint16_t *src = l2_src[hartid];
+    uint16_t *dst = l2_dst[hartid];
+
+    /**
+     * 1. Ordering: issue all the loads, wait on the last one only.
+     */
+    for (uint32_t i = 0; i < N_CHUNKS * CHUNK_ELEMS; i++)
+        src[i] = value(hartid, i);
+    for (uint32_t i = 0; i < N_CHUNKS * CHUNK_ELEMS; i++)
+        *(volatile uint16_t *)(l1_base + i * 2) = 0;
+
+    for (uint32_t c = 0; c < N_CHUNKS; c++)
+        handles[c] = idma_memcpy_1d_async(&idma_ctrl,
+                                          0,
+                                          (uint32_t)src + c * CHUNK_SIZE,
+                                          l1_base + c * CHUNK_SIZE,
+                                          CHUNK_SIZE);
+    idma_wait(&idma_ctrl, handles[N_CHUNKS - 1]);
+
+    for (uint32_t c = 0; c < N_CHUNKS; c++) {
+        if (!idma_test(&idma_ctrl, handles[c])) {
+            printf("[HARTID %d] ERROR: load %d not retired after waiting on the last one\n",
+                   hartid,
+                   c);
+            errors++;
+        }
+    }
+    for (uint32_t i = 0; i < N_CHUNKS * CHUNK_ELEMS; i++)
+        if (*(volatile uint16_t *)(l1_base + i * 2) != value(hartid, i))
+            errors++;
+
+    /**
+     * 2. Idle fallback: fill the queue with stores and let them all land before looking at the
+     * queue. Their completion events merged into a single one, so only the idle status of the
+     * backend can retire the last store: without the fallback idma_wait never returns.
+     */
+    for (uint32_t i = 0; i < IDMA_QUEUE_DEPTH * CHUNK_ELEMS; i++)
+        dst[i] = 0;
+
+    for (uint32_t c = 0; c < IDMA_QUEUE_DEPTH; c++)
+        handles[c] = idma_memcpy_1d_async(
+            &idma_ctrl, 1, (uint32_t)dst + c * CHUNK_SIZE, l1_base + c * CHUNK_SIZE, CHUNK_SIZE);
+    while (*(volatile uint16_t *)&dst[IDMA_QUEUE_DEPTH * CHUNK_ELEMS - 1] !=
+           value(hartid, IDMA_QUEUE_DEPTH * CHUNK_ELEMS - 1))
+        ;
+    idma_wait(&idma_ctrl, handles[IDMA_QUEUE_DEPTH - 1]);
+
+    for (uint32_t c = 0; c < IDMA_QUEUE_DEPTH; c++) {
+        if (!idma_test(&idma_ctrl, handles[c])) {
+            printf("[HARTID %d] ERROR: store %d not retired by the idle fallback\n", hartid, c);
+            errors++;
+        }
+    }
+    for (uint32_t i = 0; i < IDMA_QUEUE_DEPTH * CHUNK_ELEMS; i++)
+        if (*(volatile uint16_t *)&dst[i] != value(hartid, i))
+            errors++;
+
+    /**
+     * 3. Reserved handle.
+     */
+    idma_nd_desc_t desc = {
+        .dir      = 0,
+        .axi_addr = (uint32_t)src,
+        .obi_addr = l1_base,
+        .len      = CHUNK_SIZE,
+        .ndims    = IDMA_MAX_DIMS + 1,
+    };
+    idma_handle_t none = idma_memcpy_nd(&idma_ctrl, &desc);
+    if (none != IDMA_HANDLE_NONE) {
+        printf("[HARTID %d] ERROR: invalid descriptor returned handle %x\n", hartid, none);
+        errors++;
+    }
+    if (!idma_test(&idma_ctrl, IDMA_HANDLE_NONE) || idma_wait(&idma_ctrl, IDMA_HANDLE_NONE))
+        errors++;
+
+    printf("Number of errors: %d\n", errors);
+    return errors;
+}
@@ -0,0 +1,18 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef _TEST_IRQ_INCLUDE_GUARD_
+#define _TEST_IRQ_INCLUDE_GUARD_
+
+#define CHUNK_LEN  (256) // Bytes moved by each iDMA job of the chain
+#define N_CHUNKS   (8)   // Jobs of the chain
+#define BLOCK_LEN  (CHUNK_LEN * N_CHUNKS)
+
+// Source of the chained L2->L1 transfers, one block per tile
+uint32_t l2_src[NUM_HARTS * BLOCK_LEN / 4];
+
+// Destination of the L1->L2 copy back, one block per tile
+uint32_t l2_dst[NUM_HARTS * BLOCK_LEN / 4];
+
+#endif
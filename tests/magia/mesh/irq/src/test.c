@@ -0,0 +1,162 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <stdint.h>
+
+#include "tile.h"
+#include "idma.h"
+#include "eventunit.h"
+
+#include "test.h"
+
+#define WAIT_MODE WFE
+
+/* Chain of L2->L1 transfers driven by the A2O completion interrupt */
+typedef struct {
+    idma_controller_t *idma;
+    uint32_t axi;             // Source block in L2
+    uint32_t obi;             // Destination block in L1
+    volatile uint32_t n_done; // Chunks landed in L1
+} chain_t;
+
+static inline uint32_t pattern(uint32_t hartid, uint32_t i)
+{
+    return (hartid << 24) ^ (i * 0x9E3779B1u);
+}
+
+/* A chunk has landed in L1: issue the next one straight from the handler */
+static void chunk_loaded(void *arg)
+{
+    chain_t *chain = (chain_t *)arg;
+    uint32_t next  = ++chain->n_done;
+
+    if (next < N_CHUNKS)
+        idma_memcpy_1d(chain->idma,
+                       0,
+                       chain->axi + next * CHUNK_LEN,
+                       chain->obi + next * CHUNK_LEN,
+                       CHUNK_LEN);
+}
+
+static void block_stored(void *arg)
+{
+    (*(volatile uint32_t *)arg)++;
+}
+
+/* Spins until the callbacks have counted n completions, 1 if they did not within the timeout */
+static int wait_count(volatile uint32_t *count, uint32_t n)
+{
+    for (uint32_t timeout = 1000000; *count < n; timeout--)
+        if (timeout == 0)
+            return 1;
+    return 0;
+}
+
+/**
+ * This test checks the completion callbacks of the event unit: every tile streams a block from
+ * L2 to its L1 as a chain of transfers, each one issued by the A2O callback of the previous one,
+ * while the core computes a checksum in the foreground. The block is then stored back under an
+ * O2A callback. Once unregistered, the completion events are waited for as usual again.
+ */
+int main(void)
+{
+    uint32_t hartid = get_hartid();
+
+    idma_config_t idma_cfg      = {.hartid = hartid};
+    idma_controller_t idma_ctrl = {
+        .base = NULL,
+        .cfg  = &idma_cfg,
+        .api  = &idma_api,
+    };
+    idma_init(&idma_ctrl);
+
+    eu_config_t eu_cfg      = {.hartid = hartid};
+    eu_controller_t eu_ctrl = {
+        .base = NULL,
+        .cfg  = &eu_cfg,
+        .api  = &eu_api,
+    };
+    eu_init(&eu_ctrl);
+    eu_idma_init(&eu_ctrl, 0);
+
+    uint32_t *src    = &l2_src[hartid * BLOCK_LEN / 4];
+    uint32_t *dst    = &l2_dst[hartid * BLOCK_LEN / 4];
+    uint32_t obi     = get_l1_base(hartid);
+    uint32_t errors  = 0;
+    uint32_t n_words = BLOCK_LEN / 4;
+
+    for (uint32_t i = 0; i < n_words; i++)
+        src[i] = pattern(hartid, i);
+
+    /**
+     * 1. Chain the L2->L1 transfers from the A2O callback, checksum the source meanwhile.
+     */
+    chain_t chain = {.idma = &idma_ctrl, .axi = (uint32_t)src, .obi = obi, .n_done = 0};
+
+    if (eu_irq_register(&eu_ctrl, EU_IRQ_A2O_DONE, chunk_loaded, &chain))
+        errors++;
+    idma_memcpy_1d(&idma_ctrl, 0, chain.axi, chain.obi, CHUNK_LEN);
+
+    uint32_t checksum = 0;
+    for (uint32_t i = 0; i < n_words; i++)
+        checksum += pattern(hartid, i) * (i | 1);
+
+    if (wait_count(&chain.n_done, N_CHUNKS)) {
+        printf("[HARTID %d] ERROR: %d of %d chunks loaded\n", hartid, chain.n_done, N_CHUNKS);
+        errors++;
+    }
+
+    uint32_t l1_checksum = 0;
+    for (uint32_t i = 0; i < n_words; i++)
+        l1_checksum += mmio32(obi + i * 4) * (i | 1);
+    if (l1_checksum != checksum) {
+        printf("[HARTID %d] ERROR: L1 checksum %x, expected %x\n", hartid, l1_checksum, checksum);
+        errors++;
+    }
+
+    // The dispatcher consumed the completion events
+    if (eu_idma_a2o_is_done(&eu_ctrl))
+        errors++;
+
+    /**
+     * 2. Store the block back under the O2A callback.
+     */
+    volatile uint32_t n_stored = 0;
+
+    if (eu_irq_register(&eu_ctrl, EU_IRQ_O2A_DONE, block_stored, (void *)&n_stored))
+        errors++;
+    idma_memcpy_1d(&idma_ctrl, 1, (uint32_t)dst, obi, BLOCK_LEN);
+    if (wait_count(&n_stored, 1)) {
+        printf("[HARTID %d] ERROR: block not stored\n", hartid);
+        errors++;
+    }
+
+    for (uint32_t i = 0; i < n_words; i++) {
+        if (dst[i] != pattern(hartid, i)) {
+            printf("[HARTID %d] ERROR: l2_dst[%d] = %x, expected %x\n",
+                   hartid,
+                   i,
+                   dst[i],
+                   pattern(hartid, i));
+            errors++;
+            break;
+        }
+    }
+
+    /**
+     * 3. Without callbacks, the completion events are left to the waits again.
+     */
+    eu_irq_unregister(&eu_ctrl, EU_IRQ_A2O_DONE);
+    eu_irq_unregister(&eu_ctrl, EU_IRQ_O2A_DONE);
+    if (eu_irq_register(&eu_ctrl, EU_IRQ_NUM, block_stored, NULL) == 0)
+        errors++;
+
+    idma_memcpy_1d(&idma_ctrl, 0, (uint32_t)src, obi, CHUNK_LEN);
+    eu_idma_wait_a2o(&eu_ctrl, WAIT_MODE);
+    if (chain.n_done != N_CHUNKS)
+        errors++;
+
+    printf("Number of errors: %d\n", errors);
+    return errors;
+}
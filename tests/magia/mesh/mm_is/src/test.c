@@ -143,6 +143,17 @@ int main(void)
     uint32_t obi_addr_y_0 = obi_addr_w + (tile_w * t_size * 2);
     uint32_t obi_addr_y_1 = obi_addr_y_0 + (tile_h * t_size * 2);
 
+    /**
+     * 2d. Precompute the barrier with the next mesh-tile, over which the output data-tile is
+     * handed over.
+     */
+    fsync_barrier_t right_barrier = {.id = 0, .aggregate = 0};
+    fsync_token_t right_token     = FSYNC_TOKEN_NONE;
+    if (x_id != (MESH_X_TILES - 1)) {
+        uint32_t right_ids[2] = {hartid, hartid + 1};
+        right_barrier         = fsync_barrier_create(&fsync_ctrl, right_ids, 2, 0, 0);
+    }
+
     // sentinel_start();
 
     idma_memcpy_2d(&idma_ctrl, 0, axi_addr_x, obi_addr_x, len_x, std_x, reps_x);
@@ -177,7 +188,9 @@ int main(void)
          * If leftmost mesh-tile: load from L2 (IDMA transfer)
          * Else: sync from the previous tile, then copy its L1 buffer.
          * 0 and even timeslots: load in buffer 0; odd timeslots: load in buffer 1.
+         * Before that, complete the hand-over barrier of the previous timeslot (see 3d).
          */
+        fsync_wait(&fsync_ctrl, right_token);
         if (x_id == 0) {
             if (i % 2) {
                 idma_memcpy_2d(&idma_ctrl,
@@ -262,7 +275,8 @@ int main(void)
         }
 
         /**
-         * 3d. Sync with the next tile to ready the data.
+         * 3d. Arrive on the barrier with the next tile to ready the data. It is only waited
+         * in 3b of the next timeslot, so that the weight data-tile load overlaps it.
          * On the rightmost tile, store in L2 memory instead.
          */
         if (x_id == (MESH_X_TILES - 1)) {
@@ -293,10 +307,7 @@ int main(void)
             // printf("Sending this data: %x, %x, %x, %x", *(volatile uint16_t*)(obi_addr_y),
             // *(volatile uint16_t*)(obi_addr_y + 2), *(volatile uint16_t*)(obi_addr_y + 4),
             // *(volatile uint16_t*)(obi_addr_y + 6));
-            fsync_sync_right(&fsync_ctrl);
-#if STALLING == 0
-            eu_fsync_wait(&eu_ctrl, WAIT_MODE);
-#endif
+            right_token = fsync_arrive(&fsync_ctrl, &right_barrier);
         }
     }
 
@@ -307,6 +318,7 @@ int main(void)
      * 5. Check results
      */
     uint32_t errors = 0;
+    fsync_wait(&fsync_ctrl, right_token);
     fsync_sync_row(&fsync_ctrl);
 #if STALLING == 0
     eu_fsync_wait(&eu_ctrl, WAIT_MODE);
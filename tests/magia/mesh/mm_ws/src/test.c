@@ -151,6 +151,17 @@ int main(void)
     uint32_t obi_addr_y_0 = obi_addr_x + (tile_h * t_size * 2);
     uint32_t obi_addr_y_1 = obi_addr_y_0 + (tile_w * t_size * 2);
 
+    /**
+     * 2d. Precompute the barrier with the lower mesh-tile, over which the output data-tile is
+     * handed over.
+     */
+    fsync_barrier_t down_barrier = {.id = 0, .aggregate = 0};
+    fsync_token_t down_token     = FSYNC_TOKEN_NONE;
+    if (y_id != (MESH_Y_TILES - 1)) {
+        uint32_t down_ids[2] = {hartid, hartid + MESH_X_TILES};
+        down_barrier         = fsync_barrier_create(&fsync_ctrl, down_ids, 2, 1, 0);
+    }
+
     /**
      * 3. Cycle over the timeslots.
      * For each timeslot, the mesh-tile will:
@@ -183,7 +194,9 @@ int main(void)
          * If topmost mesh-tile: load from L2 (IDMA transfer)
          * Else: sync from the above tile, then copy its L1 buffer.
          * 0 and even timeslots: load in buffer 0; odd timeslots: load in buffer 1.
+         * Before that, complete the hand-over barrier of the previous timeslot (see 3d).
          */
+        fsync_wait(&fsync_ctrl, down_token);
         if (y_id == 0) {
             if (i % 2) {
                 idma_memcpy_2d(&idma_ctrl,
@@ -267,7 +280,8 @@ int main(void)
         }
 
         /**
-         * 3d. Sync with the lower tile to ready the data.
+         * 3d. Arrive on the barrier with the lower tile to ready the data. It is only waited
+         * in 3b of the next timeslot, so that the input data-tile load overlaps it.
          * On the bottommost tile, store in L2 memory instead.
          */
         if (y_id == (MESH_Y_TILES - 1)) {
@@ -298,16 +312,14 @@ int main(void)
             // printf("Sending this data: %x, %x, %x, %x", *(volatile uint16_t*)(obi_addr_y),
             // *(volatile uint16_t*)(obi_addr_y + 2), *(volatile uint16_t*)(obi_addr_y + 4),
             // *(volatile uint16_t*)(obi_addr_y + 6));
-            fsync_sync_down(&fsync_ctrl);
-#if STALLING == 0
-            eu_fsync_wait(&eu_ctrl, WAIT_MODE);
-#endif
+            down_token = fsync_arrive(&fsync_ctrl, &down_barrier);
         }
     }
 
     /**
      * 5. Check results
      */
+    fsync_wait(&fsync_ctrl, down_token);
     fsync_sync_col(&fsync_ctrl);
 #if STALLING == 0
     eu_fsync_wait(&eu_ctrl, WAIT_MODE);
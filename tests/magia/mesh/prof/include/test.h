@@ -0,0 +1,24 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+
+#ifndef _TEST_PROF_INCLUDE_GUARD_
+#define _TEST_PROF_INCLUDE_GUARD_
+
+#define DIM          (16) // Side of the square matrices of the GEMM
+
+// Regions profiled by the test
+#define REGION_TOTAL (0)
+#define REGION_LOAD  (1)
+#define REGION_GEMM  (2)
+
+// Inputs of the GEMM, shared by all the tiles
+float16 l2_x[DIM * DIM];
+float16 l2_w[DIM * DIM];
+
+// Outputs of the GEMM, one per tile
+float16 l2_y[NUM_HARTS * DIM * DIM];
+
+#endif
@@ -0,0 +1,185 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+
+#include <stdint.h>
+
+#include "tile.h"
+#include "idma.h"
+#include "redmule.h"
+#include "fsync.h"
+#include "eventunit.h"
+
+#include "test.h"
+
+#define WAIT_MODE WFE
+
+/**
+ * This test verifies the region profiler: every tile profiles a small load-compute-store kernel
+ * followed by a barrier, checks its own accumulators, and dumps them to L2. Tile 0 then checks
+ * the records of all the tiles and prints them.
+ */
+int main(void)
+{
+    /**
+     * 0. Get the tile's hartid and initialize the controllers for the idma, redmule, fsync and
+     * event unit.
+     */
+    uint32_t hartid = get_hartid();
+
+    idma_config_t idma_cfg      = {.hartid = hartid};
+    idma_controller_t idma_ctrl = {
+        .base = NULL,
+        .cfg  = &idma_cfg,
+        .api  = &idma_api,
+    };
+    idma_init(&idma_ctrl);
+
+    redmule_config_t redmule_cfg      = {.hartid = hartid};
+    redmule_controller_t redmule_ctrl = {
+        .base = NULL,
+        .cfg  = &redmule_cfg,
+        .api  = &redmule_api,
+    };
+    redmule_init(&redmule_ctrl);
+
+    fsync_config_t fsync_cfg      = {.hartid = hartid};
+    fsync_controller_t fsync_ctrl = {
+        .base = NULL,
+        .cfg  = &fsync_cfg,
+        .api  = &fsync_api,
+    };
+    fsync_init(&fsync_ctrl);
+
+    eu_config_t eu_cfg      = {.hartid = hartid};
+    eu_controller_t eu_ctrl = {
+        .base = NULL,
+        .cfg  = &eu_cfg,
+        .api  = &eu_api,
+    };
+    eu_init(&eu_ctrl);
+    eu_redmule_init(&eu_ctrl, 0);
+    eu_idma_init(&eu_ctrl, 0);
+    eu_fsync_init(&eu_ctrl, 0);
+
+    l1_alloc_init();
+    uint32_t len   = DIM * DIM * 2;
+    uint32_t obi_x = (uint32_t)l1_alloc(len);
+    uint32_t obi_w = (uint32_t)l1_alloc(len);
+    uint32_t obi_y = (uint32_t)l1_alloc(len);
+    uint32_t axi_y = (uint32_t)l2_y + hartid * len;
+
+    if (prof_active()) {
+        printf("Profiler active before prof_init\n");
+        return 1;
+    }
+
+#if PROF == 0
+    // Built with make prof=0: every call compiles to nothing
+    prof_init();
+    if (prof_active()) {
+        printf("Profiler active in a PROF=0 build\n");
+        return 1;
+    }
+    printf("Profiler compiled out, nothing to check\n");
+    return 0;
+#endif
+
+    /**
+     * 1. Profile the kernel: three loads, one GEMM, one store and a global barrier.
+     */
+    prof_init();
+    prof_begin(REGION_TOTAL);
+
+    prof_begin(REGION_LOAD);
+    idma_memcpy_1d(&idma_ctrl, 0, (uint32_t)l2_x, obi_x, len);
+    eu_idma_wait_a2o(&eu_ctrl, WAIT_MODE);
+    idma_memcpy_1d(&idma_ctrl, 0, (uint32_t)l2_w, obi_w, len);
+    eu_idma_wait_a2o(&eu_ctrl, WAIT_MODE);
+    idma_memcpy_1d(&idma_ctrl, 0, axi_y, obi_y, len);
+    eu_idma_wait_a2o(&eu_ctrl, WAIT_MODE);
+    prof_end(REGION_LOAD);
+
+    prof_begin(REGION_GEMM);
+    redmule_gemm(&redmule_ctrl, obi_x, obi_w, obi_y, DIM, DIM, DIM);
+    eu_redmule_wait(&eu_ctrl, WAIT_MODE);
+    prof_end(REGION_GEMM);
+
+    idma_memcpy_1d(&idma_ctrl, 1, axi_y, obi_y, len);
+    eu_idma_wait_o2a(&eu_ctrl, WAIT_MODE);
+
+    fsync_sync_global(&fsync_ctrl);
+    eu_fsync_wait(&eu_ctrl, WAIT_MODE);
+
+    prof_end(REGION_TOTAL);
+
+    /**
+     * 2. Check the accumulators of the tile.
+     */
+    prof_state_t *st = PROF_STATE;
+    prof_record_t *r = &st->rec;
+    uint32_t errors  = 0;
+    uint32_t n_sync  = (MAX_SYNC_LVL == 0) ? 0 : 1;
+
+    if (r->cat_count[PROF_CMI] != 3 || r->cat_count[PROF_CMO] != 1 ||
+        r->cat_count[PROF_CMP] != 1 || r->cat_count[PROF_SNC] != n_sync)
+        errors++;
+    for (uint32_t cat = 0; cat < PROF_N_CAT; cat++)
+        if (st->cat_depth[cat] != 0)
+            errors++;
+    if (st->depth != 0 || r->errors != 0)
+        errors++;
+    for (uint32_t id = REGION_TOTAL; id <= REGION_GEMM; id++)
+        if (r->region_count[id] != 1)
+            errors++;
+    if (r->region_cycles[REGION_TOTAL] <
+        r->region_cycles[REGION_LOAD] + r->region_cycles[REGION_GEMM])
+        errors++;
+    for (uint32_t cat = 0; cat < PROF_N_CAT; cat++)
+        if (r->cat_cycles[cat] > r->region_cycles[REGION_TOTAL])
+            errors++;
+
+    // A mismatched region is counted as an error and not accounted
+    prof_begin(REGION_LOAD);
+    prof_end(REGION_GEMM);
+    if (r->errors != 1 || r->region_count[REGION_GEMM] != 1)
+        errors++;
+
+    // Overlapping operations of a category: it stays busy until the last one ends
+    uint32_t cmi_cycles = r->cat_cycles[PROF_CMI];
+    prof_cat_begin(PROF_CMI);
+    prof_cat_begin(PROF_CMI);
+    prof_cat_end(PROF_CMI);
+    if (st->cat_depth[PROF_CMI] != 1 || r->cat_cycles[PROF_CMI] != cmi_cycles)
+        errors++;
+    prof_cat_end(PROF_CMI);
+    prof_cat_end(PROF_CMI);
+    if (st->cat_depth[PROF_CMI] != 0 || r->cat_cycles[PROF_CMI] < cmi_cycles)
+        errors++;
+
+    /**
+     * 3. Dump the record to L2, tile 0 checks all of them once everybody is done.
+     */
+    prof_dump();
+    if (prof_active())
+        errors++;
+
+    fsync_sync_global(&fsync_ctrl);
+    eu_fsync_wait(&eu_ctrl, WAIT_MODE);
+
+    if (hartid == 0) {
+        for (uint32_t h = 0; h < NUM_HARTS; h++) {
+            volatile prof_record_t *rec = PROF_RECORD(h);
+            if (rec->magic != PROF_MAGIC || rec->hartid != h || rec->errors != 1 ||
+                rec->region_count[REGION_TOTAL] != 1 ||
+                rec->total < rec->region_cycles[REGION_TOTAL])
+                errors++;
+        }
+        prof_report();
+    }
+
+    printf("Number of errors: %d\n", errors);
+    return errors;
+}
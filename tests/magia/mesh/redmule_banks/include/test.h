@@ -0,0 +1,20 @@
+// Copyright 2025-2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+
+#ifndef _TEST_REDMULE_BANKS_INCLUDE_GUARD_
+#define _TEST_REDMULE_BANKS_INCLUDE_GUARD_
+
+#define M_SIZE    (32)
+#define N_SIZE    (32)
+#define K_SIZE    (32)
+
+#define N_STREAMS (4) // X, W, Y and the iDMA prefetch buffer
+#define N_RUNS    (4) // Timed GEMMs per placement
+
+// Source of the iDMA transfer running next to the GEMM
+uint16_t prefetch_src[M_SIZE * N_SIZE];
+
+#endif
@@ -0,0 +1,139 @@
+// Copyright 2025-2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+
+#include <stdint.h>
+#include "test.h"
+
+#include "tile.h"
+#include "idma.h"
+#include "redmule.h"
+#include "eventunit.h"
+
+#define WAIT_MODE WFE
+
+/**
+ * Runs N_RUNS GEMMs on the buffers in `bufs` (X, W, Y, prefetch), each one next to an iDMA
+ * transfer from L2 into the prefetch buffer, and returns the cycles spent.
+ */
+uint32_t run_gemms(redmule_controller_t *redmule_ctrl, idma_controller_t *idma_ctrl, uint32_t *bufs)
+{
+    uint32_t x = bufs[0], w = bufs[1], y = bufs[2], prefetch = bufs[3];
+
+    for (uint32_t i = 0; i < M_SIZE * N_SIZE; i++)
+        *(volatile uint16_t *)(x + i * 2) = (uint16_t)(0x3000 + (i & 0xFF));
+    for (uint32_t i = 0; i < N_SIZE * K_SIZE; i++)
+        *(volatile uint16_t *)(w + i * 2) = (uint16_t)(0x2C00 + ((i * 7) & 0xFF));
+
+    uint32_t cycle_start = perf_get_cycles();
+    for (uint32_t r = 0; r < N_RUNS; r++) {
+        for (uint32_t i = 0; i < M_SIZE * K_SIZE; i++)
+            *(volatile uint16_t *)(y + i * 2) = 0;
+        idma_handle_t dma = idma_memcpy_1d_async(
+            idma_ctrl, 0, (uint32_t)prefetch_src, prefetch, M_SIZE * N_SIZE * 2);
+        redmule_job_t job = redmule_gemm_async(
+            redmule_ctrl, x, w, y, (uint16_t)M_SIZE, (uint16_t)N_SIZE, (uint16_t)K_SIZE);
+        redmule_wait_job(redmule_ctrl, job);
+        idma_wait(idma_ctrl, dma);
+    }
+    return perf_get_cycles() - cycle_start;
+}
+
+/**
+ * This microbenchmark measures the effect of the L1 placement on RedMulE throughput.
+ * The same GEMMs, with an iDMA transfer running next to them, are timed with the X, W, Y and
+ * prefetch buffers packed back to back (all starting on bank 0, as their sizes are multiples of
+ * L1_BANK_WIDTH) and with the buffers placed on disjoint bank groups by l1_alloc_streams.
+ * The test only checks correctness: it fails if the two placements do not produce the same
+ * output. The cycle counts are printed for inspection and not compared, as they are read with
+ * perf_get_cycles and depend on the timing model (the host target has none).
+ */
+int main(void)
+{
+    /**
+     * 0. Get the mesh-tile's hartid and initialize the controllers for the idma and redmule.
+     */
+    uint32_t hartid = get_hartid();
+
+    idma_config_t idma_cfg      = {.hartid = hartid};
+    idma_controller_t idma_ctrl = {
+        .base = NULL,
+        .cfg  = &idma_cfg,
+        .api  = &idma_api,
+    };
+
+    redmule_config_t redmule_cfg      = {.hartid = hartid};
+    redmule_controller_t redmule_ctrl = {
+        .base = NULL,
+        .cfg  = &redmule_cfg,
+        .api  = &redmule_api,
+    };
+
+    idma_init(&idma_ctrl);
+    redmule_init(&redmule_ctrl);
+
+#if STALLING == 0
+    eu_config_t eu_cfg      = {.hartid = hartid};
+    eu_controller_t eu_ctrl = {
+        .base = NULL,
+        .cfg  = &eu_cfg,
+        .api  = &eu_api,
+    };
+    eu_init(&eu_ctrl);
+    eu_redmule_init(&eu_ctrl, 0);
+    eu_idma_init(&eu_ctrl, 0);
+#endif
+
+    l1_alloc_init();
+    uint32_t sizes[N_STREAMS] = {
+        M_SIZE * N_SIZE * 2, N_SIZE * K_SIZE * 2, M_SIZE * K_SIZE * 2, M_SIZE * N_SIZE * 2};
+    uint32_t packed[N_STREAMS];
+    uint32_t placed[N_STREAMS];
+
+    /**
+     * 1. Packed placement, every buffer starts on bank 0.
+     */
+    l1_mark_t mark = l1_mark();
+    packed[0]      = (uint32_t)l1_alloc_aligned(sizes[0], L1_BANK_WIDTH);
+    for (uint32_t i = 1; i < N_STREAMS; i++)
+        packed[i] = (uint32_t)l1_alloc(sizes[i]);
+    for (uint32_t i = 0; i < N_STREAMS; i++) {
+        if (packed[i] == 0) {
+            printf("Out of L1 memory\n");
+            return 1;
+        }
+    }
+    uint32_t packed_cycles = run_gemms(&redmule_ctrl, &idma_ctrl, packed);
+
+    /**
+     * 2. Bank-aware placement, kept alive to compare the outputs.
+     */
+    if (l1_alloc_streams(placed, sizes, N_STREAMS)) {
+        printf("Out of L1 memory\n");
+        return 1;
+    }
+    uint32_t placed_cycles = run_gemms(&redmule_ctrl, &idma_ctrl, placed);
+
+    /**
+     * 3. Check that both placements computed the same output.
+     */
+    uint32_t errors = 0;
+    for (uint32_t i = 0; i < M_SIZE * K_SIZE; i++) {
+        if (*(volatile uint16_t *)(packed[2] + i * 2) != *(volatile uint16_t *)(placed[2] + i * 2))
+            errors++;
+    }
+    l1_reset(mark);
+
+    printf("GEMM %dx%dx%d x%d, packed: %d cycles, bank-aware: %d cycles\n",
+           M_SIZE,
+           N_SIZE,
+           K_SIZE,
+           N_RUNS,
+           packed_cycles,
+           placed_cycles);
+    printf("Number of errors: %d\n", errors);
+
+    return errors;
+}
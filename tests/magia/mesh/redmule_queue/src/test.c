@@ -0,0 +1,167 @@
+// Copyright 2025-2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Alberto Dequino <alberto.dequino@unibo.it>
+
+#include <stdint.h>
+#include "test.h"
+
+#include "tile.h"
+#include "idma.h"
+#include "redmule.h"
+#include "eventunit.h"
+
+#define WAIT_MODE WFE
+
+/**
+ * This test verifies the queued submission of RedMulE jobs: the output data-tile of each
+ * mesh-tile is split in two row blocks, whose GEMMs are submitted back-to-back.
+ */
+int main(void)
+{
+    /**
+     * 0. Get the mesh-tile's hartid, mesh-tile coordinates and define its L1 base,
+     * also initialize the controllers for the idma and redmule.
+     */
+    uint32_t hartid = get_hartid();
+
+    idma_config_t idma_cfg      = {.hartid = hartid};
+    idma_controller_t idma_ctrl = {
+        .base = NULL,
+        .cfg  = &idma_cfg,
+        .api  = &idma_api,
+    };
+
+    redmule_config_t redmule_cfg      = {.hartid = hartid};
+    redmule_controller_t redmule_ctrl = {
+        .base = NULL,
+        .cfg  = &redmule_cfg,
+        .api  = &redmule_api,
+    };
+
+    idma_init(&idma_ctrl);
+    redmule_init(&redmule_ctrl);
+
+#if STALLING == 0
+    eu_config_t eu_cfg      = {.hartid = hartid};
+    eu_controller_t eu_ctrl = {
+        .base = NULL,
+        .cfg  = &eu_cfg,
+        .api  = &eu_api,
+    };
+    eu_init(&eu_ctrl);
+    eu_redmule_init(&eu_ctrl, 0);
+    eu_idma_init(&eu_ctrl, 0);
+#endif
+
+    uint32_t y_id         = GET_Y_ID(hartid);
+    uint32_t x_id         = GET_X_ID(hartid);
+    uint32_t l1_tile_base = get_l1_base(hartid);
+
+    /**
+     * 1. Calculate the static output data-tile dimensions.
+     */
+    uint32_t tile_h_max = ((M_SIZE + MESH_Y_TILES - 1) / MESH_Y_TILES);
+    uint32_t tile_w_max = ((K_SIZE + MESH_X_TILES - 1) / MESH_X_TILES);
+    int32_t tile_h;
+    int32_t tile_w;
+
+    if (((tile_h_max * y_id) + tile_h_max) > M_SIZE) {
+        tile_h = M_SIZE - (tile_h_max * y_id);
+    } else {
+        tile_h = tile_h_max;
+    }
+
+    if (((tile_w_max * x_id) + tile_w_max) > K_SIZE) {
+        tile_w = K_SIZE - (tile_w_max * x_id);
+    } else {
+        tile_w = tile_w_max;
+    }
+
+    if (tile_h < 1 || tile_w < 1) {
+        return 0;
+    }
+
+    /**
+     * 2. Load the output, input and weight data-tiles.
+     */
+    uint32_t obi_addr_y = l1_tile_base;
+    uint32_t obi_addr_x = obi_addr_y + (tile_h * tile_w * 2);
+    uint32_t obi_addr_w = obi_addr_x + (tile_h * N_SIZE * 2);
+    uint32_t axi_addr_y =
+        (uint32_t)y_inp + (y_id * K_SIZE * tile_h_max * 2) + (tile_w_max * x_id * 2);
+    uint32_t axi_addr_x = (uint32_t)x_inp + (y_id * N_SIZE * tile_h_max * 2);
+    uint32_t axi_addr_w = (uint32_t)w_inp + (x_id * tile_w_max * 2);
+
+    idma_memcpy_2d_async(&idma_ctrl, 0, axi_addr_y, obi_addr_y, tile_w * 2, K_SIZE * 2, tile_h);
+    idma_memcpy_1d_async(&idma_ctrl, 0, axi_addr_x, obi_addr_x, tile_h * N_SIZE * 2);
+    idma_wait(&idma_ctrl,
+              idma_memcpy_2d_async(
+                  &idma_ctrl, 0, axi_addr_w, obi_addr_w, tile_w * 2, K_SIZE * 2, N_SIZE));
+
+    /**
+     * 3. Submit the two row blocks back-to-back, the second one is queued while the first one
+     * is running.
+     */
+    uint32_t rows_0 = (uint32_t)tile_h / 2;
+    uint32_t rows_1 = (uint32_t)tile_h - rows_0;
+    redmule_job_t last;
+
+    if (rows_0 > 0) {
+        redmule_gemm_async(&redmule_ctrl,
+                           obi_addr_x,
+                           obi_addr_w,
+                           obi_addr_y,
+                           (uint16_t)rows_0,
+                           (uint16_t)N_SIZE,
+                           (uint16_t)tile_w);
+    }
+    last = redmule_gemm_async(&redmule_ctrl,
+                              obi_addr_x + (rows_0 * N_SIZE * 2),
+                              obi_addr_w,
+                              obi_addr_y + (rows_0 * tile_w * 2),
+                              (uint16_t)rows_1,
+                              (uint16_t)N_SIZE,
+                              (uint16_t)tile_w);
+
+    redmule_job_t first = redmule_wait_any(&redmule_ctrl);
+    if (rows_0 > 0 && first == last) {
+        printf("Jobs completed out of order: %d\n", first);
+        return 1;
+    }
+    redmule_wait_job(&redmule_ctrl, last);
+
+    /**
+     * 4. Store the output data-tile back to L2
+     */
+    idma_wait(&idma_ctrl,
+              idma_memcpy_2d_async(
+                  &idma_ctrl, 1, axi_addr_y, obi_addr_y, tile_w * 2, K_SIZE * 2, tile_h));
+
+    /**
+     * 5. Check results
+     */
+    uint32_t errors = 0;
+    uint16_t computed, expected, diff = 0;
+    for (int i = (y_id * tile_h_max); i < (y_id * tile_h_max + tile_h); i++) {
+        for (int j = (x_id * tile_w_max); j < (x_id * tile_w_max) + tile_w; j++) {
+            computed = *(volatile uint16_t *)(y_inp + (i * K_SIZE + j));
+            expected = *(volatile uint16_t *)(z_out + (i * K_SIZE + j));
+            diff     = (computed > expected) ? (computed - expected) : (expected - computed);
+            if (diff > 0x0011) {
+#if EVAL == 1
+                printf("Error detected at coordinates[%d][%d]: Y=%x Z=%x\n",
+                       i,
+                       j,
+                       *(volatile uint16_t *)(y_inp + (i * K_SIZE + j)),
+                       *(volatile uint16_t *)(z_out + (i * K_SIZE + j)));
+#endif
+                errors++;
+            }
+        }
+    }
+    printf("Number of errors: %d\n", errors);
+
+    return errors;
+}
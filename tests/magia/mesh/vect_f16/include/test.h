@@ -0,0 +1,21 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef _TEST_VECT_F16_INCLUDE_GUARD_
+#define _TEST_VECT_F16_INCLUDE_GUARD_
+
+#define MAX_DIM (67) // Longest vector checked, odd to exercise the tails
+
+// Vector lengths checked by the test
+static const uint32_t dims[] = {0, 1, 2, 7, 32, 33, MAX_DIM};
+
+// Element offsets of (dst, a, b) from a word boundary: aligned, all in the middle of a word, mixed
+static const uint32_t offsets[][3] = {
+    {0, 0, 0},
+    {1, 1, 1},
+    {0, 1, 0},
+    {1, 0, 1},
+};
+
+#endif
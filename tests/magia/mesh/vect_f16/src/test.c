@@ -0,0 +1,157 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <stdint.h>
+#include "test.h"
+#include "tile.h"
+#include "utils/vect_utils.h"
+
+enum { OP_ADD, OP_SUB, OP_MUL, OP_MAX, OP_SCALE, OP_FILL, N_OPS };
+
+static const char *op_names[N_OPS] = {"add", "sub", "mul", "max", "scale", "fill"};
+
+/* Multiples of 0.25 in [-2.75, 2.75]: every sum and product below is exact in fp16 */
+static _Float16 value(uint32_t i, uint32_t seed)
+{
+    return (_Float16)((int32_t)((i * 7 + seed) % 23) - 11) * (_Float16)0.25f;
+}
+
+static _Float16 reference(uint32_t op, _Float16 a, _Float16 b)
+{
+    switch (op) {
+        case OP_ADD: return a + b;
+        case OP_SUB: return a - b;
+        case OP_MUL: return a * b;
+        case OP_MAX: return (a > b) ? a : b;
+        case OP_SCALE: return a * (_Float16)-1.5f;
+        default: return (_Float16)0.75f;
+    }
+}
+
+static void run(uint32_t op, uint32_t dst, uint32_t a, uint32_t b, uint32_t dim)
+{
+    switch (op) {
+        case OP_ADD: vect_add_f16(dst, a, b, dim); break;
+        case OP_SUB: vect_sub_f16(dst, a, b, dim); break;
+        case OP_MUL: vect_mul_f16(dst, a, b, dim); break;
+        case OP_MAX: vect_max_f16(dst, a, b, dim); break;
+        case OP_SCALE: vect_scale_f16(dst, a, (_Float16)-1.5f, dim); break;
+        default: vect_fill_f16(dst, (_Float16)0.75f, dim); break;
+    }
+}
+
+/* The element-by-element loop of attention_utils.h that each kernel replaces, for the timing */
+static void run_scalar(uint32_t op, uint32_t dst, uint32_t a, uint32_t b, uint32_t dim)
+{
+    for (uint32_t i = 0; i < dim; i++) {
+        _Float16 x = (op == OP_FILL) ? (_Float16)0 : *(volatile _Float16 *)(a + i * 2);
+        _Float16 y = *(volatile _Float16 *)(b + i * 2);
+        (*(volatile _Float16 *)(dst + i * 2)) = reference(op, x, y);
+    }
+}
+
+/**
+ * This test checks the packed fp16 kernels of vect_utils.h against their scalar definition, on
+ * aligned and misaligned vectors of odd and even lengths. The guard element after dst must be left
+ * untouched.
+ * With EVAL=1 it also prints the cycles of each kernel and of the scalar loop on MAX_DIM aligned
+ * elements. These are not compared, as they depend on the timing model (the host target has none).
+ */
+int main(void)
+{
+    uint32_t hartid  = get_hartid();
+    uint32_t l1_base = get_l1_base(hartid);
+
+    uint32_t buf_size = ((MAX_DIM + 2) * 2 + 3) & ~3; // Word multiple, room for offset and guard
+    uint32_t buf_dst  = l1_base;
+    uint32_t buf_a    = buf_dst + buf_size;
+    uint32_t buf_b    = buf_a + buf_size;
+
+    uint32_t n_errors = 0;
+
+    for (uint32_t d = 0; d < sizeof(dims) / sizeof(dims[0]); d++) {
+        uint32_t dim = dims[d];
+
+        for (uint32_t o = 0; o < sizeof(offsets) / sizeof(offsets[0]); o++) {
+            _Float16 *dst = (_Float16 *)(buf_dst + offsets[o][0] * 2);
+            _Float16 *a   = (_Float16 *)(buf_a + offsets[o][1] * 2);
+            _Float16 *b   = (_Float16 *)(buf_b + offsets[o][2] * 2);
+
+            for (uint32_t i = 0; i < dim; i++) {
+                a[i] = value(i, 3);
+                b[i] = value(i, hartid);
+            }
+
+            for (uint32_t op = 0; op < N_OPS; op++) {
+                for (uint32_t i = 0; i <= dim; i++)
+                    dst[i] = (_Float16)100.0f;
+
+                run(op, (uint32_t)dst, (uint32_t)a, (uint32_t)b, dim);
+
+                for (uint32_t i = 0; i <= dim; i++) {
+                    _Float16 exp = (i < dim) ? reference(op, a[i], b[i]) : (_Float16)100.0f;
+                    if (dst[i] != exp) {
+                        printf("[HARTID %d] ERROR: %s dim %d offsets %d: dst[%d] = %x, expected %x\n",
+                               hartid,
+                               op_names[op],
+                               dim,
+                               o,
+                               i,
+                               *(uint16_t *)&dst[i],
+                               *(uint16_t *)&exp);
+                        n_errors++;
+                    }
+                }
+            }
+
+            // Empty vectors reduce to the identities: 0 and -inf
+            if (dim == 0) {
+                _Float16 max = vect_reduce_max_f16((uint32_t)a, 0);
+                if (vect_reduce_sum_f16((uint32_t)a, 0) != 0 || *(uint16_t *)&max != 0xfc00) {
+                    printf("[HARTID %d] ERROR: reduce dim 0 offsets %d\n", hartid, o);
+                    n_errors++;
+                }
+                continue;
+            }
+
+            _Float16 sum = 0;
+            _Float16 max = a[0];
+            for (uint32_t i = 0; i < dim; i++) {
+                sum += a[i];
+                max = (a[i] > max) ? a[i] : max;
+            }
+            if (vect_reduce_sum_f16((uint32_t)a, dim) != sum) {
+                printf("[HARTID %d] ERROR: reduce_sum dim %d offsets %d\n", hartid, dim, o);
+                n_errors++;
+            }
+            if (vect_reduce_max_f16((uint32_t)a, dim) != max) {
+                printf("[HARTID %d] ERROR: reduce_max dim %d offsets %d\n", hartid, dim, o);
+                n_errors++;
+            }
+        }
+    }
+
+#if EVAL == 1
+    perf_enable_cycles();
+    for (uint32_t op = 0; op < N_OPS; op++) {
+        uint32_t cycle_start = perf_get_cycles();
+        run(op, buf_dst, buf_a, buf_b, MAX_DIM);
+        uint32_t cycles_vect = perf_get_cycles() - cycle_start;
+
+        cycle_start = perf_get_cycles();
+        run_scalar(op, buf_dst, buf_a, buf_b, MAX_DIM);
+        uint32_t cycles_scalar = perf_get_cycles() - cycle_start;
+
+        printf("[HARTID %d] %s dim %d: packed %d cycles, scalar %d cycles\n",
+               hartid,
+               op_names[op],
+               MAX_DIM,
+               cycles_vect,
+               cycles_scalar);
+    }
+#endif
+
+    printf("Number of errors: %d\n", n_errors);
+    return n_errors;
+}
@@ -123,15 +123,15 @@ static int run_spatz_task(eu_controller_t *eu_ctrl, int init)
 
     if (!init)
         spatz_init(SPATZ_BINARY_START);
-    // else
-    //     spatz_clk_en();
+    else
+        spatz_resume();
     spatz_run_task_with_params(FFT_FS_TASK, FFT_PARAMS_BASE);
 
     eu_spatz_wait(eu_ctrl, WFE);
 
     ret = spatz_get_exit_code();
 
-    // spatz_clk_dis();
+    spatz_suspend();
 
     return ret;
 }
@@ -0,0 +1,33 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef SPATZ_CHAIN_MEM_LAYOUT_H_
+#define SPATZ_CHAIN_MEM_LAYOUT_H_
+
+#include "tile.h"
+#include "spatz_chain_params.h"
+
+#define ALIGNMENT         (4)
+
+/* Aligns the given address to 4-byte  */
+#define ALIGN_4B(addr)    (((addr) + (ALIGNMENT - 1)) & ~(ALIGNMENT - 1))
+
+#define VEC_LEN           (256)
+#define CHAIN_LEN         (3)
+
+#define L1_BASE_TILE      (L1_BASE + (get_hartid() * L1_TILE_OFFSET))
+
+#define CHAIN_QUEUE_BASE  (L1_BASE_TILE)
+#define CHAIN_QUEUE_SIZE  ALIGN_4B(sizeof(spatz_queue_t))
+
+#define CHAIN_PARAMS_BASE ALIGN_4B(CHAIN_QUEUE_BASE + CHAIN_QUEUE_SIZE)
+#define CHAIN_PARAMS_SIZE ALIGN_4B(CHAIN_LEN * sizeof(spatz_chain_params_t))
+
+#define CHAIN_X_BASE      ALIGN_4B(CHAIN_PARAMS_BASE + CHAIN_PARAMS_SIZE)
+#define CHAIN_X_SIZE      ALIGN_4B(VEC_LEN * sizeof(float16))
+
+#define CHAIN_Y_BASE      ALIGN_4B(CHAIN_X_BASE + CHAIN_X_SIZE)
+#define CHAIN_Y_SIZE      ALIGN_4B(VEC_LEN * sizeof(float16))
+
+#endif /* SPATZ_CHAIN_MEM_LAYOUT_H_ */
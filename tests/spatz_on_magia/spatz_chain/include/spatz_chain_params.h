@@ -0,0 +1,16 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef SPATZ_CHAIN_PARAMS_H_
+#define SPATZ_CHAIN_PARAMS_H_
+
+#include <stdint.h>
+
+typedef struct {
+    uintptr_t src; /* Input vector                       */
+    uintptr_t dst; /* Output vector, may be equal to src */
+    uint32_t len;  /* Number of fp16 elements            */
+} spatz_chain_params_t;
+
+#endif /* SPATZ_CHAIN_PARAMS_H_ */
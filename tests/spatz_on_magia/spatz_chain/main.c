@@ -0,0 +1,132 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tile.h"
+#include "idma.h"
+#include "eventunit.h"
+
+#include "spatz_chain_mem_layout.h"
+#include "spatz_chain_params.h"
+#include "spatz_chain_task_bin.h"
+
+#define HID get_hartid()
+
+/* L2 copy of the input, written by the iDMA while Spatz runs the chain */
+float16 x_copy[NUM_HARTS * VEC_LEN];
+
+static float16 input(uint32_t i)
+{
+    return (float16)((int)(i % 64) - 32);
+}
+
+static float16 expected(uint32_t i)
+{
+    int y = 2 * ((int)(i % 64) - 32) + 3;
+    return (float16)(y > 0 ? y : 0);
+}
+
+/**
+ * Queues a scale -> bias -> ReLU chain on Spatz with a single start, and overlaps it with an
+ * iDMA transfer from the CV32 side.
+ */
+static int run_test()
+{
+    int errors = 0;
+    uint32_t ret;
+    spatz_queue_t *queue;
+    volatile spatz_chain_params_t *params;
+    uint32_t tasks[CHAIN_LEN] = {CHAIN_SCALE_TASK, CHAIN_BIAS_TASK, CHAIN_RELU_TASK};
+
+    eu_config_t eu_cfg      = {.hartid = HID};
+    eu_controller_t eu_ctrl = {
+        .base = NULL,
+        .cfg  = &eu_cfg,
+        .api  = &eu_api,
+    };
+    eu_init(&eu_ctrl);
+    eu_spatz_init(&eu_ctrl, 0);
+    eu_idma_init(&eu_ctrl, 0);
+
+    idma_config_t idma_cfg      = {.hartid = HID};
+    idma_controller_t idma_ctrl = {
+        .base = NULL,
+        .cfg  = &idma_cfg,
+        .api  = &idma_api,
+    };
+    idma_init(&idma_ctrl);
+
+    for (uint32_t i = 0; i < VEC_LEN; i++) {
+        mmio_fp16(CHAIN_X_BASE + i * sizeof(float16)) = input(i);
+        mmio_fp16(CHAIN_Y_BASE + i * sizeof(float16)) = 0;
+    }
+
+    /* The first task reads X, the others work in place on Y */
+    params = (volatile spatz_chain_params_t *)CHAIN_PARAMS_BASE;
+    queue  = (spatz_queue_t *)CHAIN_QUEUE_BASE;
+    spatz_queue_init(queue);
+    for (uint32_t t = 0; t < CHAIN_LEN; t++) {
+        params[t].src = (t == 0) ? CHAIN_X_BASE : CHAIN_Y_BASE;
+        params[t].dst = CHAIN_Y_BASE;
+        params[t].len = VEC_LEN;
+        if (spatz_queue_push(queue, tasks[t], (uint32_t)&params[t])) {
+            printf("[CV32 (%d)] Spatz queue full\n", HID);
+            return -1;
+        }
+    }
+
+    spatz_init(SPATZ_BINARY_START);
+    spatz_queue_start(queue, SPATZ_QUEUE_TASK);
+
+    /* CV32 side work while Spatz runs the chain */
+    idma_wait(&idma_ctrl,
+              idma_memcpy_1d_async(&idma_ctrl,
+                                   1,
+                                   (uint32_t)&x_copy[HID * VEC_LEN],
+                                   CHAIN_X_BASE,
+                                   VEC_LEN * sizeof(float16)));
+
+    eu_spatz_wait(&eu_ctrl, WFE);
+    ret = spatz_get_exit_code();
+    spatz_clk_dis();
+
+    if (ret != 0 || spatz_queue_pending(queue) != 0) {
+        printf("[CV32 (%d)] Spatz chain FAILED with error: %d, %d tasks left\n",
+               HID,
+               ret,
+               spatz_queue_pending(queue));
+        return -1;
+    }
+
+    for (uint32_t i = 0; i < VEC_LEN; i++) {
+        if (mmio_fp16(CHAIN_Y_BASE + i * sizeof(float16)) != expected(i))
+            errors++;
+        if (x_copy[HID * VEC_LEN + i] != input(i))
+            errors++;
+    }
+
+    return errors;
+}
+
+int main(void)
+{
+    int ret;
+
+    if (HID == 0)
+        printf("\n############################### SPATZ_CHAIN TEST on %d Tiles "
+               "##############################\n\n",
+               NUM_HARTS);
+
+    ret = run_test();
+    if (ret == 0) {
+        printf("[CV32 (%d)] Test SUCCESS\n", HID);
+    } else {
+        printf("[CV32 (%d)] Test FAILED\n", HID);
+    }
+
+    if (HID == 0)
+        printf("\n#################################################################################"
+               "#########\n\n");
+
+    return ret;
+}
@@ -0,0 +1,84 @@
+// Copyright 2026 ETH Zurich, University of Bologna and Fondazione Chips-IT.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tile.h"
+#include "spatz_chain_params.h"
+
+/* Y = 2 * X */
+int chain_scale_task(void)
+{
+    volatile spatz_chain_params_t *params;
+    const _Float16 *p_src;
+    _Float16 *p_dst;
+    _Float16 TWO = 2.0f;
+    size_t avl;
+    size_t vl;
+
+    params = (volatile spatz_chain_params_t *)mmio32(SPATZ_DATA);
+    p_src  = (const _Float16 *)params->src;
+    p_dst  = (_Float16 *)params->dst;
+
+    for (avl = params->len; avl > 0; avl -= vl) {
+        asm volatile("vsetvli %0, %1, e16, m8, ta, ma" : "=r"(vl) : "r"(avl));
+        asm volatile("vle16.v v0, (%0)" ::"r"(p_src));
+        asm volatile("vfmul.vf v0, v0, %0" ::"f"(TWO));
+        asm volatile("vse16.v v0, (%0)" ::"r"(p_dst));
+        p_src += vl;
+        p_dst += vl;
+    }
+
+    return 0;
+}
+
+/* Y = X + 3 */
+int chain_bias_task(void)
+{
+    volatile spatz_chain_params_t *params;
+    const _Float16 *p_src;
+    _Float16 *p_dst;
+    _Float16 THREE = 3.0f;
+    size_t avl;
+    size_t vl;
+
+    params = (volatile spatz_chain_params_t *)mmio32(SPATZ_DATA);
+    p_src  = (const _Float16 *)params->src;
+    p_dst  = (_Float16 *)params->dst;
+
+    for (avl = params->len; avl > 0; avl -= vl) {
+        asm volatile("vsetvli %0, %1, e16, m8, ta, ma" : "=r"(vl) : "r"(avl));
+        asm volatile("vle16.v v0, (%0)" ::"r"(p_src));
+        asm volatile("vfadd.vf v0, v0, %0" ::"f"(THREE));
+        asm volatile("vse16.v v0, (%0)" ::"r"(p_dst));
+        p_src += vl;
+        p_dst += vl;
+    }
+
+    return 0;
+}
+
+/* Y = max(X, 0) */
+int chain_relu_task(void)
+{
+    volatile spatz_chain_params_t *params;
+    const _Float16 *p_src;
+    _Float16 *p_dst;
+    _Float16 ZERO = 0.0f;
+    size_t avl;
+    size_t vl;
+
+    params = (volatile spatz_chain_params_t *)mmio32(SPATZ_DATA);
+    p_src  = (const _Float16 *)params->src;
+    p_dst  = (_Float16 *)params->dst;
+
+    for (avl = params->len; avl > 0; avl -= vl) {
+        asm volatile("vsetvli %0, %1, e16, m8, ta, ma" : "=r"(vl) : "r"(avl));
+        asm volatile("vle16.v v0, (%0)" ::"r"(p_src));
+        asm volatile("vfmax.vf v0, v0, %0" ::"f"(ZERO));
+        asm volatile("vse16.v v0, (%0)" ::"r"(p_dst));
+        p_src += vl;
+        p_dst += vl;
+    }
+
+    return 0;
+}